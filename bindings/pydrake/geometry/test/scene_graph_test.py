@@ -487,12 +487,14 @@ class TestGeometrySceneGraph(unittest.TestCase):
             point_stiffness=9,
         )
         param_init_scene_graph = mut.SceneGraphConfig(
-            default_proximity_properties=param_init_props
+            default_proximity_properties=param_init_props,
+            hydroelastic_build_threads=2,
         )
         # Spot-check that at least some value got passed through.
         got_props = param_init_scene_graph.default_proximity_properties
         self.assertEqual(got_props.relaxation_time, None)
         self.assertEqual(got_props.point_stiffness, 9)
+        self.assertEqual(param_init_scene_graph.hydroelastic_build_threads, 2)
 
     @numpy_compare.check_all_types
     def test_scene_graph_renderer_with_context(self, T):
@@ -2,6 +2,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "drake/bindings/generated_docstrings/multibody_plant.h"
@@ -31,6 +32,7 @@
 #include "drake/multibody/plant/point_pair_contact_info.h"
 #include "drake/multibody/plant/propeller.h"
 #include "drake/multibody/plant/wing.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/spatial_inertia.h"
 
 namespace drake {
@@ -195,6 +197,27 @@ void DoScalarDependentDefinitions(py::module m, T) {
         py_rvp::reference, doc.CalcContactFrictionFromSurfaceProperties.doc);
   }
 
+  // MassMatrixFactorization
+  {
+    using Class = MassMatrixFactorization<T>;
+    constexpr auto& cls_doc =
+        pydrake_doc_multibody_tree.drake.multibody.MassMatrixFactorization;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "MassMatrixFactorization", param, cls_doc.doc);
+    cls  // BR
+        .def(py::init<>(), cls_doc.ctor.doc_0args)
+        .def(py::init<std::vector<int>, const Eigen::Ref<const MatrixX<T>>&>(),
+            py::arg("parent_indices"), py::arg("M"), cls_doc.ctor.doc_2args)
+        .def("size", &Class::size, cls_doc.size.doc)
+        .def("parent_indices", &Class::parent_indices,
+            cls_doc.parent_indices.doc)
+        .def("D", &Class::D, cls_doc.D.doc)
+        .def("Solve", &Class::Solve, py::arg("b"), cls_doc.Solve.doc)
+        .def("Multiply", &Class::Multiply, py::arg("x"), cls_doc.Multiply.doc)
+        .def("CalcDenseL", &Class::CalcDenseL, cls_doc.CalcDenseL.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   {
     using Class = MultibodyPlant<T>;
     constexpr auto& cls_doc = doc.MultibodyPlant;
@@ -600,6 +623,12 @@ void DoScalarDependentDefinitions(py::module m, T) {
             },
             py::arg("context"), py::arg("model_instance"),
             cls_doc.GetVelocities.doc_2args)
+        .def("SetForwardDynamicsParallelism",
+            &Class::SetForwardDynamicsParallelism, py::arg("parallelism"),
+            cls_doc.SetForwardDynamicsParallelism.doc)
+        .def("forward_dynamics_parallelism",
+            &Class::forward_dynamics_parallelism,
+            cls_doc.forward_dynamics_parallelism.doc)
         .def(
             "EvalBodyPoseInWorld",
             [](const Class* self, const Context<T>& context,
@@ -745,6 +774,46 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("CalcInverseDynamics", &Class::CalcInverseDynamics,
             py::arg("context"), py::arg("known_vdot"),
             py::arg("external_forces"), cls_doc.CalcInverseDynamics.doc)
+        .def(
+            "CalcInverseDynamicsDerivatives",
+            [](const Class* self, const Context<T>& context,
+                const VectorX<T>& known_vdot,
+                const MultibodyForces<T>& external_forces) {
+              const int nq = self->num_positions();
+              const int nv = self->num_velocities();
+              MatrixX<T> dtau_dq(nv, nq);
+              MatrixX<T> dtau_dv(nv, nv);
+              MatrixX<T> dtau_dvdot(nv, nv);
+              self->CalcInverseDynamicsDerivatives(context, known_vdot,
+                  external_forces, &dtau_dq, &dtau_dv, &dtau_dvdot);
+              return std::make_tuple(dtau_dq, dtau_dv, dtau_dvdot);
+            },
+            py::arg("context"), py::arg("known_vdot"),
+            py::arg("external_forces"),
+            (std::string(cls_doc.CalcInverseDynamicsDerivatives.doc) + R""(
+Note: The above is for the C++ documentation. For Python, use
+`dtau_dq, dtau_dv, dtau_dvdot = CalcInverseDynamicsDerivatives(
+    context, known_vdot, external_forces)`)"")
+                .c_str())
+        .def(
+            "CalcForwardDynamicsDerivatives",
+            [](const Class* self, const Context<T>& context,
+                const MultibodyForces<T>& applied_forces) {
+              const int nq = self->num_positions();
+              const int nv = self->num_velocities();
+              MatrixX<T> dvdot_dq(nv, nq);
+              MatrixX<T> dvdot_dv(nv, nv);
+              MatrixX<T> dvdot_dtau(nv, nv);
+              self->CalcForwardDynamicsDerivatives(
+                  context, applied_forces, &dvdot_dq, &dvdot_dv, &dvdot_dtau);
+              return std::make_tuple(dvdot_dq, dvdot_dv, dvdot_dtau);
+            },
+            py::arg("context"), py::arg("applied_forces"),
+            (std::string(cls_doc.CalcForwardDynamicsDerivatives.doc) + R""(
+Note: The above is for the C++ documentation. For Python, use
+`dvdot_dq, dvdot_dv, dvdot_dtau = CalcForwardDynamicsDerivatives(
+    context, applied_forces)`)"")
+                .c_str())
         .def("CalcForceElementsContribution",
             &Class::CalcForceElementsContribution, py::arg("context"),
             py::arg("forces"), cls_doc.CalcForceElementsContribution.doc)
@@ -784,6 +853,9 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return H;
             },
             py::arg("context"), cls_doc.CalcMassMatrix.doc)
+        .def("CalcMassMatrixFactorization",
+            &Class::CalcMassMatrixFactorization, py::arg("context"),
+            cls_doc.CalcMassMatrixFactorization.doc)
         .def(
             "CalcBiasSpatialAcceleration",
             [](const Class* self, const systems::Context<T>& context,
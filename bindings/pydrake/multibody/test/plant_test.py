@@ -71,6 +71,7 @@ from pydrake.multibody.plant import (
     DistanceConstraintParams,
     ExternallyAppliedSpatialForce_,
     ExternallyAppliedSpatialForceMultiplexer_,
+    MassMatrixFactorization_,
     MultibodyPlant,
     MultibodyPlant_,
     MultibodyPlantConfig,
@@ -3344,6 +3345,10 @@ class TestPlant(unittest.TestCase):
         # Set an arbitrary configuration away from the model's fixed point.
         plant.SetPositions(context, [0.1, 0.2])
 
+        self.assertEqual(plant.forward_dynamics_parallelism().num_threads(), 1)
+        plant.SetForwardDynamicsParallelism(parallelism=Parallelism(2))
+        self.assertEqual(plant.forward_dynamics_parallelism().num_threads(), 2)
+
         M = plant.CalcMassMatrixViaInverseDynamics(context)
         M = plant.CalcMassMatrix(context)
         Cv = plant.CalcBiasTerm(context)
@@ -3353,10 +3358,53 @@ class TestPlant(unittest.TestCase):
         self.assertTrue(Cv.shape == (2,))
         self.assert_sane(Cv, nonzero=False)
         nv = plant.num_velocities()
+        factorization = plant.CalcMassMatrixFactorization(context=context)
+        self.assertIsInstance(factorization, MassMatrixFactorization_[T])
+        self.assertEqual(factorization.size(), nv)
+        self.assertEqual(factorization.parent_indices(), [-1, 0])
+        self.assertEqual(factorization.D().shape, (nv,))
+        self.assertEqual(factorization.CalcDenseL().shape, (nv, nv))
+        x = np.array([1.0, 2.0])
+        numpy_compare.assert_float_allclose(
+            factorization.Multiply(x=x),
+            numpy_compare.to_float(M) @ x,
+            atol=1e-12,
+        )
+        numpy_compare.assert_float_allclose(
+            factorization.Solve(b=M @ x), x, atol=1e-12
+        )
+        from_matrix = MassMatrixFactorization_[T](parent_indices=[-1, 0], M=M)
+        numpy_compare.assert_float_allclose(
+            from_matrix.D(),
+            numpy_compare.to_float(factorization.D()),
+            atol=1e-12,
+        )
+        self.assertEqual(MassMatrixFactorization_[T]().size(), 0)
         vd_d = np.zeros(nv)
         tau = plant.CalcInverseDynamics(context, vd_d, MultibodyForces(plant))
         self.assertEqual(tau.shape, (2,))
         self.assert_sane(tau, nonzero=False)
+        nq = plant.num_positions()
+        dtau_dq, dtau_dv, dtau_dvdot = plant.CalcInverseDynamicsDerivatives(
+            context=context,
+            known_vdot=vd_d,
+            external_forces=MultibodyForces(plant),
+        )
+        self.assertEqual(dtau_dq.shape, (nv, nq))
+        self.assertEqual(dtau_dv.shape, (nv, nv))
+        numpy_compare.assert_float_allclose(
+            dtau_dvdot, numpy_compare.to_float(M), atol=1e-12
+        )
+        dvdot_dq, dvdot_dv, dvdot_dtau = plant.CalcForwardDynamicsDerivatives(
+            context=context, applied_forces=MultibodyForces(plant)
+        )
+        self.assertEqual(dvdot_dq.shape, (nv, nq))
+        self.assertEqual(dvdot_dv.shape, (nv, nv))
+        numpy_compare.assert_float_allclose(
+            numpy_compare.to_float(dvdot_dtau) @ numpy_compare.to_float(M),
+            np.eye(nv),
+            atol=1e-12,
+        )
         # - Existence checks.
         # Gravity leads to non-zero potential energy.
         potential_energy = plant.CalcPotentialEnergy(context)
@@ -1,3 +1,4 @@
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -5,6 +6,7 @@
 #include "drake/bindings/pydrake/planning/planning_py.h"
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/planning/graph_algorithms/max_clique_solver_base.h"
+#include "drake/planning/graph_algorithms/max_clique_solver_via_branch_and_bound.h"
 #include "drake/planning/graph_algorithms/max_clique_solver_via_greedy.h"
 #include "drake/planning/graph_algorithms/max_clique_solver_via_mip.h"
 #include "drake/planning/graph_algorithms/min_clique_cover_solver_base.h"
@@ -62,6 +64,23 @@ void DefinePlanningGraphAlgorithms(py::module m) {
         m, "MaxCliqueSolverViaGreedy", cls_doc.doc)
         .def(py::init<>(), cls_doc.ctor.doc);
   }
+  {
+    using Class = MaxCliqueSolverViaBranchAndBound;
+    const auto& cls_doc = doc.MaxCliqueSolverViaBranchAndBound;
+    py::class_<Class, MaxCliqueSolverBase>(
+        m, "MaxCliqueSolverViaBranchAndBound", cls_doc.doc)
+        .def(py::init<Parallelism, double>(),
+            py::arg("parallelism") = Parallelism::Max(),
+            py::arg("time_limit") = std::numeric_limits<double>::infinity(),
+            cls_doc.ctor.doc)
+        .def("SetParallelism", &Class::SetParallelism, py::arg("parallelism"),
+            cls_doc.SetParallelism.doc)
+        .def("GetParallelism", &Class::GetParallelism,
+            cls_doc.GetParallelism.doc)
+        .def("SetTimeLimit", &Class::SetTimeLimit, py::arg("time_limit"),
+            cls_doc.SetTimeLimit.doc)
+        .def("GetTimeLimit", &Class::GetTimeLimit, cls_doc.GetTimeLimit.doc);
+  }
   {
     class PyMinCliqueCoverSolverBase : public MinCliqueCoverSolverBase {
      public:
@@ -23,6 +23,9 @@ void DefinePlanningIrisZo(py::module m) {
           cls_doc.sampled_iris_options.doc)
       .def_readwrite("bisection_steps", &IrisZoOptions::bisection_steps,
           cls_doc.bisection_steps.doc)
+      .def_readwrite("use_sphere_prefilter",
+          &IrisZoOptions::use_sphere_prefilter,
+          cls_doc.use_sphere_prefilter.doc)
       .def_readwrite("parameterization", &IrisZoOptions::parameterization,
           cls_doc.parameterization.doc)
       .def("__repr__", [](const IrisZoOptions& self) {
@@ -30,8 +33,10 @@ void DefinePlanningIrisZo(py::module m) {
             "IrisZoOptions("
             "bisection_steps={}, "
             "sampled_iris_options={}, "
+            "use_sphere_prefilter={}, "
             ")")
-            .format(self.bisection_steps, self.sampled_iris_options);
+            .format(self.bisection_steps, self.sampled_iris_options,
+                self.use_sphere_prefilter);
       });
 
   // The `options` contains a `Parallelism`; we must release the GIL.
@@ -1,3 +1,5 @@
+#include <limits>
+
 #include "drake/bindings/generated_docstrings/planning.h"
 #include "drake/bindings/pydrake/planning/planning_py.h"
 #include "drake/bindings/pydrake/pydrake_pybind.h"
@@ -15,6 +17,42 @@ void DefinePlanningVisibilityGraph(py::module m) {
   m.def("VisibilityGraph", &planning::VisibilityGraph, py::arg("checker"),
       py::arg("points"), py::arg("parallelize") = true,
       py::call_guard<py::gil_scoped_release>(), doc.VisibilityGraph.doc);
+
+  {
+    using Class = IncrementalVisibilityGraph;
+    constexpr auto& cls_doc = doc.IncrementalVisibilityGraph;
+    py::class_<Class>(m, "IncrementalVisibilityGraph", cls_doc.doc)
+        .def(py::init<const CollisionChecker&, double>(), py::arg("checker"),
+            py::arg("max_edge_distance") =
+                std::numeric_limits<double>::infinity(),
+            // Keep alive, reference: `self` keeps `checker` alive.
+            py::keep_alive<1, 2>(), cls_doc.ctor.doc_2args)
+        .def(py::init<const CollisionChecker&,
+                 const Eigen::Ref<const Eigen::MatrixXd>&,
+                 const Eigen::SparseMatrix<bool>&, double>(),
+            py::arg("checker"), py::arg("points"), py::arg("adjacency"),
+            py::arg("max_edge_distance") =
+                std::numeric_limits<double>::infinity(),
+            // Keep alive, reference: `self` keeps `checker` alive.
+            py::keep_alive<1, 2>(), cls_doc.ctor.doc_4args)
+        .def("AddPoints", &Class::AddPoints, py::arg("points"),
+            py::arg("parallelize") = Parallelism::Max(),
+            py::call_guard<py::gil_scoped_release>(), cls_doc.AddPoints.doc)
+        .def("AddCollisionFreePoints", &Class::AddCollisionFreePoints,
+            py::arg("points"), py::arg("parallelize") = Parallelism::Max(),
+            py::call_guard<py::gil_scoped_release>(),
+            cls_doc.AddCollisionFreePoints.doc)
+        .def("RemovePoints", &Class::RemovePoints, py::arg("indices"),
+            cls_doc.RemovePoints.doc)
+        .def("num_points", &Class::num_points, cls_doc.num_points.doc)
+        .def("points", &Class::points, py_rvp::reference_internal,
+            cls_doc.points.doc)
+        .def("adjacency", &Class::adjacency, cls_doc.adjacency.doc)
+        .def("num_edge_checks", &Class::num_edge_checks,
+            cls_doc.num_edge_checks.doc)
+        .def("max_edge_distance", &Class::max_edge_distance,
+            cls_doc.max_edge_distance.doc);
+  }
 }
 
 }  // namespace internal
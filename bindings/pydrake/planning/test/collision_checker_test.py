@@ -589,3 +589,37 @@ class TestCollisionChecker(unittest.TestCase):
         )
         self.assertEqual(A.shape, (num_points, num_points))
         self.assertIsInstance(A, scipy.sparse.csc_matrix)
+
+    def test_incremental_visibility_graph(self):
+        checker = self._make_scene_graph_collision_checker(True, False)
+        plant = checker.model().plant()
+        num_points = 2
+        points = np.empty((plant.num_positions(), num_points))
+        points[:, 0] = plant.GetPositions(checker.plant_context())
+        points[:, 1] = points[:, 0]
+        points[-1, 1] += 0.1
+
+        dut = mut.IncrementalVisibilityGraph(checker=checker)
+        self.assertEqual(dut.max_edge_distance(), np.inf)
+        self.assertEqual(dut.AddPoints(points=points, parallelize=True), 0)
+        self.assertEqual(
+            dut.AddCollisionFreePoints(points=points[:, :1], parallelize=True),
+            num_points,
+        )
+        self.assertEqual(dut.num_points(), num_points + 1)
+        self.assertIsInstance(dut.num_edge_checks(), int)
+        dut.RemovePoints(indices=[num_points])
+        numpy_compare.assert_equal(dut.points(), points)
+        A = dut.adjacency()
+        self.assertEqual(A.shape, (num_points, num_points))
+        self.assertIsInstance(A, scipy.sparse.csc_matrix)
+
+        resumed = mut.IncrementalVisibilityGraph(
+            checker=checker,
+            points=points,
+            adjacency=A,
+            max_edge_distance=1.0,
+        )
+        self.assertEqual(resumed.num_points(), num_points)
+        self.assertEqual(resumed.max_edge_distance(), 1.0)
+        self.assertEqual(resumed.num_edge_checks(), 0)
@@ -5,6 +5,7 @@ import unittest
 import numpy as np
 import scipy.sparse as sp
 
+from pydrake.common import Parallelism
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.solvers import (
     CommonSolverOption,
@@ -108,6 +109,29 @@ class TestGraphAlgorithms(unittest.TestCase):
         # Butteryfly graph has a max clique of 3.
         self.assertEqual(max_clique.sum(), 3)
 
+    def test_max_clique_solver_via_branch_and_bound_methods(self):
+        graph = self._butteryfly_graph()
+
+        # Test the default constructor.
+        solver = mut.MaxCliqueSolverViaBranchAndBound()
+        self.assertEqual(solver.GetTimeLimit(), np.inf)
+
+        # Test the constructor with arguments, and the setters and getters.
+        solver = mut.MaxCliqueSolverViaBranchAndBound(
+            parallelism=Parallelism(2), time_limit=10.0
+        )
+        self.assertEqual(solver.GetParallelism().num_threads(), 2)
+        self.assertEqual(solver.GetTimeLimit(), 10.0)
+        solver.SetParallelism(parallelism=Parallelism(1))
+        self.assertEqual(solver.GetParallelism().num_threads(), 1)
+        solver.SetTimeLimit(time_limit=20.0)
+        self.assertEqual(solver.GetTimeLimit(), 20.0)
+
+        # Test solve max clique.
+        max_clique = solver.SolveMaxClique(graph)
+        # Butteryfly graph has a max clique of 3.
+        self.assertEqual(max_clique.sum(), 3)
+
     def test_min_clique_cover_solver_base_subclassable(self):
         class DummyMinCliqueCoverSolver(mut.MinCliqueCoverSolverBase):
             def __init__(self, name):
@@ -97,6 +97,8 @@ class TestIrisZo(unittest.TestCase):
         checker = SceneGraphCollisionChecker(**params)
         options = mut.IrisZoOptions()
         options.bisection_steps = 10
+        self.assertFalse(options.use_sphere_prefilter)
+        options.use_sphere_prefilter = True
         options.sampled_iris_options.prog_with_additional_constraints = (
             InverseKinematics(plant).prog()
         )
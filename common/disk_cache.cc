@@ -0,0 +1,80 @@
+#include "drake/common/disk_cache.h"
+
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include "drake/common/find_cache.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace internal {
+
+namespace fs = std::filesystem;
+
+DiskCache::DiskCache(std::string_view subdir) {
+  PathOrError result = FindOrCreateCache(subdir);
+  if (!result.error.empty()) {
+    log()->debug("DiskCache is unavailable: {}", result.error);
+    return;
+  }
+  dir_ = std::move(result.abspath);
+}
+
+std::optional<std::string> DiskCache::Load(const Sha256& key) const {
+  if (!is_available()) {
+    return std::nullopt;
+  }
+  const fs::path path = dir_ / key.to_string();
+  std::ifstream input(path, std::ios::binary);
+  if (!input) {
+    return std::nullopt;
+  }
+  std::ostringstream contents;
+  contents << input.rdbuf();
+  if (input.bad()) {
+    log()->debug("DiskCache could not read {}", path.string());
+    return std::nullopt;
+  }
+  return std::move(contents).str();
+}
+
+void DiskCache::Store(const Sha256& key, std::string_view contents) const {
+  if (!is_available()) {
+    return;
+  }
+  // Write to a name that is unique to this thread of this process and then
+  // atomically rename it into place, so that readers never see a partial file.
+  const std::string name = key.to_string();
+  const fs::path path = dir_ / name;
+  const size_t thread_id =
+      std::hash<std::thread::id>{}(std::this_thread::get_id());
+  const fs::path temp_path =
+      dir_ / fmt::format("{}.{}.{}.tmp", name, ::getpid(), thread_id);
+  std::ofstream output(temp_path, std::ios::binary | std::ios::trunc);
+  output.write(contents.data(), contents.size());
+  // Close (and thus flush) the file before checking for errors, so that a
+  // failure to write out the tail of the contents isn't missed.
+  output.close();
+  std::error_code ec;
+  if (!output) {
+    log()->debug("DiskCache could not write {}", temp_path.string());
+    fs::remove(temp_path, ec);
+    return;
+  }
+  fs::rename(temp_path, path, ec);
+  if (ec) {
+    log()->debug("DiskCache could not create {}: {}", path.string(),
+                 ec.message());
+    fs::remove(temp_path, ec);
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/sha256.h"
+
+namespace drake {
+namespace internal {
+
+/* A persistent, content-addressed store of byte strings, shared by all of the
+current user's processes. Each entry is a file named by its key in the
+platform-appropriate ~/.cache/drake/{subdir} (see FindOrCreateCache()).
+
+The cache is strictly best-effort: failing to locate the cache directory or to
+read or write an entry is logged (at debug level) and otherwise treated as a
+miss. Entries are written to a temporary file and then renamed into place, so
+multiple processes may safely share one cache directory.
+
+Callers are responsible for choosing keys that capture everything their stored
+results depend on (typically, the checksum of a description of the inputs and
+of the serialization format). */
+class DiskCache {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DiskCache);
+
+  /* Opens (creating if necessary) the cache in the given subdirectory. */
+  explicit DiskCache(std::string_view subdir);
+
+  /* Reports whether the cache directory could be found or created. When false,
+  every Load() misses and every Store() is a no-op. */
+  bool is_available() const { return !dir_.empty(); }
+
+  /* Returns the absolute path of the cache directory, or the empty path when
+  the cache is not available. */
+  const std::filesystem::path& dir() const { return dir_; }
+
+  /* Returns the contents stored under `key`, or nullopt if there are none. */
+  std::optional<std::string> Load(const Sha256& key) const;
+
+  /* Stores `contents` under `key`, replacing any prior contents. */
+  void Store(const Sha256& key, std::string_view contents) const;
+
+ private:
+  std::filesystem::path dir_;
+};
+
+}  // namespace internal
+}  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/common/symbolic/codegen.h"
 
+#include <cstdlib>
 #include <sstream>
 #include <stdexcept>
 
@@ -15,6 +16,27 @@ using std::string;
 using std::to_string;
 using std::vector;
 
+namespace {
+
+// Returns `short_form`, the conventional formatting of `value`, unless it
+// does not round-trip to `value`. In that case, returns the shortest
+// formatting that does, so that generated code does not lose precision.
+string FormatDouble(double value, const string& short_form) {
+  if (std::strtod(short_form.c_str(), nullptr) == value) {
+    return short_form;
+  }
+  return fmt::format("{}", value);
+}
+
+// Formats `value` as `std::ostream` would, but without losing precision.
+string FormatCoefficient(double value) {
+  ostringstream oss;
+  oss << value;
+  return FormatDouble(value, oss.str());
+}
+
+}  // namespace
+
 CodeGenVisitor::CodeGenVisitor(const vector<Variable>& parameters) {
   for (vector<Variable>::size_type i = 0; i < parameters.size(); ++i) {
     id_to_idx_map_.emplace(parameters[i].get_id(), i);
@@ -35,14 +57,15 @@ string CodeGenVisitor::VisitVariable(const Expression& e) const {
 }
 
 string CodeGenVisitor::VisitConstant(const Expression& e) const {
-  return to_string(get_constant_value(e));
+  const double value{get_constant_value(e)};
+  return FormatDouble(value, to_string(value));
 }
 
 string CodeGenVisitor::VisitAddition(const Expression& e) const {
   const double c{get_constant_in_addition(e)};
   const auto& expr_to_coeff_map{get_expr_to_coeff_map_in_addition(e)};
   ostringstream oss;
-  oss << "(" << c;
+  oss << "(" << FormatCoefficient(c);
   for (const auto& item : expr_to_coeff_map) {
     const Expression& e_i{item.first};
     const double c_i{item.second};
@@ -50,7 +73,7 @@ string CodeGenVisitor::VisitAddition(const Expression& e) const {
     if (c_i == 1.0) {
       oss << CodeGen(e_i);
     } else {
-      oss << "(" << c_i << " * " << CodeGen(e_i) << ")";
+      oss << "(" << FormatCoefficient(c_i) << " * " << CodeGen(e_i) << ")";
     }
   }
   oss << ")";
@@ -62,7 +85,7 @@ string CodeGenVisitor::VisitMultiplication(const Expression& e) const {
   const auto& base_to_exponent_map{
       get_base_to_exponent_map_in_multiplication(e)};
   ostringstream oss;
-  oss << "(" << c;
+  oss << "(" << FormatCoefficient(c);
   for (const auto& item : base_to_exponent_map) {
     const Expression& e_1{item.first};
     const Expression& e_2{item.second};
@@ -1,6 +1,7 @@
 #include "drake/common/symbolic/codegen.h"
 
 #include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -80,6 +81,12 @@ TEST_F(SymbolicCodeGenTest, Variable) {
 TEST_F(SymbolicCodeGenTest, Constant) {
   EXPECT_EQ(CodeGen("f", {}, 3.141592),
             MakeScalarFunctionCode("f", 0, "3.141592"));
+  // Constants that would lose precision in the short form are written out in
+  // full.
+  EXPECT_EQ(CodeGen("f", {}, M_PI),
+            MakeScalarFunctionCode("f", 0, "3.141592653589793"));
+  EXPECT_EQ(CodeGen("f", {x_}, 1e-9 + 0.123456789 * x_),
+            MakeScalarFunctionCode("f", 1, "(1e-09 + (0.123456789 * p[0]))"));
 }
 
 TEST_F(SymbolicCodeGenTest, Addition) {
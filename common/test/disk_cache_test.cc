@@ -0,0 +1,69 @@
+#include "drake/common/disk_cache.h"
+
+#include <filesystem>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/set_env.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+using test::SetEnv;
+
+namespace fs = std::filesystem;
+
+GTEST_TEST(DiskCacheTest, StoreAndLoad) {
+  const DiskCache dut("disk_cache_test");
+  ASSERT_TRUE(dut.is_available());
+  EXPECT_TRUE(fs::is_directory(dut.dir()));
+
+  const Sha256 key = Sha256::Checksum("key");
+  EXPECT_EQ(dut.Load(key), std::nullopt);
+
+  // Binary contents round trip, including embedded nulls.
+  const std::string contents("abc\0def", 7);
+  dut.Store(key, contents);
+  EXPECT_EQ(dut.Load(key), contents);
+
+  // A second instance on the same subdirectory sees the same entries.
+  const DiskCache other("disk_cache_test");
+  EXPECT_EQ(other.Load(key), contents);
+
+  // Storing again replaces the contents.
+  dut.Store(key, "replaced");
+  EXPECT_EQ(dut.Load(key), "replaced");
+
+  // No temporary files are left behind.
+  int num_files = 0;
+  for (const auto& entry : fs::directory_iterator(dut.dir())) {
+    EXPECT_EQ(entry.path().filename(), key.to_string());
+    ++num_files;
+  }
+  EXPECT_EQ(num_files, 1);
+
+  // Other keys miss.
+  EXPECT_EQ(dut.Load(Sha256::Checksum("other")), std::nullopt);
+}
+
+// When the cache directory can't be created, the cache quietly does nothing.
+GTEST_TEST(DiskCacheTest, Unavailable) {
+  const std::string xdg = temp_directory();
+  const SetEnv env1("TEST_TMPDIR", std::nullopt);
+  const SetEnv env2("XDG_CACHE_HOME", xdg);
+  fs::permissions(xdg, fs::perms{});
+
+  const DiskCache dut("unavailable");
+  EXPECT_FALSE(dut.is_available());
+  EXPECT_EQ(dut.dir(), fs::path{});
+  const Sha256 key = Sha256::Checksum("key");
+  dut.Store(key, "contents");
+  EXPECT_EQ(dut.Load(key), std::nullopt);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
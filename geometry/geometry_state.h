@@ -13,6 +13,7 @@
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/collision_filter_manager.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -616,6 +617,18 @@ class GeometryState {
   /** Implementation of QueryObject::HasCollisions().  */
   bool HasCollisions() const { return geometry_engine_->HasCollisions(); }
 
+  /** Sets the parallelism used by the contact queries to build any deferred
+   compliant hydroelastic representations they need; see
+   SceneGraphConfig::hydroelastic_build_threads.  */
+  void set_hydroelastic_build_parallelism(Parallelism parallelism) {
+    geometry_engine_->set_hydroelastic_build_parallelism(parallelism);
+  }
+
+  /** Returns the parallelism set by set_hydroelastic_build_parallelism().  */
+  Parallelism hydroelastic_build_parallelism() const {
+    return geometry_engine_->hydroelastic_build_parallelism();
+  }
+
   //@}
 
   /** @name        Collision filtering    */
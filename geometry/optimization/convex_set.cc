@@ -252,37 +252,42 @@ ConvexSet::Projection(const Eigen::Ref<const Eigen::MatrixXd>& points) const {
 std::optional<std::pair<std::vector<double>, Eigen::MatrixXd>>
 ConvexSet::GenericDoProjection(
     const Eigen::Ref<const Eigen::MatrixXd>& points) const {
+  const int n = ambient_dimension();
+  // Build the program min |x - p|² s.t. x ∈ S once; only the cost depends on
+  // the point p. The quadratic error cost is xᵀx - 2pᵀx + pᵀp.
   MathematicalProgram prog;
-  MatrixX<symbolic::Variable> projected_points_vars(points.rows(),
-                                                    points.cols());
-  std::vector<solvers::Binding<solvers::Cost>> distances_bindings;
-  for (int i = 0; i < points.cols(); ++i) {
-    projected_points_vars.col(i) =
-        prog.NewContinuousVariables(ambient_dimension(), fmt::format("x{}", i));
-    AddPointInSetConstraints(&prog, projected_points_vars.col(i));
-    distances_bindings.emplace_back(prog.AddQuadraticErrorCost(
-        Eigen::MatrixXd::Identity(ambient_dimension(), ambient_dimension()),
-        points.col(i), projected_points_vars.col(i)));
-  }
-  const auto result = solvers::Solve(prog);
-  if (!result.is_success()) {
-    if (result.get_solution_result() !=
-            solvers::SolutionResult::kInfeasibleConstraints &&
-        result.get_solution_result() !=
-            solvers::SolutionResult::kInfeasibleOrUnbounded) {
-      log()->warn(
-          "ConvexSet Projection failed with result {} which indicates "
-          "numerical difficulties. Projections should always be feasible if "
-          "the set is non-empty, and infeasible otherwise.",
-          result.get_solution_result());
-    }
-    return std::nullopt;
-  }
-  const Eigen::MatrixXd projected_points =
-      result.GetSolution(projected_points_vars);
+  const VectorXDecisionVariable x = prog.NewContinuousVariables(n, "x");
+  AddPointInSetConstraints(&prog, x);
+  const solvers::Binding<solvers::QuadraticCost> distance_binding =
+      prog.AddQuadraticErrorCost(Eigen::MatrixXd::Identity(n, n),
+                                 VectorXd::Zero(n), x);
+  const Eigen::MatrixXd Q = 2 * Eigen::MatrixXd::Identity(n, n);
+  const std::unique_ptr<solvers::SolverInterface> solver =
+      solvers::MakeSolver(solvers::ChooseBestSolver(prog));
+
+  Eigen::MatrixXd projected_points(n, points.cols());
   std::vector<double> distances(points.cols(), 0.0);
+  MathematicalProgramResult result;
   for (int i = 0; i < points.cols(); ++i) {
-    const double binding_cost = result.EvalBinding(distances_bindings[i])[0];
+    distance_binding.evaluator()->UpdateCoefficients(
+        Q, -2 * points.col(i), points.col(i).squaredNorm(),
+        /* is_hessian_psd = */ true);
+    solver->Solve(prog, std::nullopt, std::nullopt, &result);
+    if (!result.is_success()) {
+      if (result.get_solution_result() !=
+              solvers::SolutionResult::kInfeasibleConstraints &&
+          result.get_solution_result() !=
+              solvers::SolutionResult::kInfeasibleOrUnbounded) {
+        log()->warn(
+            "ConvexSet Projection failed with result {} which indicates "
+            "numerical difficulties. Projections should always be feasible if "
+            "the set is non-empty, and infeasible otherwise.",
+            result.get_solution_result());
+      }
+      return std::nullopt;
+    }
+    projected_points.col(i) = result.GetSolution(x);
+    const double binding_cost = result.EvalBinding(distance_binding)[0];
     // The distance is lower bounded by 0, but numerical sensitivity may place
     // us slightly negative.
     distances[i] = sqrt(std::max(0.0, binding_cost));
@@ -319,6 +324,15 @@ std::vector<std::optional<double>> ConvexSet::DoProjectionShortcut(
   return distances;
 }
 
+std::vector<bool> ConvexSet::DoPointsInSet(
+    const Eigen::Ref<const Eigen::MatrixXd>& points, double tol) const {
+  std::vector<bool> result(points.cols());
+  for (int i = 0; i < points.cols(); ++i) {
+    result[i] = PointInSet(points.col(i), tol);
+  }
+  return result;
+}
+
 bool ConvexSet::DoIsEmpty() const {
   if (ambient_dimension() == 0) {
     return false;
@@ -179,6 +179,20 @@ class ConvexSet {
     return DoPointInSet(x, tol);
   }
 
+  /** Batched version of PointInSet(). Returns a vector whose i'th entry is
+  true iff `points.col(i)` is contained in the set. Derived classes with a
+  closed-form membership test check all the columns together, which is much
+  faster than calling PointInSet() on each column.
+  @pre points.rows() == ambient_dimension() */
+  std::vector<bool> PointsInSet(const Eigen::Ref<const Eigen::MatrixXd>& points,
+                                double tol = 0) const {
+    DRAKE_THROW_UNLESS(points.rows() == ambient_dimension());
+    if (ambient_dimension() == 0) {
+      return std::vector<bool>(points.cols(), !IsEmpty());
+    }
+    return DoPointsInSet(points, tol);
+  }
+
   /** Adds a constraint to an existing MathematicalProgram enforcing that the
   point defined by vars is inside the set.
   @return (new_vars, new_constraints) Some of the derived class will add new
@@ -393,6 +407,13 @@ class ConvexSet {
   virtual bool DoPointInSet(const Eigen::Ref<const Eigen::VectorXd>& x,
                             double tol) const;
 
+  /** Non-virtual interface implementation for PointsInSet(). The default
+  implementation calls PointInSet() on each column of `points`.
+  @pre points.rows() == ambient_dimension()
+  @pre ambient_dimension() > 0 */
+  virtual std::vector<bool> DoPointsInSet(
+      const Eigen::Ref<const Eigen::MatrixXd>& points, double tol) const;
+
   /** A non-virtual interface implementation for PointInSet() that should be
    used when the PointInSet() can be computed more efficiently than solving a
    convex program.
@@ -502,6 +523,8 @@ class ConvexSet {
                            double tol) const;
 
   /** Generic implementation for Projection() -- applicable for all convex sets.
+   The projection program is built once, and re-solved for each column of
+   `points` by only updating its cost.
    @pre ambient_dimension() >= 0
    */
   std::optional<std::pair<std::vector<double>, Eigen::MatrixXd>>
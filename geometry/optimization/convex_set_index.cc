@@ -0,0 +1,411 @@
+#include "drake/geometry/optimization/convex_set_index.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+#include <common_robotics_utilities/parallelism.hpp>
+#include <fmt/format.h>
+
+#include "drake/geometry/optimization/hyperrectangle.h"
+#include "drake/geometry/optimization/point.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace geometry {
+namespace optimization {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+namespace {
+// The maximal number of sets in a leaf of the hierarchy.
+constexpr int kMaxLeafSize = 4;
+
+// Returns the bounding box of `set`, or nullopt if it is unbounded (or the
+// box cannot be computed).
+std::optional<std::pair<VectorXd, VectorXd>> CalcBoundingBox(
+    const ConvexSet& set) {
+  if (const auto* box = dynamic_cast<const Hyperrectangle*>(&set)) {
+    return std::make_pair(box->lb(), box->ub());
+  }
+  if (const auto* point = dynamic_cast<const Point*>(&set)) {
+    return std::make_pair(point->x(), point->x());
+  }
+  const std::optional<Hyperrectangle> box =
+      Hyperrectangle::MaybeCalcAxisAlignedBoundingBox(set);
+  if (!box.has_value()) {
+    return std::nullopt;
+  }
+  // Pad the box, so that the solver tolerance can't cut off the boundary of
+  // the set.
+  const double kPadding = 1e-6;
+  return std::make_pair(VectorXd(box->lb().array() - kPadding),
+                        VectorXd(box->ub().array() + kPadding));
+}
+
+// Returns true if the convex programs that query `set` (e.g., to compute its
+// bounding box, or whether it intersects another set) are safe to solve on
+// concurrent threads. As with MathematicalProgram::IsThreadSafe(), this is the
+// case when the constraints that describe the set are thread safe.
+bool IsThreadSafe(const ConvexSet& set) {
+  if (dynamic_cast<const Hyperrectangle*>(&set) != nullptr ||
+      dynamic_cast<const Point*>(&set) != nullptr ||
+      set.ambient_dimension() == 0) {
+    return true;
+  }
+  solvers::MathematicalProgram prog;
+  const solvers::VectorXDecisionVariable x =
+      prog.NewContinuousVariables(set.ambient_dimension());
+  set.AddPointInSetConstraints(&prog, x);
+  return prog.IsThreadSafe();
+}
+
+// Returns true if the boxes [lb1, ub1] and [lb2, ub2] overlap, after
+// inflating the first box by tol.
+template <typename Derived1, typename Derived2, typename Derived3,
+          typename Derived4>
+bool BoxesOverlap(const Eigen::MatrixBase<Derived1>& lb1,
+                  const Eigen::MatrixBase<Derived2>& ub1,
+                  const Eigen::MatrixBase<Derived3>& lb2,
+                  const Eigen::MatrixBase<Derived4>& ub2, double tol) {
+  return (lb1.array() - tol <= ub2.array()).all() &&
+         (lb2.array() <= ub1.array() + tol).all();
+}
+
+// Returns the squared distance from x to the box [lb, ub].
+template <typename Derived1, typename Derived2>
+double SquaredDistanceToBox(const Eigen::Ref<const VectorXd>& x,
+                            const Eigen::MatrixBase<Derived1>& lb,
+                            const Eigen::MatrixBase<Derived2>& ub) {
+  return (lb - x).cwiseMax(x - ub).cwiseMax(0).squaredNorm();
+}
+}  // namespace
+
+ConvexSetIndex::ConvexSetIndex() = default;
+
+ConvexSetIndex::ConvexSetIndex(ConvexSets sets, Parallelism parallelism)
+    : sets_(std::move(sets)) {
+  const int num_sets = static_cast<int>(sets_.size());
+  if (num_sets == 0) {
+    return;
+  }
+  for (const auto& set : sets_) {
+    DRAKE_THROW_UNLESS(set != nullptr);
+  }
+  ambient_dimension_ = sets_[0]->ambient_dimension();
+  for (int i = 1; i < num_sets; ++i) {
+    if (sets_[i]->ambient_dimension() != ambient_dimension_) {
+      throw std::runtime_error(fmt::format(
+          "ConvexSetIndex: set {} has ambient dimension {}, but set 0 has "
+          "ambient dimension {}.",
+          i, sets_[i]->ambient_dimension(), ambient_dimension_));
+    }
+  }
+
+  // Compute the bounding boxes.
+  const double kInf = std::numeric_limits<double>::infinity();
+  box_lb_ = MatrixXd::Constant(ambient_dimension_, num_sets, -kInf);
+  box_ub_ = MatrixXd::Constant(ambient_dimension_, num_sets, kInf);
+  std::vector<uint8_t> is_bounded(num_sets, 0);
+  const auto calc_box = [&](const int64_t i) {
+    const auto box = CalcBoundingBox(*sets_[i]);
+    if (box.has_value()) {
+      box_lb_.col(i) = box->first;
+      box_ub_.col(i) = box->second;
+      is_bounded[i] = 1;
+    }
+  };
+  // As in solvers::SolveInParallel(), the sets whose programs are not thread
+  // safe are skipped by the parallel loop and handled serially afterwards.
+  std::vector<uint8_t> is_done(num_sets, 0);
+  if (parallelism.num_threads() > 1) {
+    std::vector<uint8_t> thread_safe(num_sets);
+    for (int i = 0; i < num_sets; ++i) {
+      thread_safe[i] = IsThreadSafe(*sets_[i]);
+    }
+    const auto calc_box_parallel = [&](const int, const int64_t i) {
+      if (thread_safe[i]) {
+        calc_box(i);
+        is_done[i] = 1;
+      }
+    };
+    DynamicParallelForIndexLoop(DegreeOfParallelism(parallelism.num_threads()),
+                                0, num_sets, calc_box_parallel,
+                                ParallelForBackend::BEST_AVAILABLE);
+  }
+  for (int i = 0; i < num_sets; ++i) {
+    if (!is_done[i]) {
+      calc_box(i);
+    }
+  }
+  for (int i = 0; i < num_sets; ++i) {
+    if (is_bounded[i]) {
+      order_.push_back(i);
+    } else {
+      unbounded_.push_back(i);
+    }
+  }
+
+  // Build the hierarchy over the bounded sets.
+  if (!order_.empty()) {
+    const int max_num_nodes = 2 * static_cast<int>(order_.size()) - 1;
+    nodes_.reserve(max_num_nodes);
+    node_lb_.resize(ambient_dimension_, max_num_nodes);
+    node_ub_.resize(ambient_dimension_, max_num_nodes);
+    BuildNode(0, static_cast<int>(order_.size()));
+    node_lb_.conservativeResize(Eigen::NoChange, nodes_.size());
+    node_ub_.conservativeResize(Eigen::NoChange, nodes_.size());
+  }
+}
+
+ConvexSetIndex::~ConvexSetIndex() = default;
+
+int ConvexSetIndex::BuildNode(int begin, int end) {
+  const int node_index = static_cast<int>(nodes_.size());
+  nodes_.push_back(Node{begin, end});
+  VectorXd lb = box_lb_.col(order_[begin]);
+  VectorXd ub = box_ub_.col(order_[begin]);
+  for (int k = begin + 1; k < end; ++k) {
+    lb = lb.cwiseMin(box_lb_.col(order_[k]));
+    ub = ub.cwiseMax(box_ub_.col(order_[k]));
+  }
+  node_lb_.col(node_index) = lb;
+  node_ub_.col(node_index) = ub;
+  if (end - begin <= kMaxLeafSize) {
+    return node_index;
+  }
+
+  // Split at the median of the box centers along the axis in which the centers
+  // are the most spread out.
+  VectorXd center_min = VectorXd::Constant(
+      ambient_dimension_, std::numeric_limits<double>::infinity());
+  VectorXd center_max = -center_min;
+  for (int k = begin; k < end; ++k) {
+    const VectorXd center =
+        0.5 * (box_lb_.col(order_[k]) + box_ub_.col(order_[k]));
+    center_min = center_min.cwiseMin(center);
+    center_max = center_max.cwiseMax(center);
+  }
+  int axis{};
+  (center_max - center_min).maxCoeff(&axis);
+  const int mid = begin + (end - begin) / 2;
+  std::nth_element(order_.begin() + begin, order_.begin() + mid,
+                   order_.begin() + end, [this, axis](int i, int j) {
+                     return box_lb_(axis, i) + box_ub_(axis, i) <
+                            box_lb_(axis, j) + box_ub_(axis, j);
+                   });
+  const int left = BuildNode(begin, mid);
+  const int right = BuildNode(mid, end);
+  nodes_[node_index].left = left;
+  nodes_[node_index].right = right;
+  return node_index;
+}
+
+const ConvexSet& ConvexSetIndex::set(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_sets());
+  return *sets_[i];
+}
+
+VectorXd ConvexSetIndex::bounding_box_lb(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_sets());
+  return box_lb_.col(i);
+}
+
+VectorXd ConvexSetIndex::bounding_box_ub(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_sets());
+  return box_ub_.col(i);
+}
+
+template <typename Visitor>
+void ConvexSetIndex::VisitOverlapping(const Eigen::Ref<const VectorXd>& lb,
+                                      const Eigen::Ref<const VectorXd>& ub,
+                                      double tol, Visitor&& visit) const {
+  for (int i : unbounded_) {
+    visit(i);
+  }
+  if (nodes_.empty()) {
+    return;
+  }
+  std::vector<int> stack{0};
+  while (!stack.empty()) {
+    const int node_index = stack.back();
+    stack.pop_back();
+    if (!BoxesOverlap(lb, ub, node_lb_.col(node_index),
+                      node_ub_.col(node_index), tol)) {
+      continue;
+    }
+    const Node& node = nodes_[node_index];
+    if (node.left < 0) {
+      for (int k = node.begin; k < node.end; ++k) {
+        const int i = order_[k];
+        if (BoxesOverlap(lb, ub, box_lb_.col(i), box_ub_.col(i), tol)) {
+          visit(i);
+        }
+      }
+    } else {
+      stack.push_back(node.right);
+      stack.push_back(node.left);
+    }
+  }
+}
+
+std::vector<int> ConvexSetIndex::FindContainingSets(
+    const Eigen::Ref<const VectorXd>& x, double tol) const {
+  DRAKE_THROW_UNLESS(x.size() == ambient_dimension());
+  std::vector<int> result;
+  VisitOverlapping(x, x, tol, [&](int i) {
+    if (sets_[i]->PointInSet(x, tol)) {
+      result.push_back(i);
+    }
+  });
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+std::vector<int> ConvexSetIndex::FindIntersectionCandidates(
+    const Eigen::Ref<const VectorXd>& lb,
+    const Eigen::Ref<const VectorXd>& ub) const {
+  DRAKE_THROW_UNLESS(lb.size() == ambient_dimension());
+  DRAKE_THROW_UNLESS(ub.size() == ambient_dimension());
+  std::vector<int> result;
+  VisitOverlapping(lb, ub, 0.0, [&](int i) {
+    result.push_back(i);
+  });
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+std::vector<std::pair<int, int>>
+ConvexSetIndex::FindIntersectionCandidatePairs() const {
+  std::vector<std::pair<int, int>> result;
+  for (int i = 0; i < num_sets(); ++i) {
+    VisitOverlapping(box_lb_.col(i), box_ub_.col(i), 0.0, [&](int j) {
+      if (i < j) {
+        result.emplace_back(i, j);
+      }
+    });
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+std::vector<std::pair<int, int>> ConvexSetIndex::FindIntersectingPairs(
+    Parallelism parallelism) const {
+  const std::vector<std::pair<int, int>> candidates =
+      FindIntersectionCandidatePairs();
+  std::vector<uint8_t> intersects(candidates.size(), 0);
+  const auto check_pair = [&](const int64_t k) {
+    const auto& [i, j] = candidates[k];
+    intersects[k] = sets_[i]->IntersectsWith(*sets_[j]);
+  };
+  // As in the constructor, the pairs whose programs are not thread safe are
+  // checked serially after the parallel loop.
+  std::vector<uint8_t> is_done(candidates.size(), 0);
+  if (parallelism.num_threads() > 1 && !candidates.empty()) {
+    std::vector<uint8_t> thread_safe(num_sets());
+    for (int i = 0; i < num_sets(); ++i) {
+      thread_safe[i] = IsThreadSafe(*sets_[i]);
+    }
+    const auto check_pair_parallel = [&](const int, const int64_t k) {
+      const auto& [i, j] = candidates[k];
+      if (thread_safe[i] && thread_safe[j]) {
+        check_pair(k);
+        is_done[k] = 1;
+      }
+    };
+    DynamicParallelForIndexLoop(DegreeOfParallelism(parallelism.num_threads()),
+                                0, ssize(candidates), check_pair_parallel,
+                                ParallelForBackend::BEST_AVAILABLE);
+  }
+  for (int k = 0; k < ssize(candidates); ++k) {
+    if (!is_done[k]) {
+      check_pair(k);
+    }
+  }
+  std::vector<std::pair<int, int>> result;
+  for (int k = 0; k < ssize(candidates); ++k) {
+    if (intersects[k]) {
+      result.push_back(candidates[k]);
+    }
+  }
+  return result;
+}
+
+std::optional<std::pair<int, double>> ConvexSetIndex::FindNearestSet(
+    const Eigen::Ref<const VectorXd>& x) const {
+  DRAKE_THROW_UNLESS(x.size() == ambient_dimension());
+  std::optional<std::pair<int, double>> nearest;
+  // Updates `nearest` with set i, and returns true iff x is in set i (so that
+  // no set can be nearer).
+  const auto check_set = [&](int i) {
+    if (sets_[i]->PointInSet(x)) {
+      nearest = std::make_pair(i, 0.0);
+      return true;
+    }
+    const auto projection = sets_[i]->Projection(x);
+    if (projection.has_value()) {
+      const double distance = projection->first[0];
+      if (!nearest.has_value() || distance < nearest->second) {
+        nearest = std::make_pair(i, distance);
+      }
+    }
+    return false;
+  };
+
+  // The unbounded sets are visited first, since the distance to their boxes is
+  // zero.
+  for (int i : unbounded_) {
+    if (check_set(i)) {
+      return nearest;
+    }
+  }
+  if (nodes_.empty()) {
+    return nearest;
+  }
+
+  // Visit the nodes in the order of their squared distance from x, where a
+  // negative node index -(i + 1) stands for set i.
+  using Entry = std::pair<double, int>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  queue.emplace(SquaredDistanceToBox(x, node_lb_.col(0), node_ub_.col(0)), 0);
+  while (!queue.empty()) {
+    const auto [squared_distance, index] = queue.top();
+    queue.pop();
+    if (nearest.has_value() &&
+        squared_distance >= nearest->second * nearest->second) {
+      break;
+    }
+    if (index < 0) {
+      if (check_set(-index - 1)) {
+        return nearest;
+      }
+      continue;
+    }
+    const Node& node = nodes_[index];
+    if (node.left < 0) {
+      for (int k = node.begin; k < node.end; ++k) {
+        const int i = order_[k];
+        queue.emplace(SquaredDistanceToBox(x, box_lb_.col(i), box_ub_.col(i)),
+                      -(i + 1));
+      }
+    } else {
+      for (int child : {node.left, node.right}) {
+        queue.emplace(
+            SquaredDistanceToBox(x, node_lb_.col(child), node_ub_.col(child)),
+            child);
+      }
+    }
+  }
+  return nearest;
+}
+
+}  // namespace optimization
+}  // namespace geometry
+}  // namespace drake
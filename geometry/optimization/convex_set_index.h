@@ -0,0 +1,153 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/geometry/optimization/convex_set.h"
+
+namespace drake {
+namespace geometry {
+namespace optimization {
+
+/** A spatial index over a collection of convex sets in the same ambient space,
+for answering region lookup queries in time logarithmic in the number of sets
+(plus the number of reported sets), instead of testing every set.
+
+Each set is bounded by its minimum axis-aligned bounding box (padded by 1e-6
+when it is computed by convex programs), and the boxes are organized in a
+bounding volume hierarchy (BVH). A query first traverses the BVH to find the
+sets whose boxes can answer the query, and then refines those candidates with
+the exact (and more expensive) ConvexSet query, such as PointInSet(),
+IntersectsWith() or Projection(). Unbounded sets have no finite box; they are
+kept out of the hierarchy and are always candidates.
+
+A typical use is looking up which of the many regions produced by
+IrisInConfigurationSpaceFromCliqueCover() contain a configuration, or which
+pairs of regions overlap when connecting them in a graph of convex sets.
+
+@ingroup geometry_optimization */
+class ConvexSetIndex {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ConvexSetIndex);
+
+  /** Constructs an empty index. */
+  ConvexSetIndex();
+
+  /** Constructs the index of `sets`. The sets are indexed in the order given,
+  i.e., the query results refer to the sets by their position in `sets`.
+  Computing the bounding box of a set takes (up to) 2 * ambient_dimension()
+  convex programs, except for Hyperrectangle and Point; `parallelism` sets the
+  number of threads used to compute the bounding boxes. As in
+  solvers::SolveInParallel(), the boxes of the sets whose constraints are not
+  thread safe are computed serially.
+  @pre No entry of `sets` is null.
+  @throws std::exception if the sets do not all have the same ambient
+  dimension. */
+  explicit ConvexSetIndex(ConvexSets sets,
+                          Parallelism parallelism = Parallelism::None());
+
+  ~ConvexSetIndex();
+
+  /** Returns the number of indexed sets. */
+  int num_sets() const { return static_cast<int>(sets_.size()); }
+
+  /** Returns the ambient dimension of the indexed sets (zero if the index is
+  empty). */
+  int ambient_dimension() const { return ambient_dimension_; }
+
+  /** Returns the indexed set `i`.
+  @throws std::exception if `i` is not in [0, num_sets()). */
+  const ConvexSet& set(int i) const;
+
+  /** Returns the lower corner of the bounding box of set `i`. Its entries are
+  -∞ if the set is unbounded.
+  @throws std::exception if `i` is not in [0, num_sets()). */
+  Eigen::VectorXd bounding_box_lb(int i) const;
+
+  /** Returns the upper corner of the bounding box of set `i`. Its entries are
+  +∞ if the set is unbounded.
+  @throws std::exception if `i` is not in [0, num_sets()). */
+  Eigen::VectorXd bounding_box_ub(int i) const;
+
+  /** Returns the indices (in increasing order) of the sets that contain `x`,
+  as decided by ConvexSet::PointInSet(x, tol). Only the sets whose bounding
+  boxes, inflated by `tol` in every direction, contain `x` are checked.
+  @throws std::exception if x.size() != ambient_dimension(). */
+  std::vector<int> FindContainingSets(
+      const Eigen::Ref<const Eigen::VectorXd>& x, double tol = 0) const;
+
+  /** Returns the indices (in increasing order) of the sets whose bounding
+  boxes overlap the box [lb, ub]. This is a superset of the sets which
+  intersect the box.
+  @throws std::exception if lb.size() or ub.size() is not
+  ambient_dimension(). */
+  std::vector<int> FindIntersectionCandidates(
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub) const;
+
+  /** Returns the pairs (i, j) with i < j, sorted lexicographically, of the
+  sets whose bounding boxes overlap. This is a superset of the pairs of sets
+  which intersect. */
+  std::vector<std::pair<int, int>> FindIntersectionCandidatePairs() const;
+
+  /** Returns the pairs (i, j) with i < j, sorted lexicographically, of the
+  sets that intersect, as decided by ConvexSet::IntersectsWith(). Only the
+  pairs returned by FindIntersectionCandidatePairs() are checked exactly;
+  `parallelism` sets the number of threads used to check them. The pairs with a
+  set whose constraints are not thread safe are checked serially. */
+  std::vector<std::pair<int, int>> FindIntersectingPairs(
+      Parallelism parallelism = Parallelism::None()) const;
+
+  /** Returns the index of the set nearest to `x` (in the L₂ norm), together
+  with the distance from `x` to that set. The sets are visited in the order of
+  the distance from `x` to their bounding boxes, and the search stops once no
+  remaining box is nearer than the nearest set found so far, so that most sets
+  are never projected onto. Empty sets are ignored. Returns std::nullopt if
+  there is no nonempty set.
+  @throws std::exception if x.size() != ambient_dimension(). */
+  std::optional<std::pair<int, double>> FindNearestSet(
+      const Eigen::Ref<const Eigen::VectorXd>& x) const;
+
+ private:
+  struct Node {
+    // The node covers the sets order_[begin], ..., order_[end - 1].
+    int begin{};
+    int end{};
+    // The children of an internal node; both are -1 for a leaf.
+    int left{-1};
+    int right{-1};
+  };
+
+  // Builds the subtree over order_[begin, end), and returns its node index.
+  int BuildNode(int begin, int end);
+
+  // Calls `visit(i)` for every set i whose bounding box intersects the box
+  // [lb, ub] inflated by tol, including the unbounded sets.
+  template <typename Visitor>
+  void VisitOverlapping(const Eigen::Ref<const Eigen::VectorXd>& lb,
+                        const Eigen::Ref<const Eigen::VectorXd>& ub, double tol,
+                        Visitor&& visit) const;
+
+  int ambient_dimension_{0};
+  ConvexSets sets_;
+  // Column i stores the bounding box of set i.
+  Eigen::MatrixXd box_lb_;
+  Eigen::MatrixXd box_ub_;
+  // The indices of the unbounded sets, which are not in the hierarchy.
+  std::vector<int> unbounded_;
+  // The bounded sets, permuted so that every node covers a contiguous range.
+  std::vector<int> order_;
+  // The nodes of the hierarchy; nodes_[0] is the root (if any). Column k of
+  // node_lb_ and node_ub_ stores the bounding box of nodes_[k].
+  std::vector<Node> nodes_;
+  Eigen::MatrixXd node_lb_;
+  Eigen::MatrixXd node_ub_;
+};
+
+}  // namespace optimization
+}  // namespace geometry
+}  // namespace drake
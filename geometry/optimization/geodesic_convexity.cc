@@ -1,5 +1,6 @@
 #include "drake/geometry/optimization/geodesic_convexity.h"
 
+#include <numeric>
 #include <optional>
 #include <unordered_set>
 #include <utility>
@@ -7,6 +8,7 @@
 
 #include <common_robotics_utilities/parallelism.hpp>
 
+#include "drake/geometry/optimization/convex_set_index.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
 #include "drake/geometry/optimization/hyperrectangle.h"
 #include "drake/geometry/optimization/intersection.h"
@@ -247,6 +249,7 @@ ConvexSets PartitionConvexSet(
 namespace {
 
 using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
 using common_robotics_utilities::parallelism::ParallelForBackend;
 using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 
@@ -395,6 +398,38 @@ ComputePairwiseIntersections(const ConvexSets& convex_sets_A,
     }
   }
 
+  const std::vector<Hyperrectangle>& bboxes_B_or_A =
+      convex_sets_A_and_B_are_identical ? bboxes_A : bboxes_B;
+
+  // No offset is applied along the dimensions which are not continuous
+  // revolute joints, so two sets can only intersect if their bounding boxes
+  // overlap along all of those dimensions. We index the boxes of convex_sets_B,
+  // restricted to those dimensions, so that for each set in convex_sets_A we
+  // only visit the sets in convex_sets_B whose boxes overlap, instead of all of
+  // them. If there is no such dimension, then all the pairs are visited.
+  std::vector<bool> is_continuous(dimension, false);
+  for (const int joint_index : continuous_revolute_joints) {
+    is_continuous[joint_index] = true;
+  }
+  std::vector<int> fixed_dimensions;
+  for (int k = 0; k < dimension; ++k) {
+    if (!is_continuous[k]) {
+      fixed_dimensions.push_back(k);
+    }
+  }
+  std::optional<ConvexSetIndex> index_B;
+  if (!fixed_dimensions.empty()) {
+    ConvexSets fixed_boxes_B;
+    fixed_boxes_B.reserve(bboxes_B_or_A.size());
+    for (const Hyperrectangle& bbox : bboxes_B_or_A) {
+      fixed_boxes_B.emplace_back(
+          Hyperrectangle(bbox.lb()(fixed_dimensions),
+                         bbox.ub()(fixed_dimensions))
+              .Clone());
+    }
+    index_B.emplace(std::move(fixed_boxes_B));
+  }
+
   // This vector will include a list of (ordered) pairs of sets which need to be
   // checked for intersection by solving a small optimization problem. We can
   // eliminate duplicates (if convex_sets_A == convex_sets_B) and sets with
@@ -402,8 +437,18 @@ ComputePairwiseIntersections(const ConvexSets& convex_sets_A,
   std::vector<std::pair<int, int>> candidate_edges;
   std::vector<VectorXd> candidate_edge_offsets;
   VectorXd offset = Eigen::VectorXd::Zero(dimension);
+  std::vector<int> js;
   for (int i = 0; i < ssize(convex_sets_A); ++i) {
-    for (int j = 0; j < ssize(convex_sets_B); ++j) {
+    // The indices j of the sets of convex_sets_B to visit, in increasing order.
+    if (index_B.has_value()) {
+      js = index_B->FindIntersectionCandidates(
+          bboxes_A[i].lb()(fixed_dimensions),
+          bboxes_A[i].ub()(fixed_dimensions));
+    } else {
+      js.resize(convex_sets_B.size());
+      std::iota(js.begin(), js.end(), 0);
+    }
+    for (const int j : js) {
       if (convex_sets_A_and_B_are_identical && j <= i) {
         // If we're computing intersections within convex_sets_A and j <= i,
         // then we've already checked if we need to add an edge when i and j
@@ -414,8 +459,7 @@ ComputePairwiseIntersections(const ConvexSets& convex_sets_A,
       // If convex_sets_A == convex_sets_B, then
       // region_minimum_and_maximum_values_B is empty, so we instead get the
       // bbox value from region_minimum_and_maximum_values_A.
-      const auto& bbox_B =
-          convex_sets_A_and_B_are_identical ? bboxes_A[j] : bboxes_B[j];
+      const auto& bbox_B = bboxes_B_or_A[j];
 
       offset.setZero();
 
@@ -475,8 +519,11 @@ ComputePairwiseIntersections(const ConvexSets& convex_sets_A,
   Eigen::MatrixXd Aeq(dimension, 2 * dimension);  // Aeq = [-I, I]
   Aeq.leftCols(dimension) = -Eigen::MatrixXd::Identity(dimension, dimension);
   Aeq.rightCols(dimension) = Eigen::MatrixXd::Identity(dimension, dimension);
+  // Building the programs is a significant part of the cost, so we build them
+  // in parallel too.
   std::vector<MathematicalProgram> progs(n_candidates);
-  for (int i = 0; i < n_candidates; ++i) {
+  const auto build_ith = [&](const int thread_num, const int64_t i) {
+    unused(thread_num);
     VectorXDecisionVariable x = progs[i].NewContinuousVariables(dimension);
     VectorXDecisionVariable y = progs[i].NewContinuousVariables(dimension);
     // Add x + offset == y by [-I, I][x; y] == [offset]
@@ -486,7 +533,10 @@ ComputePairwiseIntersections(const ConvexSets& convex_sets_A,
         ->AddPointInSetConstraints(&(progs[i]), x);
     convex_sets_B.at(candidate_edges[i].second)
         ->AddPointInSetConstraints(&(progs[i]), y);
-  }
+  };
+  DynamicParallelForIndexLoop(DegreeOfParallelism(parallelism.num_threads()), 0,
+                              n_candidates, build_ith,
+                              ParallelForBackend::BEST_AVAILABLE);
 
   std::vector<const MathematicalProgram*> prog_ptrs;
   prog_ptrs.reserve(n_candidates);
@@ -495,7 +545,7 @@ ComputePairwiseIntersections(const ConvexSets& convex_sets_A,
   }
   std::vector<MathematicalProgramResult> results = SolveInParallel(
       prog_ptrs, nullptr /* initial_guesses */, nullptr /* solver_options */,
-      std::nullopt /* solver_id */, parallelism, false /* dynamic_schedule */);
+      std::nullopt /* solver_id */, parallelism, true /* dynamic_schedule */);
 
   std::vector<std::pair<int, int>> edges;
   std::vector<Eigen::VectorXd> edge_offsets;
@@ -5,9 +5,13 @@
 #include "drake/geometry/optimization/graph_of_convex_sets.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -16,6 +20,7 @@
 
 #include "drake/common/parallelism.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/timer.h"
 #include "drake/math/quadratic_form.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/create_constraint.h"
@@ -68,6 +73,16 @@ using symbolic::Variable;
 using symbolic::Variables;
 
 namespace {
+// Returns true iff a cost or constraint added for `transcriptions` is part of
+// the convex relaxation (if `convex_relaxation`) or of the MIP (otherwise).
+bool IncludesTranscription(
+    const std::unordered_set<Transcription>& transcriptions,
+    bool convex_relaxation) {
+  return (convex_relaxation &&
+          transcriptions.contains(Transcription::kRelaxation)) ||
+         (!convex_relaxation && transcriptions.contains(Transcription::kMIP));
+}
+
 MathematicalProgramResult SolveMainProgram(
     const MathematicalProgram& prog, const GraphOfConvexSetsOptions& options) {
   MathematicalProgramResult result;
@@ -1323,63 +1338,77 @@ bool GcsIsThreadsafe(const GraphOfConvexSets& gcs) {
 
 }  // namespace
 
-MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
-    const Vertex& source, const Vertex& target,
-    const GraphOfConvexSetsOptions& specified_options) const {
-  VertexId source_id = source.id();
-  VertexId target_id = target.id();
-  if (vertices_.find(source_id) == vertices_.end()) {
-    throw std::runtime_error(fmt::format(
-        "Source vertex {} is not a vertex in this GraphOfConvexSets.",
-        source_id));
-  }
-  if (vertices_.find(target_id) == vertices_.end()) {
-    throw std::runtime_error(fmt::format(
-        "Target vertex {} is not a vertex in this GraphOfConvexSets.",
-        target_id));
-  }
+namespace {
+// Identifies a cost or constraint of an edge as it was transcribed: its
+// evaluator (held, so that its address can't be reused by another one), the
+// variables it is bound to, and whether the transcription includes it.
+struct BindingSignature {
+  std::shared_ptr<const solvers::EvaluatorBase> evaluator;
+  std::vector<symbolic::Variable::Id> variables;
+  bool included{};
+
+  bool operator==(const BindingSignature&) const = default;
+};
 
-  // Fill in default options. Note: if these options change, they must also be
-  // updated in the method documentation.
-  GraphOfConvexSetsOptions options = specified_options;
-  if (!options.convex_relaxation) {
-    options.convex_relaxation = false;
-  }
-  if (!options.preprocessing) {
-    options.preprocessing = false;
-  }
-  if (!options.max_rounded_paths) {
-    options.max_rounded_paths = 0;
-  }
+// Identifies an edge as it was transcribed.
+struct EdgeSignature {
+  EdgeId id;
+  std::optional<bool> phi_value;
+  int num_slacks{};
+  std::vector<BindingSignature> bindings;
 
-  auto IncludesCurrentTranscription =
-      [&options](
-          const std::unordered_set<Transcription>& transcriptions) -> bool {
-    return ((*options.convex_relaxation &&
-             transcriptions.contains(Transcription::kRelaxation)) ||
-            (!*options.convex_relaxation &&
-             transcriptions.contains(Transcription::kMIP)));
-  };
+  bool operator==(const EdgeSignature&) const = default;
+};
 
-  std::set<EdgeId> unusable_edges;
-  if (*options.preprocessing) {
-    unusable_edges = PreprocessShortestPath(source_id, target_id, options);
+template <typename C>
+void AppendBindingSignatures(
+    const std::vector<std::pair<solvers::Binding<C>,
+                                std::unordered_set<Transcription>>>& bindings,
+    bool convex_relaxation, std::vector<BindingSignature>* signatures) {
+  for (const auto& [binding, transcriptions] : bindings) {
+    BindingSignature& signature = signatures->emplace_back();
+    signature.evaluator = binding.evaluator();
+    signature.variables.reserve(binding.variables().size());
+    for (const Variable& var : binding.variables()) {
+      signature.variables.push_back(var.get_id());
+    }
+    signature.included =
+        IncludesTranscription(transcriptions, convex_relaxation);
   }
+}
+}  // namespace
 
-  MathematicalProgram prog;
-
+struct GraphOfConvexSets::EdgeTranscription {
+  // The program with the variables, costs and constraints of the edges.
+  std::unique_ptr<MathematicalProgram> prog;
   std::map<VertexId, std::vector<Edge*>> incoming_edges;
   std::map<VertexId, std::vector<Edge*>> outgoing_edges;
-  std::map<VertexId, std::vector<VectorXDecisionVariable>> vertex_edge_ell;
+  // The edges which are not in the program, and (for the convex relaxation)
+  // placeholders for their relaxed phi.
   std::vector<Edge*> excluded_edges;
-
-  std::map<EdgeId, Variable> relaxed_phi;
   std::vector<Variable> excluded_phi;
+  std::map<EdgeId, Variable> relaxed_phi;
+  bool convex_relaxation{};
+  // The signatures of the edges when they were transcribed. The cached
+  // transcription is out of date when these change.
+  std::vector<EdgeSignature> edge_signatures;
+};
+
+std::unique_ptr<GraphOfConvexSets::EdgeTranscription>
+GraphOfConvexSets::TranscribeEdges(const std::set<EdgeId>& unusable_edges,
+                                   bool convex_relaxation) const {
+  auto transcription = std::make_unique<EdgeTranscription>();
+  transcription->prog = std::make_unique<MathematicalProgram>();
+  transcription->convex_relaxation = convex_relaxation;
+  MathematicalProgram& prog = *transcription->prog;
+  std::map<VertexId, std::vector<Edge*>>& incoming_edges =
+      transcription->incoming_edges;
+  std::map<VertexId, std::vector<Edge*>>& outgoing_edges =
+      transcription->outgoing_edges;
+  std::vector<Edge*>& excluded_edges = transcription->excluded_edges;
+  std::vector<Variable>& excluded_phi = transcription->excluded_phi;
+  std::map<EdgeId, Variable>& relaxed_phi = transcription->relaxed_phi;
 
-  // The flow constraints below assume that we have some edge out of the source
-  // and into the target, so we handle that case explicitly.
-  bool has_edges_out_of_source = false;
-  bool has_edges_into_target = false;
   for (const auto& [edge_id, e] : edges_) {
     // If an edge is turned off (ϕ = 0) or excluded by preprocessing, don't
     // include it in the optimization.
@@ -1387,23 +1416,17 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       // Track excluded edges (ϕ = 0 and preprocessed) so that their variables
       // can be set in the optimization result.
       excluded_edges.emplace_back(e.get());
-      if (*options.convex_relaxation) {
+      if (convex_relaxation) {
         Variable phi("phi_excluded");
         excluded_phi.push_back(phi);
       }
       continue;
     }
-    if (e->u().id() == source_id) {
-      has_edges_out_of_source = true;
-    }
-    if (e->v().id() == target_id) {
-      has_edges_into_target = true;
-    }
     outgoing_edges[e->u().id()].emplace_back(e.get());
     incoming_edges[e->v().id()].emplace_back(e.get());
 
     Variable phi;
-    if (*options.convex_relaxation) {
+    if (convex_relaxation) {
       phi = prog.NewContinuousVariables<1>(e->name() + "phi")[0];
       prog.AddBoundingBoxConstraint(0, 1, phi);
       relaxed_phi.emplace(edge_id, phi);
@@ -1432,7 +1455,7 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
     // Edge costs.
     for (int i = 0; i < e->ell_.size(); ++i) {
       const auto& [b, transcriptions] = e->costs_[i];
-      if (IncludesCurrentTranscription(transcriptions)) {
+      if (IncludesTranscription(transcriptions, convex_relaxation)) {
         prog.AddDecisionVariables(Vector1<Variable>{e->ell_[i]});
         prog.AddLinearCost(VectorXd::Ones(1), Vector1<Variable>{e->ell_[i]});
         const VectorXDecisionVariable& old_vars = b.variables();
@@ -1450,7 +1473,7 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
 
     // Edge constraints.
     for (const auto& [b, transcriptions] : e->constraints_) {
-      if (IncludesCurrentTranscription(transcriptions)) {
+      if (IncludesTranscription(transcriptions, convex_relaxation)) {
         const VectorXDecisionVariable& old_vars = b.variables();
         VectorXDecisionVariable vars(old_vars.size() + 1);
         // vars = [phi; yz_vars]
@@ -1467,6 +1490,122 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       }
     }
   }
+  return transcription;
+}
+
+std::unique_ptr<MathematicalProgram>
+GraphOfConvexSets::CloneCachedEdgeTranscription(
+    bool convex_relaxation,
+    std::shared_ptr<const EdgeTranscription>* transcription) const {
+  DRAKE_DEMAND(transcription != nullptr);
+  std::vector<EdgeSignature> edge_signatures;
+  edge_signatures.reserve(edges_.size());
+  for (const auto& [edge_id, e] : edges_) {
+    EdgeSignature& signature = edge_signatures.emplace_back();
+    signature.id = edge_id;
+    signature.phi_value = e->phi_value_;
+    signature.num_slacks = e->slacks_.size();
+    AppendBindingSignatures(e->costs_, convex_relaxation,
+                            &signature.bindings);
+    AppendBindingSignatures(e->constraints_, convex_relaxation,
+                            &signature.bindings);
+  }
+
+  std::lock_guard<std::mutex> guard(cached_edge_transcription_mutex_);
+  if (cached_edge_transcription_ == nullptr ||
+      cached_edge_transcription_->convex_relaxation != convex_relaxation ||
+      cached_edge_transcription_->edge_signatures != edge_signatures) {
+    cached_edge_transcription_ =
+        TranscribeEdges(std::set<EdgeId>{}, convex_relaxation);
+    cached_edge_transcription_->edge_signatures = std::move(edge_signatures);
+  } else {
+    log()->debug("Reusing the cached transcription of {} GCS edges.",
+                 edges_.size());
+  }
+  *transcription = cached_edge_transcription_;
+  return cached_edge_transcription_->prog->Clone();
+}
+
+MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
+    const Vertex& source, const Vertex& target,
+    const GraphOfConvexSetsOptions& specified_options) const {
+  VertexId source_id = source.id();
+  VertexId target_id = target.id();
+  if (vertices_.find(source_id) == vertices_.end()) {
+    throw std::runtime_error(fmt::format(
+        "Source vertex {} is not a vertex in this GraphOfConvexSets.",
+        source_id));
+  }
+  if (vertices_.find(target_id) == vertices_.end()) {
+    throw std::runtime_error(fmt::format(
+        "Target vertex {} is not a vertex in this GraphOfConvexSets.",
+        target_id));
+  }
+
+  // Fill in default options. Note: if these options change, they must also be
+  // updated in the method documentation.
+  GraphOfConvexSetsOptions options = specified_options;
+  if (!options.convex_relaxation) {
+    options.convex_relaxation = false;
+  }
+  if (!options.preprocessing) {
+    options.preprocessing = false;
+  }
+  if (!options.max_rounded_paths) {
+    options.max_rounded_paths = 0;
+  }
+  DRAKE_THROW_UNLESS(options.rounding_relative_gap.value_or(0.0) >= 0.0);
+
+  auto IncludesCurrentTranscription =
+      [&options](
+          const std::unordered_set<Transcription>& transcriptions) -> bool {
+    return IncludesTranscription(transcriptions, *options.convex_relaxation);
+  };
+
+  // Times each stage of the solve (preprocessing, the main program, and
+  // rounding), for the log messages below.
+  SteadyTimer timer;
+
+  std::set<EdgeId> unusable_edges;
+  if (*options.preprocessing) {
+    unusable_edges = PreprocessShortestPath(source_id, target_id, options);
+    log()->debug("Preprocessed GCS shortest path in {:.3f}s; {} of {} edges "
+                 "cannot be on the path.",
+                 timer.Tick(), unusable_edges.size(), edges_.size());
+    timer.Start();
+  }
+
+  // Transcribe the edges, or copy their cached transcription.
+  std::shared_ptr<const EdgeTranscription> edge_transcription;
+  std::unique_ptr<MathematicalProgram> prog_ptr;
+  if (options.cache_transcription && !*options.preprocessing) {
+    prog_ptr = CloneCachedEdgeTranscription(*options.convex_relaxation,
+                                            &edge_transcription);
+  } else {
+    std::unique_ptr<EdgeTranscription> transcribed =
+        TranscribeEdges(unusable_edges, *options.convex_relaxation);
+    prog_ptr = std::move(transcribed->prog);
+    edge_transcription = std::move(transcribed);
+  }
+  MathematicalProgram& prog = *prog_ptr;
+  const int num_edge_transcription_vars = prog.num_vars();
+
+  // N.B. We copy the edge maps since the vertex loop below default-constructs
+  // the entries of the vertices without edges.
+  std::map<VertexId, std::vector<Edge*>> incoming_edges =
+      edge_transcription->incoming_edges;
+  std::map<VertexId, std::vector<Edge*>> outgoing_edges =
+      edge_transcription->outgoing_edges;
+  const std::vector<Edge*>& excluded_edges = edge_transcription->excluded_edges;
+  const std::map<EdgeId, Variable>& relaxed_phi =
+      edge_transcription->relaxed_phi;
+  const std::vector<Variable>& excluded_phi = edge_transcription->excluded_phi;
+  std::map<VertexId, std::vector<VectorXDecisionVariable>> vertex_edge_ell;
+
+  // The flow constraints below assume that we have some edge out of the source
+  // and into the target, so we handle that case explicitly.
+  const bool has_edges_out_of_source = outgoing_edges.contains(source_id);
+  const bool has_edges_into_target = incoming_edges.contains(target_id);
   if (!has_edges_out_of_source) {
     MathematicalProgramResult result;
     log()->info("Source vertex {} ({}) has no outgoing edges.", source.name(),
@@ -1646,12 +1785,25 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
   MathematicalProgramResult result = SolveMainProgram(prog, options);
   log()->info(
       "Solved GCS shortest path using {} with convex_relaxation={} and "
-      "preprocessing={}{}.",
+      "preprocessing={}{} in {:.3f}s.",
       result.get_solver_id().name(), *options.convex_relaxation,
       *options.preprocessing,
       *options.convex_relaxation && *options.max_rounded_paths > 0
           ? " and rounding"
-          : " and no rounding");
+          : " and no rounding",
+      timer.Tick());
+  timer.Start();
+
+  if (options.cache_transcription && !*options.preprocessing &&
+      result.is_success()) {
+    // Warm-start the next query from this solution of the edge variables.
+    std::lock_guard<std::mutex> guard(cached_edge_transcription_mutex_);
+    if (cached_edge_transcription_ == edge_transcription) {
+      cached_edge_transcription_->prog->SetInitialGuess(
+          cached_edge_transcription_->prog->decision_variables(),
+          result.get_x_val().head(num_edge_transcription_vars));
+    }
+  }
 
   {  // Push the placeholder variables and excluded edge variables into the
     // result, so that they can be accessed as if they were variables included
@@ -1761,7 +1913,7 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       if (!e->phi_value_.value_or(true) || unusable_edges.contains(edge_id)) {
         flows.emplace(e.get(), 0.0);
       } else {
-        flows.emplace(e.get(), result.GetSolution(relaxed_phi[edge_id]));
+        flows.emplace(e.get(), result.GetSolution(relaxed_phi.at(edge_id)));
       }
     }
 
@@ -1787,12 +1939,7 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
           "that contain these constraints will be solved sequentially.");
     }
 
-    std::vector<std::unique_ptr<MathematicalProgram>> progs;
-    std::vector<const MathematicalProgram*> prog_ptrs;
-    for (int i = 0; i < ssize(candidate_paths); ++i) {
-      progs.push_back(ConstructRestrictionProgram(candidate_paths[i], &result));
-      prog_ptrs.push_back(progs[i].get());
-    }
+    const double relaxation_cost = result.get_optimal_cost();
 
     std::optional<solvers::SolverId> maybe_solver_id = std::nullopt;
     if (options.restriction_solver) {
@@ -1806,23 +1953,55 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
             ? &(options.restriction_solver_options.value())
             : &(options.solver_options);
 
-    // We use nullptr for the initial guesses, since ConstructRestrictionProgram
-    // prepopulates the initial guesses. We use dynamic scheduling, since
-    // individual restriction solves may vary in the number of variables and
-    // constraints.
-    std::vector<MathematicalProgramResult> rounded_results =
-        SolveInParallel(prog_ptrs, nullptr /* initial_guesses */,
-                        maybe_options /* solver_options */, maybe_solver_id,
-                        options.parallelism, true /* dynamic_schedule */);
+    // Without an early stopping criterion, all of the paths are solved at
+    // once; otherwise, they are solved in batches of one path per thread, and
+    // we stop after the first batch that finds a path whose cost is close
+    // enough to the lower bound given by the relaxation. The restriction
+    // programs are only built for the batches that are solved.
+    const int num_paths = ssize(candidate_paths);
+    const int batch_size = options.rounding_relative_gap.has_value()
+                               ? options.parallelism.num_threads()
+                               : num_paths;
+    const double good_enough_cost =
+        relaxation_cost +
+        options.rounding_relative_gap.value_or(0.0) * std::abs(relaxation_cost);
 
     constexpr double kInf = std::numeric_limits<double>::infinity();
     double best_cost = kInf;
     int best_result_idx = -1;
-    for (int i = 0; i < ssize(rounded_results); ++i) {
-      if (rounded_results[i].is_success() &&
-          rounded_results[i].get_optimal_cost() < best_cost) {
-        best_result_idx = i;
-        best_cost = rounded_results[i].get_optimal_cost();
+    std::vector<std::unique_ptr<MathematicalProgram>> progs;
+    std::vector<MathematicalProgramResult> rounded_results;
+    progs.reserve(num_paths);
+    rounded_results.reserve(num_paths);
+    while (ssize(rounded_results) < num_paths) {
+      const int batch_begin = ssize(rounded_results);
+      const int batch_end = std::min(batch_begin + batch_size, num_paths);
+      std::vector<const MathematicalProgram*> batch;
+      batch.reserve(batch_end - batch_begin);
+      for (int i = batch_begin; i < batch_end; ++i) {
+        progs.push_back(
+            ConstructRestrictionProgram(candidate_paths[i], &result));
+        batch.push_back(progs.back().get());
+      }
+      // We use nullptr for the initial guesses, since
+      // ConstructRestrictionProgram prepopulates the initial guesses. We use
+      // dynamic scheduling, since individual restriction solves may vary in
+      // the number of variables and constraints.
+      std::vector<MathematicalProgramResult> batch_results =
+          SolveInParallel(batch, nullptr /* initial_guesses */,
+                          maybe_options /* solver_options */, maybe_solver_id,
+                          options.parallelism, true /* dynamic_schedule */);
+      for (MathematicalProgramResult& batch_result : batch_results) {
+        if (batch_result.is_success() &&
+            batch_result.get_optimal_cost() < best_cost) {
+          best_result_idx = ssize(rounded_results);
+          best_cost = batch_result.get_optimal_cost();
+        }
+        rounded_results.push_back(std::move(batch_result));
+      }
+      if (options.rounding_relative_gap.has_value() &&
+          best_cost <= good_enough_cost) {
+        break;
       }
     }
 
@@ -1830,7 +2009,7 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       // We found at least one valid result.
       result = rounded_results[best_result_idx];
       MakeRestrictionResultLookLikeMixedInteger(
-          *(prog_ptrs[best_result_idx]), &result,
+          *(progs[best_result_idx]), &result,
           candidate_paths[best_result_idx]);
     } else {
       // In the event that all rounded results are infeasible, we still want
@@ -1839,8 +2018,9 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       result.set_solver_id(rounded_results.back().get_solver_id());
     }
 
-    log()->info("Finished {} rounding solutions with {}.",
-                candidate_paths.size(), result.get_solver_id().name());
+    log()->info("Finished {} of {} rounding solutions with {} in {:.3f}s.",
+                rounded_results.size(), candidate_paths.size(),
+                result.get_solver_id().name(), timer.Tick());
   }
 
   return result;
@@ -1893,6 +2073,10 @@ std::vector<std::vector<const Edge*>> GraphOfConvexSets::SamplePaths(
   RandomGenerator generator(options.rounding_seed);
   std::uniform_real_distribution<double> uniform;
   std::vector<std::vector<const Edge*>> paths;
+  // The edge ids of the paths found so far, for detecting duplicates in
+  // logarithmic time. (Ordering by id, rather than by pointer, keeps the order
+  // of the set independent of the memory layout.)
+  std::set<std::vector<EdgeId>> unique_paths;
 
   int num_trials = 0;
   bool no_feasible_paths = false;
@@ -1963,11 +2147,16 @@ std::vector<std::vector<const Edge*>> GraphOfConvexSets::SamplePaths(
       continue;
     }
 
-    if (std::find(paths.begin(), paths.end(), new_path_edges) != paths.end()) {
+    std::vector<EdgeId> new_path_ids;
+    new_path_ids.reserve(new_path_edges.size());
+    for (const Edge* e : new_path_edges) {
+      new_path_ids.push_back(e->id());
+    }
+    if (!unique_paths.insert(std::move(new_path_ids)).second) {
       continue;
     }
 
-    paths.push_back(new_path_edges);
+    paths.push_back(std::move(new_path_edges));
   }
 
   if (no_feasible_paths) {
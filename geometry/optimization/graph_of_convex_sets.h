@@ -3,6 +3,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -35,6 +36,8 @@ struct GraphOfConvexSetsOptions {
     a->Visit(DRAKE_NVP(max_rounding_trials));
     a->Visit(DRAKE_NVP(flow_tolerance));
     a->Visit(DRAKE_NVP(rounding_seed));
+    a->Visit(DRAKE_NVP(rounding_relative_gap));
+    a->Visit(DRAKE_NVP(cache_transcription));
     // N.B. We skip the DRAKE_NVP(solver), DRAKE_NVP(restriction_solver), and
     // DRAKE_NVP(preprocessing_solver), because it cannot be serialized.
     // TODO(#20967) Serialize the DRAKE_NVP(solver_options).
@@ -79,6 +82,40 @@ struct GraphOfConvexSetsOptions {
   max_rounded_paths is less than or equal to zero, this option is ignored. */
   int rounding_seed{0};
 
+  /** If set, the rounding stage stops solving the convex restrictions of the
+  sampled paths as soon as one of them has a cost within this relative gap of
+  the optimal cost of the convex relaxation (which is a lower bound on the cost
+  of every path), i.e., once cost ≤ relaxation_cost + rounding_relative_gap *
+  |relaxation_cost|. The paths are then solved in batches of
+  parallelism.num_threads(), in the order they were sampled, and the remaining
+  paths are skipped. If nullopt, all of the sampled paths are solved. If
+  convex_relaxation is false or max_rounded_paths is less than or equal to
+  zero, this option is ignored.
+  @pre rounding_relative_gap is nullopt or non-negative. */
+  std::optional<double> rounding_relative_gap{std::nullopt};
+
+  /** If true, SolveShortestPath() keeps the transcription of the edges (their
+  variables, costs and constraints, which do not depend on the source and
+  target) in the graph, and reuses it in subsequent calls with the same
+  convex_relaxation. Repeated queries between different sources and targets in
+  an unchanged graph then only transcribe the flow constraints and the vertex
+  costs and constraints, and each query is warm-started from the solution of
+  the previous one (for the solvers that use an initial guess). Because of the
+  warm start, the result of a query can depend on the queries that preceded it
+  (e.g., a solver may converge to a different optimal solution, or stop at a
+  different iterate within its tolerances).
+
+  The kept transcription is discarded when an edge is added or removed, when a
+  cost or constraint is added to an edge, when a phi constraint of an edge
+  changes, or when convex_relaxation changes. The costs and constraints are
+  identified by their evaluators and variables, not by their values: changing
+  the coefficients of an evaluator in place (e.g., with
+  LinearCost::UpdateCoefficients()) after it was transcribed is not detected,
+  and leaves the kept transcription out of date. This option is ignored when
+  preprocessing is true, since preprocessing removes edges depending on the
+  source and target. */
+  bool cache_transcription{false};
+
   // TODO(#20969) The following solver interfaces may need to be moved to fully
   // serialize the options.
 
@@ -932,6 +969,22 @@ class GraphOfConvexSets {
       VertexId source_id, VertexId target_id,
       const GraphOfConvexSetsOptions& options) const;
 
+  // The part of the shortest path program which does not depend on the source
+  // and target; defined in the .cc file.
+  struct EdgeTranscription;
+
+  // Transcribes the variables, costs and constraints of all edges except the
+  // `unusable_edges` and the edges turned off by AddPhiConstraint(false).
+  std::unique_ptr<EdgeTranscription> TranscribeEdges(
+      const std::set<EdgeId>& unusable_edges, bool convex_relaxation) const;
+
+  // Returns a copy of the program of the cached edge transcription for
+  // `convex_relaxation`, transcribing the edges first if the cache is empty or
+  // out of date. The transcription itself is returned in `transcription`.
+  std::unique_ptr<solvers::MathematicalProgram> CloneCachedEdgeTranscription(
+      bool convex_relaxation,
+      std::shared_ptr<const EdgeTranscription>* transcription) const;
+
   // Adds a perspective constraint to the mathematical program to upper bound
   // the cost below a slack variable, ℓ. Specifically given a cost g(x) to
   // minimize, this method implements it with a slack variable and a constraint:
@@ -961,6 +1014,11 @@ class GraphOfConvexSets {
   // containers (like std::set or std::map) using their default ordering.
   std::map<VertexId, std::unique_ptr<Vertex>> vertices_{};
   std::map<EdgeId, std::unique_ptr<Edge>> edges_{};
+
+  // The edge transcription kept by GraphOfConvexSetsOptions::
+  // cache_transcription, guarded by the mutex.
+  mutable std::mutex cached_edge_transcription_mutex_;
+  mutable std::shared_ptr<EdgeTranscription> cached_edge_transcription_;
 };
 
 }  // namespace optimization
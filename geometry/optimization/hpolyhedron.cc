@@ -10,6 +10,7 @@
 #include <tuple>
 
 #include <Eigen/Eigenvalues>
+#include <common_robotics_utilities/parallelism.hpp>
 #include <drake/solvers/binding.h>
 #include <fmt/format.h>
 #include <libqhullcpp/Coordinates.h>
@@ -33,6 +34,10 @@ namespace drake {
 namespace geometry {
 namespace optimization {
 
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForRangeLoop;
+using common_robotics_utilities::parallelism::ThreadWorkRange;
 using Eigen::MatrixXd;
 using Eigen::RowVectorXd;
 using Eigen::VectorXd;
@@ -547,6 +552,39 @@ HPolyhedron HPolyhedron::Intersection(const HPolyhedron& other,
   return this->DoIntersectionNoChecks(other);
 }
 
+namespace {
+// If a row of the A matrix is orthogonal to all columns of the basis, then
+// the constraint from that row is enforced by the sample being in the column
+// space of the basis. Thus, we skip that constraint when performing
+// hit-and-run sampling. Returns `skip`, where skip[i] is true if the i'th row
+// of A is skipped.
+std::vector<bool> FindHalfspacesImpliedBySubspace(
+    const MatrixXd& A,
+    const std::optional<Eigen::Ref<const Eigen::MatrixXd>>& subspace,
+    double tol) {
+  std::vector<bool> skip(A.rows(), false);
+  if (subspace.has_value()) {
+    const double squared_tol = tol * tol;
+    VectorXd subspace_j_squared_norm(subspace->cols());
+    for (int j = 0; j < subspace->cols(); ++j) {
+      subspace_j_squared_norm(j) = subspace->col(j).squaredNorm();
+    }
+    for (int i = 0; i < A.rows(); ++i) {
+      skip[i] = true;
+      const double Ai_squared_norm = A.row(i).squaredNorm();
+      for (int j = 0; j < subspace->cols(); ++j) {
+        if (std::pow(A.row(i) * subspace->col(j), 2) >
+            squared_tol * Ai_squared_norm * subspace_j_squared_norm(j)) {
+          skip[i] = false;
+          break;
+        }
+      }
+    }
+  }
+  return skip;
+}
+}  // namespace
+
 VectorXd HPolyhedron::UniformSample(
     RandomGenerator* generator,
     const Eigen::Ref<const Eigen::VectorXd>& previous_sample,
@@ -566,29 +604,8 @@ VectorXd HPolyhedron::UniformSample(
   VectorXd gaussian_sample(sampling_dim);
   VectorXd direction(ambient_dimension());
 
-  // If a row of the A matrix is orthogonal to all columns of the basis, then
-  // the constraint from that row is enforced by the sample being in the column
-  // space of the basis. Thus, we skip that constraint when performing
-  // hit-and-run sampling.
-  std::vector<bool> skip(A_.rows(), false);
-  if (subspace.has_value()) {
-    const double squared_tol = tol * tol;
-    VectorXd subspace_j_squared_norm(subspace->cols());
-    for (int j = 0; j < subspace->cols(); ++j) {
-      subspace_j_squared_norm(j) = subspace->col(j).squaredNorm();
-    }
-    for (int i = 0; i < A_.rows(); ++i) {
-      skip[i] = true;
-      const double Ai_squared_norm = A_.row(i).squaredNorm();
-      for (int j = 0; j < subspace->cols(); ++j) {
-        if (std::pow(A_.row(i) * subspace->col(j), 2) >
-            squared_tol * Ai_squared_norm * subspace_j_squared_norm(j)) {
-          skip[i] = false;
-          break;
-        }
-      }
-    }
-  }
+  const std::vector<bool> skip =
+      FindHalfspacesImpliedBySubspace(A_, subspace, tol);
 
   for (int step = 0; step < mixing_steps; ++step) {
     // Choose a random direction.
@@ -655,6 +672,126 @@ VectorXd HPolyhedron::UniformSample(
   return UniformSample(generator, center, mixing_steps, subspace, tol);
 }
 
+MatrixXd HPolyhedron::UniformSampleBatch(
+    RandomGenerator* generator,
+    const Eigen::Ref<const Eigen::MatrixXd>& previous_samples,
+    const int mixing_steps,
+    const std::optional<Eigen::Ref<const Eigen::MatrixXd>>& subspace,
+    double tol, Parallelism parallelism) const {
+  DRAKE_THROW_UNLESS(generator != nullptr);
+  DRAKE_THROW_UNLESS(mixing_steps >= 1);
+  DRAKE_THROW_UNLESS(previous_samples.rows() == ambient_dimension());
+  if (subspace.has_value()) {
+    DRAKE_THROW_UNLESS(subspace->rows() == ambient_dimension());
+  }
+  const int num_chains = previous_samples.cols();
+  const int sampling_dim =
+      subspace.has_value() ? subspace->cols() : ambient_dimension();
+  const std::vector<bool> skip =
+      FindHalfspacesImpliedBySubspace(A_, subspace, tol);
+
+  // Seed the generator of each chain in order, so that the samples do not
+  // depend on how the chains are split among the threads.
+  std::vector<RandomGenerator> chain_generators;
+  chain_generators.reserve(num_chains);
+  for (int k = 0; k < num_chains; ++k) {
+    chain_generators.emplace_back((*generator)());
+  }
+
+  MatrixXd samples = previous_samples;
+  // failed[k] is true if the hit-and-run step of chain k found an empty
+  // line segment. We can't throw inside the parallel loop.
+  std::vector<uint8_t> failed(num_chains, 0);
+  const auto advance_chains = [&](const ThreadWorkRange& work_range) {
+    const int start = work_range.GetRangeStart();
+    const int num = work_range.GetRangeEnd() - start;
+    auto X = samples.middleCols(start, num);
+    // The slack b - A * x of each chain.
+    MatrixXd slack = (-A_ * X).colwise() + b_;
+    MatrixXd gaussian_samples(sampling_dim, num);
+    MatrixXd directions(ambient_dimension(), num);
+    MatrixXd A_directions(A_.rows(), num);
+    std::vector<bool> active(num, true);
+    for (int step = 0; step < mixing_steps; ++step) {
+      // Choose a random direction for each chain.
+      for (int k = 0; k < num; ++k) {
+        std::normal_distribution<double> gaussian;
+        for (int i = 0; i < sampling_dim; ++i) {
+          gaussian_samples(i, k) = gaussian(chain_generators[start + k]);
+        }
+      }
+      if (subspace.has_value()) {
+        directions.noalias() = *subspace * gaussian_samples;
+      } else {
+        directions = gaussian_samples;
+      }
+      A_directions.noalias() = A_ * directions;
+      for (int k = 0; k < num; ++k) {
+        if (!active[k]) {
+          continue;
+        }
+        // Find max and min θ subject to
+        //   slack - θ * (A * direction) ≥ 0.
+        double theta_max = std::numeric_limits<double>::infinity();
+        double theta_min = -theta_max;
+        for (int i = 0; i < A_.rows(); ++i) {
+          const double line_a = A_directions(i, k);
+          if (skip[i]) {
+            continue;
+          } else if (line_a < 0.0) {
+            theta_min = std::max(theta_min, slack(i, k) / line_a);
+          } else if (line_a > 0.0) {
+            theta_max = std::min(theta_max, slack(i, k) / line_a);
+          }
+        }
+        if (std::isinf(theta_max) || std::isinf(theta_min) ||
+            theta_max < theta_min) {
+          failed[start + k] = 1;
+          active[k] = false;
+          continue;
+        }
+        // Now pick θ uniformly from [θ_min, θ_max).
+        std::uniform_real_distribution<double> uniform_theta(theta_min,
+                                                             theta_max);
+        const double theta = uniform_theta(chain_generators[start + k]);
+        X.col(k) += theta * directions.col(k);
+        slack.col(k) -= theta * A_directions.col(k);
+      }
+    }
+  };
+  StaticParallelForRangeLoop(DegreeOfParallelism(parallelism.num_threads()),
+                             0, num_chains, advance_chains,
+                             ParallelForBackend::BEST_AVAILABLE);
+
+  for (int k = 0; k < num_chains; ++k) {
+    if (failed[k]) {
+      throw std::invalid_argument(fmt::format(
+          "The Hit and Run algorithm failed to find a feasible point in the "
+          "set. The column {} of `previous_samples` must be in the set.\n"
+          "max(A * previous_samples.col({}) - b) = {}",
+          k, k, (A_ * previous_samples.col(k) - b_).maxCoeff()));
+    }
+  }
+
+  // As in UniformSample(), a chain that barely moved could indicate a
+  // lower-dimensional polytope. Warn once for the whole batch.
+  const double kWarnTolerance = 1e-8;
+  for (int k = 0; k < num_chains; ++k) {
+    if ((samples.col(k) - previous_samples.col(k))
+            .template lpNorm<Eigen::Infinity>() < kWarnTolerance) {
+      drake::log()->warn(
+          "The Hit and Run algorithm produced a random guess that is extremely "
+          "close to column {} of `previous_samples`, which could indicate that "
+          "the HPolyhedron being sampled is not full-dimensional. To draw "
+          "samples from such an HPolyhedron, please use the `subspace` "
+          "argument.",
+          k);
+      break;
+    }
+  }
+  return samples;
+}
+
 HPolyhedron HPolyhedron::MakeBox(const Eigen::Ref<const VectorXd>& lb,
                                  const Eigen::Ref<const VectorXd>& ub) {
   DRAKE_THROW_UNLESS(lb.size() == ub.size());
@@ -1289,6 +1426,18 @@ std::optional<bool> HPolyhedron::DoPointInSetShortcut(
   return ((A_ * x).array() <= b_.array() + tol).all();
 }
 
+std::vector<bool> HPolyhedron::DoPointsInSet(
+    const Eigen::Ref<const MatrixXd>& points, double tol) const {
+  DRAKE_DEMAND(A_.cols() == points.rows());
+  const MatrixXd A_points = A_ * points;
+  const VectorXd b_tol = b_.array() + tol;
+  std::vector<bool> result(points.cols());
+  for (int i = 0; i < points.cols(); ++i) {
+    result[i] = (A_points.col(i).array() <= b_tol.array()).all();
+  }
+  return result;
+}
+
 std::pair<VectorX<Variable>, std::vector<Binding<Constraint>>>
 HPolyhedron::DoAddPointInSetConstraints(
     MathematicalProgram* prog,
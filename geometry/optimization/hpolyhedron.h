@@ -306,6 +306,33 @@ class HPolyhedron final : public ConvexSet {
           std::nullopt,
       double tol = 1e-8) const;
 
+  /** Batched variant of UniformSample, which advances
+  `previous_samples.cols()` independent hit-and-run Markov chains. Column k of
+  the returned matrix is the sample obtained after `mixing_steps` steps of the
+  chain starting at `previous_samples.col(k)`. The chains are advanced
+  together, so that each step evaluates A * direction for all the chains as
+  one matrix-matrix product, and the slack b - A * x of each chain is updated
+  incrementally rather than recomputed.
+
+  Each chain draws its random numbers from its own generator, seeded from
+  `generator` in the order of the chains. Hence the result only depends on the
+  state of `generator`, and not on `parallelism`.
+  Like UniformSample(), this logs a warning if a chain ends extremely close to
+  where it started, which could indicate that the HPolyhedron is not
+  full-dimensional (see the `subspace` argument).
+  @param parallelism The chains are split among at most this many threads.
+  @pre subspace.rows() == ambient_dimension().
+  @pre previous_samples.rows() == ambient_dimension().
+  @throws std::exception if any column of previous_samples is not in the set.
+  */
+  Eigen::MatrixXd UniformSampleBatch(
+      RandomGenerator* generator,
+      const Eigen::Ref<const Eigen::MatrixXd>& previous_samples,
+      int mixing_steps = 10,
+      const std::optional<Eigen::Ref<const Eigen::MatrixXd>>& subspace =
+          std::nullopt,
+      double tol = 1e-8, Parallelism parallelism = Parallelism::None()) const;
+
   /** Constructs a polyhedron as an axis-aligned box from the lower and upper
   corners. */
   static HPolyhedron MakeBox(const Eigen::Ref<const Eigen::VectorXd>& lb,
@@ -353,6 +380,10 @@ class HPolyhedron final : public ConvexSet {
   std::optional<bool> DoPointInSetShortcut(
       const Eigen::Ref<const Eigen::VectorXd>& x, double tol) const final;
 
+  std::vector<bool> DoPointsInSet(
+      const Eigen::Ref<const Eigen::MatrixXd>& points,
+      double tol) const final;
+
   std::pair<VectorX<symbolic::Variable>,
             std::vector<solvers::Binding<solvers::Constraint>>>
   DoAddPointInSetConstraints(
@@ -299,6 +299,17 @@ std::optional<bool> Hyperellipsoid::DoPointInSetShortcut(
   return v.dot(v) <= 1.0 + tol;
 }
 
+std::vector<bool> Hyperellipsoid::DoPointsInSet(
+    const Eigen::Ref<const MatrixXd>& points, double tol) const {
+  DRAKE_DEMAND(A_.cols() == points.rows());
+  const MatrixXd V = A_ * (points.colwise() - center_);
+  std::vector<bool> result(points.cols());
+  for (int i = 0; i < points.cols(); ++i) {
+    result[i] = V.col(i).dot(V.col(i)) <= 1.0 + tol;
+  }
+  return result;
+}
+
 std::pair<VectorX<Variable>, std::vector<Binding<Constraint>>>
 Hyperellipsoid::DoAddPointInSetConstraints(
     MathematicalProgram* prog,
@@ -109,6 +109,18 @@ std::optional<bool> Hyperrectangle::DoPointInSetShortcut(
          (x.array() <= ub_.array() + tol).all();
 }
 
+std::vector<bool> Hyperrectangle::DoPointsInSet(
+    const Eigen::Ref<const Eigen::MatrixXd>& points, double tol) const {
+  const Eigen::ArrayXd lb_tol = lb_.array() - tol;
+  const Eigen::ArrayXd ub_tol = ub_.array() + tol;
+  std::vector<bool> result(points.cols());
+  for (int i = 0; i < points.cols(); ++i) {
+    result[i] = (points.col(i).array() >= lb_tol).all() &&
+                (points.col(i).array() <= ub_tol).all();
+  }
+  return result;
+}
+
 Eigen::VectorXd Hyperrectangle::UniformSample(
     RandomGenerator* generator) const {
   Eigen::VectorXd sample(ambient_dimension());
@@ -95,6 +95,10 @@ class Hyperrectangle final : public ConvexSet {
   std::optional<bool> DoPointInSetShortcut(
       const Eigen::Ref<const Eigen::VectorXd>& x, double tol) const final;
 
+  std::vector<bool> DoPointsInSet(
+      const Eigen::Ref<const Eigen::MatrixXd>& points,
+      double tol) const final;
+
   std::pair<VectorX<symbolic::Variable>,
             std::vector<solvers::Binding<solvers::Constraint>>>
   DoAddPointInSetConstraints(
@@ -78,6 +78,17 @@ std::optional<bool> Point::DoPointInSetShortcut(
   return is_approx_equal_abstol(x, x_, tol);
 }
 
+std::vector<bool> Point::DoPointsInSet(const Eigen::Ref<const MatrixXd>& points,
+                                       double tol) const {
+  const Eigen::RowVectorXd max_error =
+      (points.colwise() - x_).cwiseAbs().colwise().maxCoeff();
+  std::vector<bool> result(points.cols());
+  for (int i = 0; i < points.cols(); ++i) {
+    result[i] = max_error(i) <= tol;
+  }
+  return result;
+}
+
 std::pair<VectorX<Variable>, std::vector<Binding<Constraint>>>
 Point::DoAddPointInSetConstraints(
     MathematicalProgram* prog,
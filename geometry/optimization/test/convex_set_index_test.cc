@@ -0,0 +1,168 @@
+#include "drake/geometry/optimization/convex_set_index.h"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/geometry/optimization/hpolyhedron.h"
+#include "drake/geometry/optimization/hyperellipsoid.h"
+#include "drake/geometry/optimization/hyperrectangle.h"
+#include "drake/geometry/optimization/point.h"
+
+namespace drake {
+namespace geometry {
+namespace optimization {
+namespace {
+
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+
+// Returns a mix of boxes, ellipsoids, polytopes and points scattered on a
+// grid, so that each set only overlaps its neighbors.
+ConvexSets MakeSets() {
+  ConvexSets sets;
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      const Vector2d center(1.5 * i, 1.5 * j);
+      switch ((i + j) % 4) {
+        case 0:
+          sets.emplace_back(Hyperrectangle(center - Vector2d(1, 0.5),
+                                           center + Vector2d(1, 0.5))
+                                .Clone());
+          break;
+        case 1:
+          sets.emplace_back(Hyperellipsoid::MakeHypersphere(0.8, center)
+                                .Clone());
+          break;
+        case 2:
+          sets.emplace_back(
+              HPolyhedron::MakeL1Ball(2).Scale(0.9, center).Clone());
+          break;
+        default:
+          sets.emplace_back(Point(center).Clone());
+      }
+    }
+  }
+  return sets;
+}
+
+GTEST_TEST(ConvexSetIndexTest, Empty) {
+  const ConvexSetIndex dut;
+  EXPECT_EQ(dut.num_sets(), 0);
+  EXPECT_EQ(dut.ambient_dimension(), 0);
+  EXPECT_TRUE(dut.FindContainingSets(VectorXd(0)).empty());
+  EXPECT_TRUE(dut.FindIntersectionCandidatePairs().empty());
+  EXPECT_FALSE(dut.FindNearestSet(VectorXd(0)).has_value());
+}
+
+GTEST_TEST(ConvexSetIndexTest, BoundingBoxes) {
+  const ConvexSets sets = MakeSets();
+  const ConvexSetIndex dut(sets);
+  ASSERT_EQ(dut.num_sets(), ssize(sets));
+  EXPECT_EQ(dut.ambient_dimension(), 2);
+  // Set 0 is the box centered at the origin.
+  EXPECT_TRUE(CompareMatrices(dut.bounding_box_lb(0), Vector2d(-1, -0.5)));
+  EXPECT_TRUE(CompareMatrices(dut.bounding_box_ub(0), Vector2d(1, 0.5)));
+  // Set 1 is the circle of radius 0.8 centered at (0, 1.5).
+  EXPECT_TRUE(
+      CompareMatrices(dut.bounding_box_lb(1), Vector2d(-0.8, 0.7), 1e-5));
+  EXPECT_TRUE(
+      CompareMatrices(dut.bounding_box_ub(1), Vector2d(0.8, 2.3), 1e-5));
+  EXPECT_EQ(dut.set(3).MaybeGetPoint(), std::optional<VectorXd>(
+                                            Vector2d(0, 4.5)));
+  EXPECT_THROW(dut.set(ssize(sets)), std::exception);
+  EXPECT_THROW(dut.bounding_box_lb(-1), std::exception);
+}
+
+GTEST_TEST(ConvexSetIndexTest, FindContainingSets) {
+  ConvexSets sets = MakeSets();
+  // Add an unbounded half-plane x ≥ 4.
+  sets.emplace_back(HPolyhedron(Eigen::RowVector2d(-1, 0), Vector1d(-4))
+                        .Clone());
+  const ConvexSetIndex dut(sets);
+  for (double x = -1; x < 7.5; x += 0.37) {
+    for (double y = -1; y < 6; y += 0.41) {
+      const Vector2d q(x, y);
+      std::vector<int> expected;
+      for (int i = 0; i < ssize(sets); ++i) {
+        if (sets[i]->PointInSet(q, 1e-9)) {
+          expected.push_back(i);
+        }
+      }
+      EXPECT_EQ(dut.FindContainingSets(q, 1e-9), expected);
+    }
+  }
+  // The points are found.
+  const std::vector<int> at_point = dut.FindContainingSets(Vector2d(4.5, 0));
+  EXPECT_NE(std::find(at_point.begin(), at_point.end(), 12), at_point.end());
+  EXPECT_THROW(dut.FindContainingSets(Eigen::Vector3d::Zero()),
+               std::exception);
+}
+
+GTEST_TEST(ConvexSetIndexTest, Intersections) {
+  const ConvexSets sets = MakeSets();
+  const ConvexSetIndex dut(sets);
+
+  // The candidates of a query box are exactly the sets whose boxes overlap it.
+  const Vector2d lb(0.5, 0.5);
+  const Vector2d ub(2.5, 3);
+  std::vector<int> expected;
+  for (int i = 0; i < dut.num_sets(); ++i) {
+    if ((dut.bounding_box_lb(i).array() <= ub.array()).all() &&
+        (lb.array() <= dut.bounding_box_ub(i).array()).all()) {
+      expected.push_back(i);
+    }
+  }
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(dut.FindIntersectionCandidates(lb, ub), expected);
+
+  // The intersecting pairs match the brute force checks.
+  std::vector<std::pair<int, int>> expected_pairs;
+  for (int i = 0; i < ssize(sets); ++i) {
+    for (int j = i + 1; j < ssize(sets); ++j) {
+      if (sets[i]->IntersectsWith(*sets[j])) {
+        expected_pairs.emplace_back(i, j);
+      }
+    }
+  }
+  EXPECT_FALSE(expected_pairs.empty());
+  EXPECT_EQ(dut.FindIntersectingPairs(), expected_pairs);
+  EXPECT_EQ(dut.FindIntersectingPairs(Parallelism::Max()), expected_pairs);
+  EXPECT_GE(dut.FindIntersectionCandidatePairs().size(),
+            expected_pairs.size());
+}
+
+GTEST_TEST(ConvexSetIndexTest, FindNearestSet) {
+  const ConvexSets sets = MakeSets();
+  const ConvexSetIndex dut(sets);
+  const double kTol = 1e-5;
+  for (const Vector2d& q : {Vector2d(-3, -2), Vector2d(0.75, 0.75),
+                            Vector2d(10, 2), Vector2d(3, 3), Vector2d(0, 0)}) {
+    double expected_distance = std::numeric_limits<double>::infinity();
+    for (const auto& set : sets) {
+      expected_distance = std::min(expected_distance,
+                                   set->Projection(q).value().first[0]);
+    }
+    const auto nearest = dut.FindNearestSet(q);
+    ASSERT_TRUE(nearest.has_value());
+    EXPECT_NEAR(nearest->second, expected_distance, kTol);
+    EXPECT_NEAR(sets[nearest->first]->Projection(q).value().first[0],
+                expected_distance, kTol);
+  }
+}
+
+GTEST_TEST(ConvexSetIndexTest, MismatchedDimensions) {
+  ConvexSets sets = MakeSets();
+  sets.emplace_back(Point(Eigen::Vector3d::Zero()).Clone());
+  EXPECT_THROW(ConvexSetIndex{sets}, std::exception);
+}
+
+}  // namespace
+}  // namespace optimization
+}  // namespace geometry
+}  // namespace drake
@@ -350,6 +350,46 @@ GTEST_TEST(ConvexSetTest, ProjectionError) {
   EXPECT_THROW(polytope.Projection(test_point), std::exception);
 }
 
+// The batched PointsInSet agrees with PointInSet for the sets which override
+// it, and for the sets which use the default implementation.
+GTEST_TEST(ConvexSetTest, PointsInSet) {
+  const HPolyhedron hpolyhedron = HPolyhedron::MakeUnitBox(2);
+  const Hyperellipsoid hyperellipsoid =
+      Hyperellipsoid::MakeAxisAligned(Vector2d(1, 0.5), Vector2d(0.2, 0));
+  const Hyperrectangle hyperrectangle(Vector2d(-1, 0), Vector2d(0.5, 0.5));
+  const Point point(Vector2d(0.5, 0.5));
+  const VPolytope vpolytope = VPolytope::MakeUnitBox(2);
+  const AffineSubspace affine_subspace(Eigen::Vector2d(1, 1),
+                                       Eigen::Vector2d(1, 0));
+  const std::vector<const ConvexSet*> sets{&hpolyhedron,    &hyperellipsoid,
+                                           &hyperrectangle, &point,
+                                           &vpolytope,      &affine_subspace};
+
+  // clang-format off
+  const Eigen::Matrix2Xd points{{0.5, 2, -1.1, 0.9, 0.2, 1.5, 0.5},
+                                {0.5, 0, -3.0, 0.1, 0.4, 0.5, 0.5 + 1e-8}};
+  // clang-format on
+  for (const double tol : {0.0, 1e-6}) {
+    for (const ConvexSet* set : sets) {
+      const std::vector<bool> in_set = set->PointsInSet(points, tol);
+      ASSERT_EQ(ssize(in_set), points.cols());
+      for (int i = 0; i < points.cols(); ++i) {
+        EXPECT_EQ(in_set[i], set->PointInSet(points.col(i), tol));
+      }
+    }
+  }
+  EXPECT_TRUE(point.PointsInSet(points, 1e-6)[6]);
+  EXPECT_FALSE(point.PointsInSet(points)[6]);
+  EXPECT_THROW(hpolyhedron.PointsInSet(Eigen::Matrix3Xd::Zero(3, 2)),
+               std::exception);
+
+  // Zero-dimensional sets.
+  EXPECT_EQ(HPolyhedron::MakeUnitBox(0).PointsInSet(Eigen::MatrixXd(0, 3)),
+            std::vector<bool>(3, true));
+  EXPECT_EQ(VPolytope().PointsInSet(Eigen::MatrixXd(0, 2)),
+            std::vector<bool>(2, false));
+}
+
 }  // namespace
 }  // namespace optimization
 }  // namespace geometry
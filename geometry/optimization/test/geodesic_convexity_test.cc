@@ -485,6 +485,44 @@ GTEST_TEST(GeodesicConvexityTest, ComputePairwiseIntersections2) {
   }
 }
 
+// The culling of the pairs with a ConvexSetIndex of the bounding boxes finds
+// the same intersections as visiting all the pairs, which is what happens when
+// the boxes are not preprocessed.
+GTEST_TEST(GeodesicConvexityTest, ComputePairwiseIntersectionsCulling) {
+  ConvexSets sets_A;
+  ConvexSets sets_B;
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      const Eigen::Vector3d center(1.1 * i, 0.9 * j, 2.0 * (i % 3) + 0.3 * j);
+      const Eigen::Vector3d half_width(0.6, 0.5, 1.2);
+      sets_A.emplace_back(
+          Hyperrectangle(center - half_width, center + half_width).Clone());
+      const Eigen::Vector3d shift(0.4, 0.3, 0.5);
+      sets_B.emplace_back(Hyperrectangle(center + shift - 0.5 * half_width,
+                                         center + shift + 0.5 * half_width)
+                              .Clone());
+    }
+  }
+  for (const std::vector<int>& continuous_joints :
+       {std::vector<int>{}, std::vector<int>{0}, std::vector<int>{2}}) {
+    for (const bool identical : {true, false}) {
+      const ConvexSets& other = identical ? sets_A : sets_B;
+      const auto [edges, offsets] =
+          ComputePairwiseIntersections(sets_A, other, continuous_joints,
+                                       true /* preprocess_bbox */);
+      const auto [expected_edges, expected_offsets] =
+          ComputePairwiseIntersections(sets_A, other, continuous_joints,
+                                       false /* preprocess_bbox */);
+      EXPECT_FALSE(edges.empty());
+      EXPECT_EQ(edges, expected_edges);
+      ASSERT_EQ(offsets.size(), expected_offsets.size());
+      for (int k = 0; k < ssize(offsets); ++k) {
+        EXPECT_TRUE(CompareMatrices(offsets[k], expected_offsets[k], 1e-9));
+      }
+    }
+  }
+}
+
 GTEST_TEST(GeodesicConvexityTest, ContainsNullptrTest) {
   Hyperrectangle h(Vector1d(0.0), Vector1d(1.0));
   ConvexSets sets_ok = MakeConvexSets(h, h);
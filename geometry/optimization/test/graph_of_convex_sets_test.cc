@@ -1,5 +1,6 @@
 #include "drake/geometry/optimization/graph_of_convex_sets.h"
 
+#include <cmath>
 #include <forward_list>
 #include <limits>
 #include <memory>
@@ -87,6 +88,8 @@ GTEST_TEST(GraphOfConvexSetsOptionsTest, Serialize) {
   options.max_rounding_trials = 5;
   options.flow_tolerance = 0.01;
   options.rounding_seed = 5;
+  options.rounding_relative_gap = 0.1;
+  options.cache_transcription = true;
   solvers::MosekSolver mosek_solver;
   options.solver = &mosek_solver;
   options.solver_options = solvers::SolverOptions();
@@ -104,6 +107,8 @@ GTEST_TEST(GraphOfConvexSetsOptionsTest, Serialize) {
   EXPECT_EQ(deserialized.max_rounding_trials, options.max_rounding_trials);
   EXPECT_EQ(deserialized.flow_tolerance, options.flow_tolerance);
   EXPECT_EQ(deserialized.rounding_seed, options.rounding_seed);
+  EXPECT_EQ(deserialized.rounding_relative_gap, options.rounding_relative_gap);
+  EXPECT_EQ(deserialized.cache_transcription, options.cache_transcription);
   // The non-built-in types are not serialized.
   EXPECT_EQ(deserialized.solver, nullptr);
   EXPECT_EQ(deserialized.restriction_solver, nullptr);
@@ -2570,6 +2575,88 @@ TEST_F(PreprocessShortestPathTest, CheckResults) {
   }
 }
 
+GTEST_TEST(ShortestPathTest, CacheTranscription) {
+  // A ring of overlapping boxes, connected in both directions, with a source
+  // and a target point.
+  GraphOfConvexSets spp;
+  const int kNumBoxes = 6;
+  std::vector<Vertex*> boxes;
+  for (int i = 0; i < kNumBoxes; ++i) {
+    const double angle = 2 * M_PI * i / kNumBoxes;
+    const Vector2d center(2 * std::cos(angle), 2 * std::sin(angle));
+    boxes.push_back(spp.AddVertex(HPolyhedron::MakeBox(
+        center - Vector2d::Constant(1.2), center + Vector2d::Constant(1.2))));
+  }
+  Vertex* source = spp.AddVertex(Point(Vector2d(2, 0)));
+  Vertex* target = spp.AddVertex(Point(Vector2d(-2, 0.5)));
+  for (int i = 0; i < kNumBoxes; ++i) {
+    spp.AddEdge(boxes[i], boxes[(i + 1) % kNumBoxes]);
+    spp.AddEdge(boxes[i], boxes[(i + kNumBoxes - 1) % kNumBoxes]);
+  }
+  spp.AddEdge(source, boxes[0]);
+  spp.AddEdge(source, boxes[1]);
+  spp.AddEdge(boxes[3], target);
+  spp.AddEdge(boxes[4], target);
+
+  // |xu - xv|₂
+  Matrix<double, 2, 4> A;
+  A.leftCols(2) = Matrix2d::Identity();
+  A.rightCols(2) = -Matrix2d::Identity();
+  auto cost = std::make_shared<solvers::L2NormCost>(A, Vector2d::Zero());
+  for (Edge* e : spp.Edges()) {
+    e->AddCost(solvers::Binding(cost, {e->xu(), e->xv()}));
+  }
+
+  GraphOfConvexSetsOptions options;
+  options.convex_relaxation = true;
+  GraphOfConvexSetsOptions cached_options = options;
+  cached_options.cache_transcription = true;
+  // Checks that the query gives the same result with and without the cache.
+  auto expect_same_solution = [&](const Vertex& u, const Vertex& v) -> bool {
+    const auto expected = spp.SolveShortestPath(u, v, options);
+    const auto cached = spp.SolveShortestPath(u, v, cached_options);
+    EXPECT_EQ(cached.is_success(), expected.is_success());
+    if (cached.is_success() && expected.is_success()) {
+      EXPECT_NEAR(cached.get_optimal_cost(), expected.get_optimal_cost(),
+                  1e-5);
+      for (const Vertex* w : spp.Vertices()) {
+        EXPECT_EQ(w->GetSolution(cached).has_value(),
+                  w->GetSolution(expected).has_value());
+      }
+    }
+    return cached.is_success();
+  };
+
+  // Query between different sources and targets, reusing the transcription.
+  EXPECT_TRUE(expect_same_solution(*source, *target));
+  EXPECT_TRUE(expect_same_solution(*boxes[1], *boxes[4]));
+  EXPECT_TRUE(expect_same_solution(*boxes[5], *target));
+  EXPECT_TRUE(expect_same_solution(*source, *target));
+
+  // Changing the edges invalidates the cached transcription.
+  spp.RemoveVertex(boxes[2]);
+  EXPECT_TRUE(expect_same_solution(*source, *target));
+  spp.Edges().front()->AddPhiConstraint(false);
+  EXPECT_TRUE(expect_same_solution(*source, *target));
+  // Making the edges into boxes 1 and 5 infeasible leaves no path.
+  for (Edge* e : spp.Edges()) {
+    if (&e->v() == boxes[1] || &e->v() == boxes[5]) {
+      e->AddConstraint(e->xv()[0] >= 100);
+    }
+  }
+  EXPECT_FALSE(expect_same_solution(*source, *target));
+  EXPECT_TRUE(expect_same_solution(*boxes[3], *boxes[4]));
+
+  // There is only one cached transcription; switching to the mixed integer
+  // transcription replaces the cached relaxation.
+  if (MixedIntegerSolverAvailable()) {
+    options.convex_relaxation = false;
+    cached_options.convex_relaxation = false;
+    EXPECT_TRUE(expect_same_solution(*boxes[3], *boxes[4]));
+    EXPECT_TRUE(expect_same_solution(*boxes[4], *boxes[3]));
+  }
+}
+
 /* This test rounds the shortest path on a graph with two paths around an
 obstacle.
 ┌──────┐     ┌────┐     ┌────┐
@@ -2679,6 +2766,29 @@ GTEST_TEST(ShortestPathTest, RoundedSolution) {
                   rounded_result.GetSolution(edges[ii]->phi()) == 1);
     }
 
+    // The relaxation is not tight, so a zero gap never stops the rounding
+    // early, and the best path is found.
+    options.rounding_relative_gap = 0.0;
+    auto no_gap_result = spp.SolveShortestPath(*source, *target, options);
+    ASSERT_TRUE(no_gap_result.is_success());
+    EXPECT_NEAR(no_gap_result.get_optimal_cost(),
+                rounded_result.get_optimal_cost(), 1e-6);
+    // A huge gap accepts the first batch of paths; the rounded result is still
+    // a valid path, but may not be the best one.
+    options.rounding_relative_gap = 1e6;
+    auto huge_gap_result = spp.SolveShortestPath(*source, *target, options);
+    ASSERT_TRUE(huge_gap_result.is_success());
+    EXPECT_GE(huge_gap_result.get_optimal_cost(),
+              rounded_result.get_optimal_cost() - 1e-6);
+    for (const auto* e : edges) {
+      EXPECT_TRUE(huge_gap_result.GetSolution(e->phi()) == 0 ||
+                  huge_gap_result.GetSolution(e->phi()) == 1);
+    }
+    options.rounding_relative_gap = -1.0;
+    EXPECT_THROW(spp.SolveShortestPath(*source, *target, options),
+                 std::exception);
+    options.rounding_relative_gap = std::nullopt;
+
     if (!MixedIntegerSolverAvailable()) {
       return;
     }
@@ -2769,6 +2879,66 @@ GTEST_TEST(ShortestPathTest, RoundedSolution) {
   }
 }
 
+GTEST_TEST(ShortestPathTest, RoundingStopsEarly) {
+  // Two paths from the source to the target, which are symmetric (and hence
+  // split the flow) in the relaxation. Only the restriction of the path
+  // through `a` has an additional cost.
+  GraphOfConvexSets spp;
+  Vertex* source = spp.AddVertex(Point(Vector2d(0, 0)));
+  Vertex* a = spp.AddVertex(Point(Vector2d(1, 1)));
+  Vertex* b = spp.AddVertex(Point(Vector2d(1, -1)));
+  Vertex* target = spp.AddVertex(Point(Vector2d(2, 0)));
+  Edge* source_to_a = spp.AddEdge(source, a);
+  spp.AddEdge(source, b);
+  spp.AddEdge(a, target);
+  spp.AddEdge(b, target);
+
+  // |xu - xv|₂
+  Matrix<double, 2, 4> A;
+  A.leftCols(2) = Matrix2d::Identity();
+  A.rightCols(2) = -Matrix2d::Identity();
+  auto cost = std::make_shared<solvers::L2NormCost>(A, Vector2d::Zero());
+  for (Edge* e : spp.Edges()) {
+    e->AddCost(solvers::Binding(cost, {e->xu(), e->xv()}));
+  }
+  source_to_a->AddCost(10 * source_to_a->xv()[1],
+                       {Transcription::kRestriction});
+  const double kPathLength = 2 * std::sqrt(2.0);
+
+  GraphOfConvexSetsOptions options;
+  options.convex_relaxation = true;
+  options.preprocessing = false;
+  options.max_rounded_paths = 10;
+  options.parallelism = Parallelism::None();
+
+  // When every sampled path is solved, the path through b is found.
+  const auto full_result = spp.SolveShortestPath(*source, *target, options);
+  ASSERT_TRUE(full_result.is_success());
+  EXPECT_NEAR(full_result.get_optimal_cost(), kPathLength, 1e-6);
+
+  // With a huge gap, the first path that is solved is accepted. With one
+  // thread, that is the first sampled path, so for some seed the path through a
+  // is sampled first, and the rounding stops before solving the path through b.
+  options.rounding_relative_gap = 1e6;
+  std::optional<int> early_seed;
+  for (int seed = 0; seed < 20 && !early_seed.has_value(); ++seed) {
+    options.rounding_seed = seed;
+    const auto result = spp.SolveShortestPath(*source, *target, options);
+    ASSERT_TRUE(result.is_success());
+    if (result.get_optimal_cost() > kPathLength + 1) {
+      EXPECT_NEAR(result.get_optimal_cost(), kPathLength + 10, 1e-6);
+      early_seed = seed;
+    }
+  }
+  ASSERT_TRUE(early_seed.has_value());
+
+  // Without a gap, the same seed still finds the path through b.
+  options.rounding_relative_gap = std::nullopt;
+  const auto result = spp.SolveShortestPath(*source, *target, options);
+  ASSERT_TRUE(result.is_success());
+  EXPECT_NEAR(result.get_optimal_cost(), kPathLength, 1e-6);
+}
+
 /*
 ┌──────┐     ┌────┐     ┌────┐
 |source├────►│ p1 │◄───►│ p3 │─────────┐
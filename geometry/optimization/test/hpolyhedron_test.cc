@@ -1466,6 +1466,75 @@ GTEST_TEST(HPolyhedronTest, UniformSampleTest4) {
                std::exception);
 }
 
+GTEST_TEST(HPolyhedronTest, UniformSampleBatch) {
+  const HPolyhedron H =
+      HPolyhedron::MakeBox(Vector3d(-1, 0, 2), Vector3d(1, 0.5, 5));
+  const int num_chains = 20;
+  const MatrixXd start = H.ChebyshevCenter().replicate(1, num_chains);
+
+  RandomGenerator generator(1234);
+  const MatrixXd samples = H.UniformSampleBatch(&generator, start, 5);
+  ASSERT_EQ(samples.rows(), 3);
+  ASSERT_EQ(samples.cols(), num_chains);
+  for (int k = 0; k < num_chains; ++k) {
+    EXPECT_TRUE(H.PointInSet(samples.col(k)));
+    EXPECT_FALSE(CompareMatrices(samples.col(k), start.col(k), 1e-7));
+  }
+  // The chains draw from independent generators.
+  EXPECT_FALSE(CompareMatrices(samples.col(0), samples.col(1), 1e-7));
+
+  // The samples only depend on the state of the generator, and not on the
+  // parallelism.
+  RandomGenerator generator2(1234);
+  const MatrixXd samples2 = H.UniformSampleBatch(
+      &generator2, start, 5, std::nullopt, 1e-8, Parallelism::Max());
+  EXPECT_TRUE(CompareMatrices(samples, samples2));
+
+  // Chaining the batches continues the chains.
+  const MatrixXd samples3 = H.UniformSampleBatch(&generator, samples, 5);
+  for (int k = 0; k < num_chains; ++k) {
+    EXPECT_TRUE(H.PointInSet(samples3.col(k)));
+  }
+
+  // A start point outside of the set throws.
+  MatrixXd bad_start = start;
+  bad_start.col(3) << 10, 10, 10;
+  EXPECT_THROW(H.UniformSampleBatch(&generator, bad_start, 2),
+               std::invalid_argument);
+  EXPECT_THROW(H.UniformSampleBatch(&generator, start, 0), std::exception);
+  EXPECT_THROW(H.UniformSampleBatch(&generator, start.topRows(2)),
+               std::exception);
+}
+
+// Test that the batched sampling supports not-full-dimensional HPolyhedra.
+GTEST_TEST(HPolyhedronTest, UniformSampleBatchSubspace) {
+  Matrix<double, 2, 2> points;
+  // clang-format off
+  points << 0, 1,
+            0, 1;
+  // clang-format on
+  const HPolyhedron H{VPolytope(points)};
+  const MatrixXd start = Vector2d(0.5, 0.5).replicate(1, 4);
+  const MatrixXd basis = AffineSubspace(H).basis();
+
+  // Without the basis of the affine hull, the chains can't move (and a warning
+  // is logged).
+  RandomGenerator generator(1234);
+  EXPECT_TRUE(CompareMatrices(H.UniformSampleBatch(&generator, start, 10),
+                              start, 1e-7));
+
+  const MatrixXd samples = H.UniformSampleBatch(&generator, start, 10, basis);
+  for (int k = 0; k < samples.cols(); ++k) {
+    EXPECT_TRUE(H.PointInSet(samples.col(k), 1e-7));
+    EXPECT_FALSE(CompareMatrices(samples.col(k), start.col(k), 1e-7));
+  }
+
+  Matrix<double, 4, 1> bad_basis;
+  bad_basis << 0, 1, 2, 3;
+  EXPECT_THROW(H.UniformSampleBatch(&generator, start, 1, bad_basis),
+               std::exception);
+}
+
 GTEST_TEST(HPolyhedronTest, Serialize) {
   const HPolyhedron H = HPolyhedron::MakeL1Ball(3);
   const std::string yaml = yaml::SaveYamlString(H);
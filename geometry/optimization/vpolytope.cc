@@ -7,6 +7,7 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 
 #include <fmt/format.h>
@@ -19,6 +20,7 @@
 #include "drake/common/overloaded.h"
 #include "drake/geometry/optimization/affine_subspace.h"
 #include "drake/geometry/read_obj.h"
+#include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/solve.h"
 
 namespace drake {
@@ -527,58 +529,85 @@ std::optional<VectorXd> VPolytope::DoMaybeGetFeasiblePoint() const {
 
 bool VPolytope::DoPointInSet(const Eigen::Ref<const VectorXd>& x,
                              double tol) const {
-  if (vertices_.cols() == 0) {
-    return false;
-  }
+  return DoPointsInSet(x, tol)[0];
+}
 
-  // Attempt to "fail fast": Checks if a hyperplane through x, with a normal
-  // vector colinear to (x - mean(vertices)), separates the point from the
-  // VPolytope avoid solving the point containment LP. This is a heuristic,
-  // sufficient condition which can falsify that the point is in the set which
-  // works better as the point in question gets farther away.
-
-  Eigen::VectorXd vertex_mean = vertices_.rowwise().mean();
-  Eigen::VectorXd a = (x - vertex_mean).normalized();
-  double b = a.dot(x);
-  Eigen::VectorXd vals = a.transpose() * vertices_;
-  vals = vals.array() - b;
-
-  // Only allow early return if query point x is sufficiently far away from the
-  // vertex mean.
-  if ((vals.array() < -tol).all() && (x - vertex_mean).norm() > 1e-13) {
-    return false;
+std::vector<bool> VPolytope::DoPointsInSet(
+    const Eigen::Ref<const MatrixXd>& points, double tol) const {
+  std::vector<bool> result(points.cols(), false);
+  if (vertices_.cols() == 0) {
+    return result;
   }
 
   const int n = ambient_dimension();
   const int m = vertices_.cols();
   const double inf = std::numeric_limits<double>::infinity();
+  const Eigen::VectorXd vertex_mean = vertices_.rowwise().mean();
+
+  // The containment LP is only built for the first point which needs it, and
+  // is then reused for the remaining points by updating its bounds.
   // min z s.t. |(v α - x)ᵢ| ≤ z, αᵢ ≥ 0, ∑ᵢ αᵢ = 1.
   MathematicalProgram prog;
-  VectorXDecisionVariable z = prog.NewContinuousVariables<1>("z");
-  VectorXDecisionVariable alpha = prog.NewContinuousVariables(m, "a");
-  // min z
-  prog.AddLinearCost(Vector1d(1.0), z);
-  // |(v α - x)ᵢ| ≤ z as -z ≤ vᵢ α - xᵢ ≤ z as vᵢ α - z ≤ xᵢ && xᵢ ≤ vᵢ α + z
-  MatrixXd A(n, m + 1);
-  A.leftCols(m) = vertices_;
-  A.col(m) = -VectorXd::Ones(n);
-  prog.AddLinearConstraint(A, VectorXd::Constant(n, -inf), x, {alpha, z});
-  A.col(m) = VectorXd::Ones(n);
-  prog.AddLinearConstraint(A, x, VectorXd::Constant(n, inf), {alpha, z});
-  // 0 ≤ αᵢ ≤ 1.  The one is redundant, but may be better than inf for some
-  // solvers.
-  prog.AddBoundingBoxConstraint(0, 1.0, alpha);
-  // ∑ᵢ αᵢ = 1
-  prog.AddLinearEqualityConstraint(RowVectorXd::Ones(m), 1.0, alpha);
-  auto result = solvers::Solve(prog);
-  // The formulation was chosen so that it always has a feasible solution.
-  DRAKE_DEMAND(result.is_success());
-  // To decouple the solver tolerance from the requested tolerance, we solve the
-  // LP, but then evaluate the constraints ourselves.
-  // Note: The max(alpha, 0) and normalization were required for Gurobi.
-  const VectorXd alpha_sol = result.GetSolution(alpha).cwiseMax(0);
-  const VectorXd x_sol = vertices_ * alpha_sol / (alpha_sol.sum());
-  return is_approx_equal_abstol(x, x_sol, tol);
+  std::optional<Binding<solvers::LinearConstraint>> upper_constraint;
+  std::optional<Binding<solvers::LinearConstraint>> lower_constraint;
+  VectorXDecisionVariable alpha;
+  std::unique_ptr<solvers::SolverInterface> solver;
+  solvers::MathematicalProgramResult lp_result;
+  for (int i = 0; i < points.cols(); ++i) {
+    const auto x = points.col(i);
+
+    // Attempt to "fail fast": Checks if a hyperplane through x, with a normal
+    // vector colinear to (x - mean(vertices)), separates the point from the
+    // VPolytope avoid solving the point containment LP. This is a heuristic,
+    // sufficient condition which can falsify that the point is in the set
+    // which works better as the point in question gets farther away.
+    const Eigen::VectorXd a = (x - vertex_mean).normalized();
+    const double b = a.dot(x);
+    Eigen::VectorXd vals = a.transpose() * vertices_;
+    vals = vals.array() - b;
+
+    // Only allow early return if query point x is sufficiently far away from
+    // the vertex mean.
+    if ((vals.array() < -tol).all() && (x - vertex_mean).norm() > 1e-13) {
+      continue;
+    }
+
+    if (solver == nullptr) {
+      VectorXDecisionVariable z = prog.NewContinuousVariables<1>("z");
+      alpha = prog.NewContinuousVariables(m, "a");
+      // min z
+      prog.AddLinearCost(Vector1d(1.0), z);
+      // |(v α - x)ᵢ| ≤ z as -z ≤ vᵢ α - xᵢ ≤ z as
+      // vᵢ α - z ≤ xᵢ && xᵢ ≤ vᵢ α + z
+      MatrixXd A(n, m + 1);
+      A.leftCols(m) = vertices_;
+      A.col(m) = -VectorXd::Ones(n);
+      upper_constraint = prog.AddLinearConstraint(
+          A, VectorXd::Constant(n, -inf), x, {alpha, z});
+      A.col(m) = VectorXd::Ones(n);
+      lower_constraint = prog.AddLinearConstraint(
+          A, x, VectorXd::Constant(n, inf), {alpha, z});
+      // 0 ≤ αᵢ ≤ 1.  The one is redundant, but may be better than inf for
+      // some solvers.
+      prog.AddBoundingBoxConstraint(0, 1.0, alpha);
+      // ∑ᵢ αᵢ = 1
+      prog.AddLinearEqualityConstraint(RowVectorXd::Ones(m), 1.0, alpha);
+      solver = solvers::MakeSolver(solvers::ChooseBestSolver(prog));
+    } else {
+      upper_constraint->evaluator()->UpdateUpperBound(x);
+      lower_constraint->evaluator()->UpdateLowerBound(x);
+    }
+    solver->Solve(prog, std::nullopt, std::nullopt, &lp_result);
+    // The formulation was chosen so that it always has a feasible solution.
+    DRAKE_DEMAND(lp_result.is_success());
+    // To decouple the solver tolerance from the requested tolerance, we solve
+    // the LP, but then evaluate the constraints ourselves.
+    // Note: The max(alpha, 0) and normalization were required for Gurobi.
+    const VectorXd alpha_sol = lp_result.GetSolution(alpha).cwiseMax(0);
+    const VectorXd x_sol = vertices_ * alpha_sol / (alpha_sol.sum());
+    result[i] = is_approx_equal_abstol(x, x_sol, tol);
+  }
+  return result;
 }
 
 std::pair<VectorX<Variable>, std::vector<Binding<Constraint>>>
@@ -1,15 +1,22 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
 #include <algorithm>
+#include <exception>
 #include <filesystem>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
+#include <common_robotics_utilities/parallelism.hpp>
 #include <fmt/format.h>
 
 #include "drake/common/text_logging.h"
+#include "drake/common/unused.h"
 #include "drake/geometry/proximity/inflate_mesh.h"
 #include "drake/geometry/proximity/make_box_field.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
@@ -28,6 +35,7 @@
 #include "drake/geometry/proximity/make_sphere_mesh.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/polygon_to_triangle_mesh.h"
+#include "drake/geometry/proximity/proximity_disk_cache.h"
 #include "drake/geometry/proximity/tessellation_strategy.h"
 #include "drake/geometry/proximity/volume_to_surface_mesh.h"
 
@@ -87,6 +95,24 @@ bool is_primitive(const Shape& shape) {
   return result;
 }
 
+// Makes the compliant representation of a deferred Convex or Mesh.
+CompliantGeometry MakeDeferredRepresentation(
+    const std::variant<Convex, Mesh>& shape, const ProximityProperties& props) {
+  std::optional<CompliantGeometry> result = std::visit(
+      [&props](const auto& mesh_shape) {
+        return MakeCompliantRepresentation(mesh_shape, props);
+      },
+      shape);
+  DRAKE_DEMAND(result.has_value());
+  return std::move(*result);
+}
+
+// Validates the properties needed for the compliant representation of a Mesh
+// or Convex (named by `shape_name`) and returns its margin. This is defined
+// below, alongside the property validators.
+double ValidateCompliantMeshProperties(const char* shape_name,
+                                       const ProximityProperties& props);
+
 }  // namespace
 
 using std::make_unique;
@@ -136,9 +162,79 @@ bool Geometries::is_vanished(GeometryId id) const {
   return vanished_geometries_.contains(id);
 }
 
+const CompliantGeometry& Geometries::compliant_geometry(GeometryId id) const {
+  DRAKE_DEMAND(hydroelastic_type(id) == HydroelasticType::kCompliant);
+  auto iter = compliant_geometries_.find(id);
+  if (iter != compliant_geometries_.end()) {
+    return iter->second;
+  }
+  return GetOrBuild(deferred_geometries_.at(id).get());
+}
+
+bool Geometries::is_deferred(GeometryId id) const {
+  auto iter = deferred_geometries_.find(id);
+  if (iter == deferred_geometries_.end()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(iter->second->mutex);
+  return iter->second->built == nullptr;
+}
+
+void Geometries::MakeDeferredGeometries(
+    const std::vector<SortedPair<GeometryId>>& pairs,
+    Parallelism parallelism) const {
+  using common_robotics_utilities::parallelism::DegreeOfParallelism;
+  using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
+  using common_robotics_utilities::parallelism::ParallelForBackend;
+
+  if (deferred_geometries_.empty()) return;
+  std::vector<DeferredGeometry*> to_build;
+  std::unordered_set<GeometryId> seen;
+  for (const SortedPair<GeometryId>& pair : pairs) {
+    for (const GeometryId& id : {pair.first(), pair.second()}) {
+      if (seen.insert(id).second && is_deferred(id)) {
+        to_build.push_back(deferred_geometries_.at(id).get());
+      }
+    }
+  }
+  if (to_build.empty()) return;
+
+  // Each representation only reads its own deferred data, so they can all be
+  // built concurrently. Exceptions can't escape a worker thread; they are
+  // captured and the first is rethrown once every build has finished.
+  std::vector<std::exception_ptr> errors(to_build.size());
+  const auto build = [&](const int, const int64_t i) {
+    try {
+      GetOrBuild(to_build[i]);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+  DynamicParallelForIndexLoop(DegreeOfParallelism(parallelism.num_threads()),
+                              0, ssize(to_build), build,
+                              ParallelForBackend::BEST_AVAILABLE);
+
+  for (const std::exception_ptr& error : errors) {
+    if (error != nullptr) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+const CompliantGeometry& Geometries::GetOrBuild(DeferredGeometry* deferred) {
+  DRAKE_DEMAND(deferred != nullptr);
+  std::lock_guard<std::mutex> lock(deferred->mutex);
+  if (deferred->built == nullptr) {
+    deferred->built = std::make_shared<const CompliantGeometry>(
+        MakeDeferredRepresentation(deferred->shape, deferred->properties));
+  }
+  return *deferred->built;
+}
+
 void Geometries::RemoveGeometry(GeometryId id) {
   supported_geometries_.erase(id);
   compliant_geometries_.erase(id);
+  deferred_geometries_.erase(id);
   rigid_geometries_.erase(id);
 }
 
@@ -186,6 +282,31 @@ void Geometries::ImplementGeometry(const Sphere& sphere, void* user_data) {
   MakeShape(sphere, *static_cast<ReifyData*>(user_data));
 }
 
+template <typename ShapeType>
+bool Geometries::MaybeDeferShape(const ShapeType& shape,
+                                 const ReifyData& data) {
+  if constexpr (std::is_same_v<ShapeType, Convex> ||
+                std::is_same_v<ShapeType, Mesh>) {
+    if (!data.properties.GetPropertyOrDefault(kHydroGroup, kDeferConstruction,
+                                              false)) {
+      return false;
+    }
+    const double margin = ValidateCompliantMeshProperties(
+        std::is_same_v<ShapeType, Mesh> ? "Mesh" : "Convex", data.properties);
+    // The proximity engine needs the inflated mesh to bound the geometry.
+    if (margin > 0) return false;
+    DRAKE_DEMAND(hydroelastic_type(data.id) == HydroelasticType::kUndefined);
+    supported_geometries_[data.id] = HydroelasticType::kCompliant;
+    deferred_geometries_.insert(
+        {data.id,
+         std::make_shared<DeferredGeometry>(shape, data.properties)});
+    return true;
+  } else {
+    unused(shape, data);
+    return false;
+  }
+}
+
 template <typename ShapeType>
 void Geometries::MakeShape(const ShapeType& shape, const ReifyData& data) {
   switch (data.type) {
@@ -194,6 +315,7 @@ void Geometries::MakeShape(const ShapeType& shape, const ReifyData& data) {
       if (hydro_geometry) AddGeometry(data.id, std::move(*hydro_geometry));
     } break;
     case HydroelasticType::kCompliant: {
+      if (MaybeDeferShape(shape, data)) break;
       auto hydro_geometry = MakeCompliantRepresentation(shape, data.properties);
       if (hydro_geometry) {
         if (is_primitive(shape) &&
@@ -310,6 +432,87 @@ class NonNegativeDouble : public Validator<double> {
   }
 };
 
+/* Describes the inputs, other than the mesh data, that determine a compliant
+ representation computed from mesh data; see MakeProximityCacheKey(). */
+std::string MakeCompliantCacheParameters(const Vector3<double>& scale,
+                                         double hydroelastic_modulus,
+                                         double margin) {
+  return fmt::format("{} {} {} {} {}", scale.x(), scale.y(), scale.z(),
+                     hydroelastic_modulus, margin);
+}
+
+/* Makes the compliant representation of `mesh_spec`, as documented for
+ MakeCompliantRepresentation(const Mesh&, const ProximityProperties&). */
+VolumeMeshAndField MakeCompliantMeshAndField(const Mesh& mesh_spec,
+                                             double hydroelastic_modulus,
+                                             double margin) {
+  std::unique_ptr<VolumeMesh<double>> mesh;
+  std::unique_ptr<VolumeMesh<double>> inflated_mesh;
+  std::unique_ptr<VolumeMeshFieldLinear<double, double>> inflated_field;
+  std::map<int, int> split_vertices_map;
+
+  if (mesh_spec.extension() == ".vtk") {
+    // If they've explicitly provided a .vtk file, we'll treat it as it is a
+    // volume mesh. If that's not true, we'll get an error.
+    mesh = make_unique<VolumeMesh<double>>(
+        MakeVolumeMeshFromVtk<double>(mesh_spec));
+  } else {
+    // Otherwise, we'll create a compliant representation of its convex hull.
+    mesh = make_unique<VolumeMesh<double>>(MakeConvexVolumeMesh<double>(
+        MakeTriangleFromPolygonMesh(mesh_spec.GetConvexHull())));
+  }
+
+  inflated_mesh = make_unique<VolumeMesh<double>>(
+      MakeInflatedMesh(*mesh, margin, &split_vertices_map));
+
+  // N.B. The inflated mesh might have different topology than the original
+  // mesh. This makes calling MakeVolumeMeshPressureField() on the inflated mesh
+  // problematic. Instead, we use the original "non-inflated" mesh to compute
+  // a pressure field with the given margin value and apply that to the inflated
+  // mesh. If no vertices are duplicated, the mapping between the two meshes
+  // is a simple one-to-one correspondence. For duplicate vertices, we use the
+  // mapping provided by MakeInflatedMesh() assign the same pressure values to
+  // duplicated vertices as assigned to the original.
+
+  // Pressure field computed using the original mesh but with margin.
+  VolumeMeshFieldLinear<double, double> field =
+      MakeVolumeMeshPressureField(mesh.get(), hydroelastic_modulus, margin);
+
+  // The "inflated" field will contain pressure values at the original vertices
+  // and, if added by MakeInflatedMesh(), on split vertices.
+  const std::vector<double>& values = field.values();
+  std::vector<double> inflated_values(values.size() +
+                                      split_vertices_map.size());
+  std::copy(values.begin(), values.end(), inflated_values.begin());
+
+  // Copy values from their corresponding original vertex for split vertices.
+  for (auto& [v_split, v_original] : split_vertices_map) {
+    inflated_values[v_split] = values[v_original];
+  }
+
+  // Replace mesh with one that only has positive tetrahedra volumes. This
+  // doesn't change the vertex count.
+  inflated_mesh =
+      make_unique<VolumeMesh<double>>(RemoveNegativeVolumes(*inflated_mesh));
+
+  DRAKE_DEMAND(ssize(inflated_values) == inflated_mesh->num_vertices());
+
+  inflated_field = make_unique<VolumeMeshFieldLinear<double, double>>(
+      std::move(inflated_values), inflated_mesh.get(),
+      MeshGradientMode::
+          kOkOrThrow /* what MakeVolumeMeshPressureField() uses. */);
+
+  return VolumeMeshAndField{std::move(inflated_mesh),
+                            std::move(inflated_field)};
+}
+
+double ValidateCompliantMeshProperties(const char* shape_name,
+                                       const ProximityProperties& props) {
+  PositiveDouble(shape_name, "compliant").Extract(props, kHydroGroup, kElastic);
+  return NonNegativeDouble(shape_name, "compliant")
+      .Extract(props, kHydroGroup, kMargin, 0.0);
+}
+
 }  // namespace
 
 void WarnNoRigidRepresentation(std::string_view shape_type_name) {
@@ -556,25 +759,33 @@ std::optional<CompliantGeometry> MakeCompliantRepresentation(
     const Convex& convex_spec, const ProximityProperties& props) {
   const double margin = NonNegativeDouble("Convex", "compliant")
                             .Extract(props, kHydroGroup, kMargin, 0.0);
-  // For zero margin, use the pre-computed convex hull for the shape.
-  const TriangleSurfaceMesh<double> inflated_surface_mesh =
-      MakeTriangleFromPolygonMesh(
-          margin > 0 ? MakeConvexHull(convex_spec.source(),
-                                      convex_spec.scale3(), margin)
-                     : convex_spec.GetConvexHull());
-  auto inflated_mesh = make_unique<VolumeMesh<double>>(
-      MakeConvexVolumeMesh<double>(inflated_surface_mesh));
-
   const double hydroelastic_modulus =
       PositiveDouble("Convex", "compliant")
           .Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeVolumeMeshPressureField(inflated_mesh.get(), hydroelastic_modulus,
-                                  margin));
+  const std::optional<Sha256> cache_key = MakeProximityCacheKey(
+      "CompliantConvex", convex_spec.source(),
+      MakeCompliantCacheParameters(convex_spec.scale3(), hydroelastic_modulus,
+                                   margin));
+  VolumeMeshAndField result = LoadOrMakeVolumeMeshAndField(cache_key, [&]() {
+    // For zero margin, use the pre-computed convex hull for the shape.
+    const TriangleSurfaceMesh<double> inflated_surface_mesh =
+        MakeTriangleFromPolygonMesh(
+            margin > 0 ? MakeConvexHull(convex_spec.source(),
+                                        convex_spec.scale3(), margin)
+                       : convex_spec.GetConvexHull());
+    auto inflated_mesh = make_unique<VolumeMesh<double>>(
+        MakeConvexVolumeMesh<double>(inflated_surface_mesh));
+
+    auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+        MakeVolumeMeshPressureField(inflated_mesh.get(), hydroelastic_modulus,
+                                    margin));
+
+    return VolumeMeshAndField{std::move(inflated_mesh), std::move(pressure)};
+  });
 
   return CompliantGeometry(
-      CompliantMesh(std::move(inflated_mesh), std::move(pressure)));
+      CompliantMesh(std::move(result.mesh), std::move(result.field)));
 }
 
 std::optional<CompliantGeometry> MakeCompliantRepresentation(
@@ -582,67 +793,19 @@ std::optional<CompliantGeometry> MakeCompliantRepresentation(
   const double hydroelastic_modulus =
       PositiveDouble("Mesh", "compliant").Extract(props, kHydroGroup, kElastic);
 
-  std::unique_ptr<VolumeMesh<double>> mesh;
-  std::unique_ptr<VolumeMesh<double>> inflated_mesh;
-  std::unique_ptr<VolumeMeshFieldLinear<double, double>> inflated_field;
-  std::map<int, int> split_vertices_map;
-
   const double margin = NonNegativeDouble("Mesh", "compliant")
                             .Extract(props, kHydroGroup, kMargin, 0.0);
 
-  if (mesh_spec.extension() == ".vtk") {
-    // If they've explicitly provided a .vtk file, we'll treat it as it is a
-    // volume mesh. If that's not true, we'll get an error.
-    mesh = make_unique<VolumeMesh<double>>(
-        MakeVolumeMeshFromVtk<double>(mesh_spec));
-  } else {
-    // Otherwise, we'll create a compliant representation of its convex hull.
-    mesh = make_unique<VolumeMesh<double>>(MakeConvexVolumeMesh<double>(
-        MakeTriangleFromPolygonMesh(mesh_spec.GetConvexHull())));
-  }
-
-  inflated_mesh = make_unique<VolumeMesh<double>>(
-      MakeInflatedMesh(*mesh, margin, &split_vertices_map));
-
-  // N.B. The inflated mesh might have different topology than the original
-  // mesh. This makes calling MakeVolumeMeshPressureField() on the inflated mesh
-  // problematic. Instead, we use the original "non-inflated" mesh to compute
-  // a pressure field with the given margin value and apply that to the inflated
-  // mesh. If no vertices are duplicated, the mapping between the two meshes
-  // is a simple one-to-one correspondence. For duplicate vertices, we use the
-  // mapping provided by MakeInflatedMesh() assign the same pressure values to
-  // duplicated vertices as assigned to the original.
-
-  // Pressure field computed using the original mesh but with margin.
-  VolumeMeshFieldLinear<double, double> field =
-      MakeVolumeMeshPressureField(mesh.get(), hydroelastic_modulus, margin);
-
-  // The "inflated" field will contain pressure values at the original vertices
-  // and, if added by MakeInflatedMesh(), on split vertices.
-  const std::vector<double>& values = field.values();
-  std::vector<double> inflated_values(values.size() +
-                                      split_vertices_map.size());
-  std::copy(values.begin(), values.end(), inflated_values.begin());
-
-  // Copy values from their corresponding original vertex for split vertices.
-  for (auto& [v_split, v_original] : split_vertices_map) {
-    inflated_values[v_split] = values[v_original];
-  }
-
-  // Replace mesh with one that only has positive tetrahedra volumes. This
-  // doesn't change the vertex count.
-  inflated_mesh =
-      make_unique<VolumeMesh<double>>(RemoveNegativeVolumes(*inflated_mesh));
-
-  DRAKE_DEMAND(ssize(inflated_values) == inflated_mesh->num_vertices());
-
-  inflated_field = make_unique<VolumeMeshFieldLinear<double, double>>(
-      std::move(inflated_values), inflated_mesh.get(),
-      MeshGradientMode::
-          kOkOrThrow /* what MakeVolumeMeshPressureField() uses. */);
+  const std::optional<Sha256> cache_key = MakeProximityCacheKey(
+      "CompliantMesh", mesh_spec.source(),
+      MakeCompliantCacheParameters(mesh_spec.scale3(), hydroelastic_modulus,
+                                   margin));
+  VolumeMeshAndField result = LoadOrMakeVolumeMeshAndField(cache_key, [&]() {
+    return MakeCompliantMeshAndField(mesh_spec, hydroelastic_modulus, margin);
+  });
 
   return CompliantGeometry(
-      CompliantMesh(std::move(inflated_mesh), std::move(inflated_field)));
+      CompliantMesh(std::move(result.mesh), std::move(result.field)));
 }
 
 }  // namespace hydroelastic
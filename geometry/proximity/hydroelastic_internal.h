@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -10,6 +11,8 @@
 
 #include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallelism.h"
+#include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/proximity/bvh.h"
@@ -351,7 +354,25 @@ class RigidGeometry {
      RemoveGeometry().
 
  If two geometries are in contact, in order to produce the corresponding
- ContactSurface, both ids must have a valid representation in this set.  */
+ ContactSurface, both ids must have a valid representation in this set.
+
+ <h3>Deferred compliant representations</h3>
+
+ Building the compliant representation of a Mesh or Convex (a tetrahedral mesh
+ and its pressure field) is expensive, and many geometries in a large scene may
+ never come near anything. If the properties of such a geometry set the
+ ('hydroelastic', 'defer_construction') property (kDeferConstruction) to
+ `true`, MaybeAddGeometry() only validates its properties and records it as
+ compliant; the representation is built on demand, when compliant_geometry()
+ is first invoked for it (or in a batch, via MakeDeferredGeometries()).
+ Consequently, errors in the mesh data itself are reported at that later time.
+ Geometries with a positive margin are never deferred, because the proximity
+ engine needs their inflated meshes to bound them.
+
+ A deferred representation is built at most once, and then shared (as a
+ `shared_ptr<const CompliantGeometry>`) by this instance and all of its copies,
+ whichever of them builds it first. Building it is guarded by a mutex, so the
+ `const` methods remain threadsafe.  */
 class Geometries final : public ShapeReifier {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Geometries);
@@ -379,12 +400,23 @@ class Geometries final : public ShapeReifier {
    primitive). */
   bool is_vanished(GeometryId id) const;
 
-  /* Returns the representation of the compliant geometry with the given `id`.
-   @pre hydroelastic_type(id) returns HydroelasticType::kCompliant.  */
-  const CompliantGeometry& compliant_geometry(GeometryId id) const {
-    DRAKE_DEMAND(hydroelastic_type(id) == HydroelasticType::kCompliant);
-    return compliant_geometries_.at(id);
-  }
+  /* Returns the representation of the compliant geometry with the given `id`,
+   building it first if it was deferred.
+   @pre hydroelastic_type(id) returns HydroelasticType::kCompliant.
+   @throws std::exception if building a deferred representation fails.  */
+  const CompliantGeometry& compliant_geometry(GeometryId id) const;
+
+  /* Returns true iff the compliant representation of the geometry with the
+   given `id` has been deferred and not yet built.  */
+  bool is_deferred(GeometryId id) const;
+
+  /* Builds the deferred compliant representations of all geometries named in
+   `pairs` (e.g., the candidates of a broadphase query), using up to
+   `parallelism` threads. Geometries that weren't deferred, or have already
+   been built, are ignored.
+   @throws std::exception if building any of the representations fails.  */
+  void MakeDeferredGeometries(const std::vector<SortedPair<GeometryId>>& pairs,
+                              Parallelism parallelism) const;
 
   /* Returns the representation of the rigid geometry with the given `id`.
    @pre hydroelastic_type(id) returns HydroelasticType::kRigid.  */
@@ -400,7 +432,9 @@ class Geometries final : public ShapeReifier {
    representation as indicated by the `properties` and supported by the current
    hydroelastic infrastructure. No exception is thrown if the given shape is
    not supported in the current infrastructure. However, if it *is* supported,
-   but the properties are malformed, an exception will be thrown.
+   but the properties are malformed, an exception will be thrown. Compliant
+   representations of Mesh and Convex shapes may be deferred; see the class
+   documentation.
 
    @param shape         The shape to possibly represent.
    @param id            The unique identifier for the geometry.
@@ -432,9 +466,34 @@ class Geometries final : public ShapeReifier {
   void ImplementGeometry(const Mesh&, void*) override;
   void ImplementGeometry(const Sphere& sphere, void* user_data) override;
 
+  // The shape and properties of a geometry whose compliant representation has
+  // been deferred, and the representation once it has been built.
+  struct DeferredGeometry {
+    DeferredGeometry(std::variant<Convex, Mesh> shape_in,
+                     ProximityProperties properties_in)
+        : shape(std::move(shape_in)), properties(std::move(properties_in)) {}
+
+    const std::variant<Convex, Mesh> shape;
+    const ProximityProperties properties;
+    // Guards `built`.
+    std::mutex mutex;
+    std::shared_ptr<const CompliantGeometry> built;
+  };
+
+  // Returns the representation of `deferred`, building it if it hasn't been
+  // built yet.
+  // @throws std::exception if building the representation fails.
+  static const CompliantGeometry& GetOrBuild(DeferredGeometry* deferred);
+
   template <typename ShapeType>
   void MakeShape(const ShapeType& shape, const ReifyData& data);
 
+  // Records the compliant geometry with the given `id` as deferred, if its
+  // properties request it and its shape supports it. Returns true if so.
+  // @throws std::exception if the properties are malformed.
+  template <typename ShapeType>
+  bool MaybeDeferShape(const ShapeType& shape, const ReifyData& data);
+
   // Adds a representation of the compliant geometry with the given `id`.
   // @pre there is no previous representation associated with `id`.
   void AddGeometry(GeometryId id, CompliantGeometry field);
@@ -447,9 +506,16 @@ class Geometries final : public ShapeReifier {
   // the type of representation.
   std::unordered_map<GeometryId, HydroelasticType> supported_geometries_;
 
-  // The representations of all compliant geometries.
+  // The representations of all compliant geometries that were not deferred.
   std::unordered_map<GeometryId, CompliantGeometry> compliant_geometries_;
 
+  // The compliant geometries whose representations have been deferred (built
+  // or not), shared by all copies of this instance; see the class
+  // documentation. Each id is in at most one of this map and
+  // compliant_geometries_.
+  std::unordered_map<GeometryId, std::shared_ptr<DeferredGeometry>>
+      deferred_geometries_;
+
   // The representations of all rigid geometries.
   std::unordered_map<GeometryId, RigidGeometry> rigid_geometries_;
 
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <optional>
 #include <stack>
 #include <string>
 #include <utility>
@@ -22,6 +23,7 @@
 #include "drake/common/diagnostic_policy.h"
 #include "drake/common/find_resource.h"
 #include "drake/common/fmt_eigen.h"
+#include "drake/geometry/proximity/proximity_disk_cache.h"
 #include "drake/geometry/proximity/volume_mesh.h"
 #include "drake/geometry/proximity/vtk_to_volume_mesh.h"
 #include "drake/geometry/read_gltf_to_memory.h"
@@ -538,20 +540,27 @@ PolygonSurfaceMesh<double> MakeConvexHull(const MeshSource& mesh_source,
                                           const Vector3d& scale,
                                           double margin) {
   DRAKE_THROW_UNLESS(margin >= 0);
-  VertexCloud cloud = ReadVertices(mesh_source, scale);
-
-  // Hull of the input cloud of vertices.
-  const ConvexHull hull(std::move(cloud));
-
-  // We do not apply margin to planar clouds.
-  if (cloud.is_planar || margin == 0) {
-    return hull.MakePolygonSurfaceMesh();
-  }
+  // The hull only depends on the mesh data, the scale, and the margin. When
+  // enabled, reuse the hull computed by a previous process.
+  const std::optional<Sha256> cache_key = MakeProximityCacheKey(
+      "MakeConvexHull", mesh_source,
+      fmt::format("{} {} {} {}", scale.x(), scale.y(), scale.z(), margin));
+  return LoadOrMakePolygonSurfaceMesh(cache_key, [&]() {
+    VertexCloud cloud = ReadVertices(mesh_source, scale);
+
+    // Hull of the input cloud of vertices.
+    const ConvexHull hull(std::move(cloud));
+
+    // We do not apply margin to planar clouds.
+    if (cloud.is_planar || margin == 0) {
+      return hull.MakePolygonSurfaceMesh();
+    }
 
-  // Construct the hull of the half spaces moved by a "margin" amount.
-  const ConvexHull inflated_hull = hull.MakeInflatedConvexHull(margin);
+    // Construct the hull of the half spaces moved by a "margin" amount.
+    const ConvexHull inflated_hull = hull.MakeInflatedConvexHull(margin);
 
-  return inflated_hull.MakePolygonSurfaceMesh();
+    return inflated_hull.MakePolygonSurfaceMesh();
+  });
 }
 
 }  // namespace internal
@@ -0,0 +1,280 @@
+#include "drake/geometry/proximity/proximity_disk_cache.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/disk_cache.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using drake::internal::DiskCache;
+using Eigen::Vector3d;
+
+/* Incorporated into every key. Bump this whenever the serialization format, or
+ the algorithms whose results are cached, change in ways that would make
+ previously stored results incorrect. */
+constexpr int kFormatVersion = 1;
+
+/* Tags identifying the type of a stored result. */
+enum class RecordType : int {
+  kPolygonSurfaceMesh = 1,
+  kVolumeMeshAndField = 2,
+};
+
+/* Appends plain-old-data values to a byte string. The cache is per-user and
+ per-machine, so native byte order and sizes suffice. */
+class Writer {
+ public:
+  explicit Writer(RecordType type) { Write(static_cast<int>(type)); }
+
+  template <typename Scalar>
+  void Write(const Scalar& x) {
+    static_assert(std::is_trivially_copyable_v<Scalar>);
+    data_.append(reinterpret_cast<const char*>(&x), sizeof(x));
+  }
+
+  void Write(const Vector3d& p) {
+    Write(p.x());
+    Write(p.y());
+    Write(p.z());
+  }
+
+  template <typename Scalar>
+  void Write(const std::vector<Scalar>& values) {
+    Write(static_cast<int>(values.size()));
+    for (const Scalar& x : values) {
+      Write(x);
+    }
+  }
+
+  std::string Release() { return std::move(data_); }
+
+ private:
+  std::string data_;
+};
+
+/* Reads back the values appended by a Writer. Every Read() returns false
+ (leaving the reader in an unspecified state) if the data is exhausted or
+ malformed. */
+class Reader {
+ public:
+  explicit Reader(std::string_view data) : data_(data) {}
+
+  bool ReadHeader(RecordType type) {
+    int tag{};
+    return Read(&tag) && tag == static_cast<int>(type);
+  }
+
+  template <typename Scalar>
+  bool Read(Scalar* x) {
+    static_assert(std::is_trivially_copyable_v<Scalar>);
+    if (data_.size() < sizeof(Scalar)) {
+      return false;
+    }
+    std::memcpy(x, data_.data(), sizeof(Scalar));
+    data_.remove_prefix(sizeof(Scalar));
+    return true;
+  }
+
+  bool Read(Vector3d* p) {
+    return Read(&p->x()) && Read(&p->y()) && Read(&p->z());
+  }
+
+  template <typename Scalar>
+  bool Read(std::vector<Scalar>* values) {
+    int size{};
+    if (!Read(&size) || size < 0) {
+      return false;
+    }
+    // Every value occupies at least one byte; guard against absurd sizes
+    // before allocating.
+    if (data_.size() < static_cast<size_t>(size)) {
+      return false;
+    }
+    values->resize(size);
+    for (Scalar& x : *values) {
+      if (!Read(&x)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool at_end() const { return data_.empty(); }
+
+ private:
+  std::string_view data_;
+};
+
+std::string Serialize(const PolygonSurfaceMesh<double>& mesh) {
+  Writer writer(RecordType::kPolygonSurfaceMesh);
+  writer.Write(mesh.face_data());
+  writer.Write(static_cast<int>(mesh.num_vertices()));
+  for (int v = 0; v < mesh.num_vertices(); ++v) {
+    writer.Write(mesh.vertex(v));
+  }
+  return writer.Release();
+}
+
+std::optional<PolygonSurfaceMesh<double>> DeserializePolygonSurfaceMesh(
+    std::string_view data) {
+  Reader reader(data);
+  std::vector<int> face_data;
+  std::vector<Vector3d> vertices;
+  if (!reader.ReadHeader(RecordType::kPolygonSurfaceMesh) ||
+      !reader.Read(&face_data) || !reader.Read(&vertices) ||
+      !reader.at_end()) {
+    return std::nullopt;
+  }
+  // Validate the face encoding ({n, v₀, ..., vₙ₋₁}, repeated) so that a
+  // corrupt entry can't index out of bounds.
+  const int num_vertices = ssize(vertices);
+  for (int i = 0; i < ssize(face_data);) {
+    const int n = face_data[i];
+    if (n < 3 || i + n >= ssize(face_data)) {
+      return std::nullopt;
+    }
+    for (int j = 1; j <= n; ++j) {
+      if (face_data[i + j] < 0 || face_data[i + j] >= num_vertices) {
+        return std::nullopt;
+      }
+    }
+    i += n + 1;
+  }
+  return PolygonSurfaceMesh<double>(std::move(face_data), std::move(vertices));
+}
+
+std::string Serialize(const VolumeMeshAndField& mesh_and_field) {
+  const VolumeMesh<double>& mesh = *mesh_and_field.mesh;
+  std::vector<int> indices;
+  indices.reserve(4 * mesh.num_elements());
+  for (const VolumeElement& element : mesh.tetrahedra()) {
+    for (int i = 0; i < 4; ++i) {
+      indices.push_back(element.vertex(i));
+    }
+  }
+  Writer writer(RecordType::kVolumeMeshAndField);
+  writer.Write(indices);
+  writer.Write(mesh.vertices());
+  writer.Write(mesh_and_field.field->values());
+  return writer.Release();
+}
+
+std::optional<VolumeMeshAndField> DeserializeVolumeMeshAndField(
+    std::string_view data) {
+  Reader reader(data);
+  std::vector<int> indices;
+  std::vector<Vector3d> vertices;
+  std::vector<double> values;
+  if (!reader.ReadHeader(RecordType::kVolumeMeshAndField) ||
+      !reader.Read(&indices) || !reader.Read(&vertices) ||
+      !reader.Read(&values) || !reader.at_end() || indices.size() % 4 != 0 ||
+      values.size() != vertices.size()) {
+    return std::nullopt;
+  }
+  const int num_elements = ssize(indices) / 4;
+  const int num_vertices = ssize(vertices);
+  std::vector<VolumeElement> elements;
+  elements.reserve(num_elements);
+  for (int e = 0; e < num_elements; ++e) {
+    const int* v = &indices[4 * e];
+    for (int i = 0; i < 4; ++i) {
+      if (v[i] < 0 || v[i] >= num_vertices) {
+        return std::nullopt;
+      }
+    }
+    elements.emplace_back(v);
+  }
+  VolumeMeshAndField result;
+  result.mesh = std::make_unique<VolumeMesh<double>>(std::move(elements),
+                                                     std::move(vertices));
+  result.field = std::make_unique<VolumeMeshFieldLinear<double, double>>(
+      std::move(values), result.mesh.get(), MeshGradientMode::kOkOrThrow);
+  return result;
+}
+
+/* The shared implementation of the LoadOrMake*() functions. */
+template <typename Result, typename Deserializer>
+Result LoadOrMake(const std::optional<Sha256>& key,
+                  const std::function<Result()>& make,
+                  const Deserializer& deserialize) {
+  if (!key.has_value()) {
+    return make();
+  }
+  const DiskCache cache("proximity");
+  if (std::optional<std::string> data = cache.Load(*key)) {
+    if (std::optional<Result> result = deserialize(*data)) {
+      return std::move(*result);
+    }
+    log()->debug("Ignoring malformed proximity cache entry {}",
+                 key->to_string());
+  }
+  Result result = make();
+  cache.Store(*key, Serialize(result));
+  return result;
+}
+
+}  // namespace
+
+bool IsProximityDiskCacheEnabled() {
+  const char* const value = std::getenv("DRAKE_PROXIMITY_DISK_CACHE");
+  if (value == nullptr) {
+    return false;
+  }
+  const std::string_view setting(value);
+  return !setting.empty() && setting != "0";
+}
+
+std::optional<Sha256> MakeProximityCacheKey(std::string_view operation,
+                                            const MeshSource& mesh_source,
+                                            std::string_view parameters) {
+  if (!IsProximityDiskCacheEnabled()) {
+    return std::nullopt;
+  }
+  if (mesh_source.extension() != ".obj" && mesh_source.extension() != ".vtk") {
+    return std::nullopt;
+  }
+  Sha256 contents;
+  if (mesh_source.is_path()) {
+    std::ifstream input(mesh_source.path(), std::ios::binary);
+    if (!input) {
+      return std::nullopt;
+    }
+    contents = Sha256::Checksum(&input);
+    if (input.bad()) {
+      return std::nullopt;
+    }
+  } else {
+    contents = mesh_source.in_memory().mesh_file.sha256();
+  }
+  return Sha256::Checksum(fmt::format("{}\n{}\n{}\n{}\n{}", kFormatVersion,
+                                      operation, mesh_source.extension(),
+                                      contents.to_string(), parameters));
+}
+
+PolygonSurfaceMesh<double> LoadOrMakePolygonSurfaceMesh(
+    const std::optional<Sha256>& key,
+    const std::function<PolygonSurfaceMesh<double>()>& make) {
+  return LoadOrMake(key, make, &DeserializePolygonSurfaceMesh);
+}
+
+VolumeMeshAndField LoadOrMakeVolumeMeshAndField(
+    const std::optional<Sha256>& key,
+    const std::function<VolumeMeshAndField()>& make) {
+  return LoadOrMake(key, make, &DeserializeVolumeMeshAndField);
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
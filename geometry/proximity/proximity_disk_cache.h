@@ -0,0 +1,86 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "drake/common/sha256.h"
+#include "drake/geometry/mesh_source.h"
+#include "drake/geometry/proximity/polygon_surface_mesh.h"
+#include "drake/geometry/proximity/volume_mesh.h"
+#include "drake/geometry/proximity/volume_mesh_field.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* @name Persistent proximity cache
+
+ Convex hulls and hydroelastic pressure fields are expensive to compute and
+ are recomputed, identically, every time a process registers the same mesh.
+ These functions let those results be shared across processes through a
+ content-addressed DiskCache in the "proximity" subdirectory of the Drake cache
+ (see FindOrCreateCache()).
+
+ The cache is opt-in: it is only used when the environment variable
+ DRAKE_PROXIMITY_DISK_CACHE is set to a non-empty value other than "0". When
+ it is not, MakeProximityCacheKey() returns nullopt and the LoadOrMake*()
+ functions simply invoke `make`.
+
+ Only successful computations are stored, so errors (and any warnings emitted
+ along the way) are reported anew by each process.
+
+ The entries are files named by their key in ~/.cache/drake/proximity, or
+ $XDG_CACHE_HOME/drake/proximity when that variable is set (on macOS,
+ /private/var/tmp/.cache_$USER/drake/proximity). The cache has no size bound
+ and never evicts entries: an entry is about as large as the mesh or pressure
+ field it stores, and entries for meshes that are no longer used (or stored by
+ older versions of Drake) remain until they are removed by hand.
+ Deleting the directory, or any of its files, is always safe, even while
+ processes are using the cache; the affected results are simply recomputed. */
+//@{
+
+/* Reports whether the environment enables the proximity disk cache. */
+bool IsProximityDiskCacheEnabled();
+
+/* Returns the key for the result of the computation named `operation` on the
+ contents of `mesh_source`, with the remaining inputs of the computation
+ described by `parameters`. The key depends on the contents of the mesh data,
+ not its name, so renamed or in-memory copies of a mesh share results.
+
+ Returns nullopt if the cache is disabled, if the mesh data can't be read, or
+ if the geometry isn't fully determined by the mesh file itself (i.e., for
+ anything other than .obj and .vtk data; e.g., .gltf files can reference
+ external buffers). */
+std::optional<Sha256> MakeProximityCacheKey(std::string_view operation,
+                                            const MeshSource& mesh_source,
+                                            std::string_view parameters);
+
+/* Returns the mesh stored under `key` if there is one; otherwise returns
+ `make()`, storing it under `key`. If `key` is nullopt, simply returns
+ `make()`. */
+PolygonSurfaceMesh<double> LoadOrMakePolygonSurfaceMesh(
+    const std::optional<Sha256>& key,
+    const std::function<PolygonSurfaceMesh<double>()>& make);
+
+/* A tetrahedral mesh and a linear field defined on it. The field aliases the
+ mesh. */
+struct VolumeMeshAndField {
+  std::unique_ptr<VolumeMesh<double>> mesh;
+  std::unique_ptr<VolumeMeshFieldLinear<double, double>> field;
+};
+
+/* The VolumeMeshAndField analog of LoadOrMakePolygonSurfaceMesh(). Only the
+ mesh and the field values are stored; a loaded field recomputes its gradients
+ with MeshGradientMode::kOkOrThrow.
+ @pre The result of `make()` has non-null members. */
+VolumeMeshAndField LoadOrMakeVolumeMeshAndField(
+    const std::optional<Sha256>& key,
+    const std::function<VolumeMeshAndField()>& make);
+
+//@}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -7,6 +7,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -536,6 +537,122 @@ GTEST_TEST(Hydroelastic, RemoveGeometry) {
   }
 }
 
+// Compliant Mesh and Convex representations can be deferred until they are
+// first needed.
+GTEST_TEST(Hydroelastic, DeferredConstruction) {
+  const Mesh mesh(
+      FindResourceOrThrow("drake/geometry/test/non_convex_mesh.vtk"), 2.0);
+  const Convex convex(
+      FindResourceOrThrow("drake/geometry/test/octahedron.obj"), 2.0);
+  ProximityProperties properties;
+  AddCompliantHydroelasticProperties(1.0, 1e8, &properties);
+  ProximityProperties deferred_properties(properties);
+  deferred_properties.AddProperty(kHydroGroup, kDeferConstruction, true);
+
+  Geometries geometries;
+  const GeometryId eager_id = GeometryId::get_new_id();
+  const GeometryId mesh_id = GeometryId::get_new_id();
+  const GeometryId convex_id = GeometryId::get_new_id();
+  const GeometryId sphere_id = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(mesh, eager_id, properties);
+  geometries.MaybeAddGeometry(mesh, mesh_id, deferred_properties);
+  geometries.MaybeAddGeometry(convex, convex_id, deferred_properties);
+  // Primitives are cheap (and may vanish); they are never deferred.
+  geometries.MaybeAddGeometry(Sphere(0.5), sphere_id, deferred_properties);
+
+  EXPECT_FALSE(geometries.is_deferred(eager_id));
+  EXPECT_TRUE(geometries.is_deferred(mesh_id));
+  EXPECT_TRUE(geometries.is_deferred(convex_id));
+  EXPECT_FALSE(geometries.is_deferred(sphere_id));
+  for (const GeometryId& id : {eager_id, mesh_id, convex_id, sphere_id}) {
+    EXPECT_EQ(geometries.hydroelastic_type(id), HydroelasticType::kCompliant);
+  }
+
+  // Copies carry the deferred geometries.
+  const Geometries copy(geometries);
+  EXPECT_TRUE(copy.is_deferred(mesh_id));
+
+  // Accessing a deferred geometry builds it, with the same result as building
+  // it up front.
+  const CompliantGeometry& deferred_mesh =
+      geometries.compliant_geometry(mesh_id);
+  EXPECT_FALSE(geometries.is_deferred(mesh_id));
+  EXPECT_TRUE(deferred_mesh.mesh().Equal(
+      geometries.compliant_geometry(eager_id).mesh()));
+  EXPECT_EQ(deferred_mesh.pressure_field().values(),
+            geometries.compliant_geometry(eager_id).pressure_field().values());
+
+  // The copy shares the representation that was built.
+  EXPECT_FALSE(copy.is_deferred(mesh_id));
+  EXPECT_EQ(&copy.compliant_geometry(mesh_id), &deferred_mesh);
+
+  // Geometries can also be built in a batch, for pairs of candidates. Those
+  // that weren't deferred, or have already been built, are ignored.
+  EXPECT_TRUE(copy.is_deferred(convex_id));
+  copy.MakeDeferredGeometries(
+      {{mesh_id, convex_id}, {eager_id, sphere_id}, {mesh_id, sphere_id}},
+      Parallelism(2));
+  EXPECT_FALSE(copy.is_deferred(convex_id));
+  EXPECT_FALSE(geometries.is_deferred(convex_id));
+  EXPECT_EQ(&geometries.compliant_geometry(convex_id),
+            &copy.compliant_geometry(convex_id));
+
+  // Concurrent accesses build a deferred geometry once, and all see it.
+  const GeometryId concurrent_id = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(convex, concurrent_id, deferred_properties);
+  std::vector<const CompliantGeometry*> accessed(4);
+  {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < ssize(accessed); ++i) {
+      threads.emplace_back([&geometries, &accessed, concurrent_id, i]() {
+        accessed[i] = &geometries.compliant_geometry(concurrent_id);
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+  for (const CompliantGeometry* geometry : accessed) {
+    EXPECT_EQ(geometry, accessed.front());
+  }
+
+  // A geometry with a margin needs its inflated mesh immediately.
+  ProximityProperties margin_properties(deferred_properties);
+  margin_properties.AddProperty(kHydroGroup, kMargin, 0.01);
+  const GeometryId margin_id = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(mesh, margin_id, margin_properties);
+  EXPECT_FALSE(geometries.is_deferred(margin_id));
+
+  // Malformed properties are still reported at registration.
+  ProximityProperties bad_properties(deferred_properties);
+  bad_properties.UpdateProperty(kHydroGroup, kElastic, -1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometries.MaybeAddGeometry(mesh, GeometryId::get_new_id(),
+                                  bad_properties),
+      ".*compliant Mesh.*must be positive.*");
+
+  // Deferred geometries can be removed before they're built.
+  const GeometryId removed_id = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(convex, removed_id, deferred_properties);
+  ASSERT_TRUE(geometries.is_deferred(removed_id));
+  geometries.RemoveGeometry(removed_id);
+  EXPECT_FALSE(geometries.is_deferred(removed_id));
+  EXPECT_EQ(geometries.hydroelastic_type(removed_id),
+            HydroelasticType::kUndefined);
+
+  // Errors in the mesh data are reported when the geometry is built.
+  const GeometryId bad_mesh_id = GeometryId::get_new_id();
+  geometries.MaybeAddGeometry(
+      Mesh(FindResourceOrThrow("drake/geometry/test/non_convex_mesh.vtk"),
+           1e-8),
+      bad_mesh_id, deferred_properties);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometries.MakeDeferredGeometries({{bad_mesh_id, eager_id}},
+                                        Parallelism(2)),
+      ".*cannot compute gradient.*");
+  EXPECT_TRUE(geometries.is_deferred(bad_mesh_id));
+}
+
 class HydroelasticRigidGeometryTest : public ::testing::Test {
  protected:
   /* Creates a simple set of properties for generating rigid geometry. */
@@ -0,0 +1,162 @@
+#include "drake/geometry/proximity/proximity_disk_cache.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/disk_cache.h"
+#include "drake/common/find_resource.h"
+#include "drake/common/memory_file.h"
+#include "drake/common/test_utilities/set_env.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using drake::internal::DiskCache;
+using Eigen::Vector3d;
+using test::SetEnv;
+
+constexpr char kEnvVar[] = "DRAKE_PROXIMITY_DISK_CACHE";
+
+MeshSource MakeSource(const std::string& resource) {
+  return MeshSource(FindResourceOrThrow(resource));
+}
+
+// A tetrahedron, as a polygonal surface.
+PolygonSurfaceMesh<double> MakeTetrahedronSurface() {
+  return PolygonSurfaceMesh<double>(
+      {3, 0, 2, 1, 3, 0, 1, 3, 3, 0, 3, 2, 3, 1, 2, 3},
+      {Vector3d::Zero(), Vector3d::UnitX(), Vector3d::UnitY(),
+       Vector3d::UnitZ()});
+}
+
+// A tetrahedron, with a linear field that is zero on all but one vertex.
+VolumeMeshAndField MakeTetrahedronField() {
+  VolumeMeshAndField result;
+  result.mesh = std::make_unique<VolumeMesh<double>>(
+      std::vector<VolumeElement>{{0, 1, 2, 3}},
+      std::vector<Vector3d>{Vector3d::Zero(), Vector3d::UnitX(),
+                            Vector3d::UnitY(), Vector3d::UnitZ()});
+  result.field = std::make_unique<VolumeMeshFieldLinear<double, double>>(
+      std::vector<double>{1.0, 0.0, 0.0, 0.0}, result.mesh.get());
+  return result;
+}
+
+GTEST_TEST(ProximityDiskCacheTest, Enabled) {
+  {
+    const SetEnv env(kEnvVar, std::nullopt);
+    EXPECT_FALSE(IsProximityDiskCacheEnabled());
+  }
+  {
+    const SetEnv env(kEnvVar, "");
+    EXPECT_FALSE(IsProximityDiskCacheEnabled());
+  }
+  {
+    const SetEnv env(kEnvVar, "0");
+    EXPECT_FALSE(IsProximityDiskCacheEnabled());
+  }
+  {
+    const SetEnv env(kEnvVar, "1");
+    EXPECT_TRUE(IsProximityDiskCacheEnabled());
+  }
+}
+
+GTEST_TEST(ProximityDiskCacheTest, Keys) {
+  const std::string obj = "drake/geometry/test/quad_cube.obj";
+  {
+    const SetEnv env(kEnvVar, std::nullopt);
+    EXPECT_FALSE(MakeProximityCacheKey("op", MakeSource(obj), "1").has_value());
+  }
+
+  const SetEnv env(kEnvVar, "1");
+  const std::optional<Sha256> key =
+      MakeProximityCacheKey("op", MakeSource(obj), "1");
+  ASSERT_TRUE(key.has_value());
+
+  // The key depends on the contents, not the name, of the mesh data.
+  const MeshSource in_memory(
+      InMemoryMesh{.mesh_file = MemoryFile::Make(FindResourceOrThrow(obj))});
+  EXPECT_EQ(MakeProximityCacheKey("op", in_memory, "1"), key);
+  EXPECT_NE(MakeProximityCacheKey(
+                "op", MakeSource("drake/geometry/test/octahedron.obj"), "1"),
+            key);
+
+  // The key depends on the operation and the parameters.
+  EXPECT_NE(MakeProximityCacheKey("other", MakeSource(obj), "1"), key);
+  EXPECT_NE(MakeProximityCacheKey("op", MakeSource(obj), "2"), key);
+
+  // Volume meshes are supported.
+  EXPECT_TRUE(MakeProximityCacheKey(
+                  "op", MakeSource("drake/geometry/test/one_tetrahedron.vtk"),
+                  "1")
+                  .has_value());
+
+  // Missing files and unsupported formats are not.
+  EXPECT_FALSE(
+      MakeProximityCacheKey("op", MeshSource("/no/such/file.obj"), "1")
+          .has_value());
+  EXPECT_FALSE(MakeProximityCacheKey(
+                   "op",
+                   MeshSource(InMemoryMesh{
+                       .mesh_file = MemoryFile("{}", ".gltf", "hint")}),
+                   "1")
+                   .has_value());
+}
+
+GTEST_TEST(ProximityDiskCacheTest, PolygonSurfaceMesh) {
+  int num_made = 0;
+  auto make = [&num_made]() {
+    ++num_made;
+    return MakeTetrahedronSurface();
+  };
+  const PolygonSurfaceMesh<double> expected = MakeTetrahedronSurface();
+
+  // Without a key, every call computes the result.
+  EXPECT_TRUE(LoadOrMakePolygonSurfaceMesh(std::nullopt, make).Equal(expected));
+  EXPECT_TRUE(LoadOrMakePolygonSurfaceMesh(std::nullopt, make).Equal(expected));
+  EXPECT_EQ(num_made, 2);
+
+  // With a key, only the first call does.
+  num_made = 0;
+  const Sha256 key = Sha256::Checksum("PolygonSurfaceMesh");
+  EXPECT_TRUE(LoadOrMakePolygonSurfaceMesh(key, make).Equal(expected));
+  EXPECT_TRUE(LoadOrMakePolygonSurfaceMesh(key, make).Equal(expected));
+  EXPECT_EQ(num_made, 1);
+
+  // A corrupt entry is recomputed (and replaced).
+  DiskCache("proximity").Store(key, "corrupt");
+  EXPECT_TRUE(LoadOrMakePolygonSurfaceMesh(key, make).Equal(expected));
+  EXPECT_TRUE(LoadOrMakePolygonSurfaceMesh(key, make).Equal(expected));
+  EXPECT_EQ(num_made, 2);
+}
+
+GTEST_TEST(ProximityDiskCacheTest, VolumeMeshAndField) {
+  int num_made = 0;
+  auto make = [&num_made]() {
+    ++num_made;
+    return MakeTetrahedronField();
+  };
+  const VolumeMeshAndField expected = MakeTetrahedronField();
+
+  const Sha256 key = Sha256::Checksum("VolumeMeshAndField");
+  for (int i = 0; i < 2; ++i) {
+    const VolumeMeshAndField dut = LoadOrMakeVolumeMeshAndField(key, make);
+    ASSERT_NE(dut.mesh, nullptr);
+    ASSERT_NE(dut.field, nullptr);
+    EXPECT_TRUE(dut.mesh->Equal(*expected.mesh));
+    EXPECT_EQ(&dut.field->mesh(), dut.mesh.get());
+    EXPECT_EQ(dut.field->values(), expected.field->values());
+    EXPECT_EQ(dut.field->EvaluateGradient(0),
+              expected.field->EvaluateGradient(0));
+  }
+  EXPECT_EQ(num_made, 1);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -17,6 +17,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/string_unordered_map.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/collisions_exist_callback.h"
@@ -223,6 +224,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     mesh_distance_boundary_cahe_ = other.mesh_distance_boundary_cahe_;
     convex_hull_cache_ = other.convex_hull_cache_;
     geometry_to_hull_key_ = other.geometry_to_hull_key_;
+    hydroelastic_build_parallelism_ = other.hydroelastic_build_parallelism_;
     dynamic_tree_.clear();
     dynamic_objects_.clear();
     anchored_tree_.clear();
@@ -275,6 +277,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     engine->convex_hull_cache_ = this->convex_hull_cache_;
     engine->geometry_to_hull_key_ = this->geometry_to_hull_key_;
     engine->distance_tolerance_ = this->distance_tolerance_;
+    engine->hydroelastic_build_parallelism_ =
+        this->hydroelastic_build_parallelism_;
 
     return engine;
   }
@@ -465,6 +469,14 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_hydroelastic_build_parallelism(Parallelism parallelism) {
+    hydroelastic_build_parallelism_ = parallelism;
+  }
+
+  Parallelism hydroelastic_build_parallelism() const {
+    return hydroelastic_build_parallelism_;
+  }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
@@ -792,6 +804,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       HydroelasticContactRepresentation representation,
       const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
     std::vector<SortedPair<GeometryId>> candidates = FindCollisionCandidates();
+    // Build any deferred compliant representations the candidates need, all at
+    // once, so that they can be built concurrently.
+    hydroelastic_geometries_.MakeDeferredGeometries(
+        candidates, hydroelastic_build_parallelism_);
 
     vector<ContactSurface<T>> surfaces;
     // All these quantities are aliased in the calculator.
@@ -827,6 +843,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     DRAKE_DEMAND(point_pairs != nullptr);
 
     std::vector<SortedPair<GeometryId>> candidates = FindCollisionCandidates();
+    // Build any deferred compliant representations the candidates need, all at
+    // once, so that they can be built concurrently.
+    hydroelastic_geometries_.MakeDeferredGeometries(
+        candidates, hydroelastic_build_parallelism_);
 
     // All these quantities are aliased.
     hydroelastic::ContactCalculator<T> calculator{
@@ -1298,6 +1318,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
 
+  // @see ProximityEngine::set_hydroelastic_build_parallelism().
+  Parallelism hydroelastic_build_parallelism_{Parallelism::None()};
+
   // All of the hydroelastic representations of supported geometries -- this
   // can get quite large based on mesh resolution.
   hydroelastic::Geometries hydroelastic_geometries_;
@@ -1444,6 +1467,17 @@ double ProximityEngine<T>::distance_tolerance() const {
   return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_hydroelastic_build_parallelism(
+    Parallelism parallelism) {
+  impl_->set_hydroelastic_build_parallelism(parallelism);
+}
+
+template <typename T>
+Parallelism ProximityEngine<T>::hydroelastic_build_parallelism() const {
+  return impl_->hydroelastic_build_parallelism();
+}
+
 template <typename T>
 template <typename U>
 std::unique_ptr<ProximityEngine<U>> ProximityEngine<T>::ToScalarType() const {
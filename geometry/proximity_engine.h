@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -186,6 +187,14 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /* Compliant hydroelastic representations can be deferred until a contact
+   query first needs them (see hydroelastic::Geometries). The deferred
+   representations needed by a query are then built using up to this many
+   threads. By default, they are built serially.  */
+  void set_hydroelastic_build_parallelism(Parallelism parallelism);
+
+  Parallelism hydroelastic_build_parallelism() const;
+
   //@}
 
   /* Updates the poses for all of the _dynamic_ geometries in the engine.
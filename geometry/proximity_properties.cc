@@ -19,6 +19,7 @@ const char* const kRezHint = "resolution_hint";
 const char* const kComplianceType = "compliance_type";
 const char* const kSlabThickness = "slab_thickness";
 const char* const kMargin = "margin";
+const char* const kDeferConstruction = "defer_construction";
 
 namespace {
 
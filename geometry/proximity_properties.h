@@ -71,6 +71,12 @@ extern const char* const kSlabThickness;   ///< Slab thickness property name
                                            ///< (for half spaces).
 extern const char* const kMargin;          ///< Margin for hydroelastic contact.
 
+/* Defer construction property name. A boolean; when true, the compliant
+ representation of a Mesh or Convex is built by the first contact query that
+ needs it, rather than when the geometry is added. See
+ AddCompliantHydroelasticProperties() for details.  */
+extern const char* const kDeferConstruction;
+
 //@}
 
 // TODO(SeanCurtis-TRI): Update this to have an additional classification: kBoth
@@ -156,7 +162,23 @@ void AddRigidHydroelasticProperties(ProximityProperties* properties);
  @throws std::exception      If `properties` already has properties with the
                              names that this function would need to add.
  @pre 0 < `resolution_hint` < ∞, 0 < `hydroelastic_modulus`, and `properties`
-      is not nullptr. */
+      is not nullptr.
+
+ <h3>Deferred construction</h3>
+
+ The compliant representation is normally built when the geometry is added to
+ SceneGraph. For a Mesh or Convex this means tetrahedralizing the shape, which
+ is expensive; in a large scene, many such geometries may never touch
+ anything. Adding the boolean property ("hydroelastic", "defer_construction")
+ with the value `true` to `properties` postpones building the representation
+ until a contact query first needs it, i.e., until the geometry's bounding
+ volume overlaps that of another geometry it can collide with. A geometry that
+ never comes near another one is never built. The deferred representations
+ that one query needs are built together, using up to
+ SceneGraphConfig::hydroelastic_build_threads threads. Contact results are the
+ same as without deferral, but errors in the mesh data are only reported when
+ the representation is built. The property is ignored for other shapes and for
+ geometries with a positive margin. */
 void AddCompliantHydroelasticProperties(double resolution_hint,
                                         double hydroelastic_modulus,
                                         ProximityProperties* properties);
@@ -9,6 +9,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/geometry_instance.h"
 #include "drake/geometry/geometry_state.h"
@@ -89,8 +90,9 @@ class GeometryStateValue final : public Value<GeometryState<T>> {
  Scene graph's "model" contains whatever geometry and properties were specified
  by model file parsing and explicit method calls. When a context is created,
  the default values from SceneGraphConfig::DefaultProximityProperties are
- applied to all geometry. Call the resulting GeometryState object the
- "augmented model".
+ applied to all geometry, and the rest of the configuration is passed to the
+ proximity engine. Call the resulting GeometryState object the "augmented
+ model".
 
  Creating the augmented model can be expensive; users that allocate multiple
  contexts from an identical underlying model and configuration should not have
@@ -147,6 +149,8 @@ class SceneGraph<T>::Hub {
       // Our cache was out-of-date, so we need to refresh it.
       auto result = std::make_unique<GeometryState<T>>(model_);
       result->ApplyProximityDefaults(config_.default_proximity_properties);
+      result->set_hydroelastic_build_parallelism(
+          Parallelism(config_.hydroelastic_build_threads));
       augmented_model_cache_ =
           std::make_unique<const GeometryState<T>>(*result);
       return result;
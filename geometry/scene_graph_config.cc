@@ -97,6 +97,8 @@ void DefaultProximityProperties::ValidateOrThrow() const {
 
 void SceneGraphConfig::ValidateOrThrow() const {
   default_proximity_properties.ValidateOrThrow();
+  ThrowUnlessAbsentOr("hydroelastic_build_threads", hydroelastic_build_threads,
+                      kPositive);
 }
 
 }  // namespace geometry
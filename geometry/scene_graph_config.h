@@ -166,12 +166,20 @@ struct SceneGraphConfig {
   template <typename Archive>
   void Serialize(Archive* a) {
     a->Visit(DRAKE_NVP(default_proximity_properties));
+    a->Visit(DRAKE_NVP(hydroelastic_build_threads));
   }
 
   /** Provides SceneGraph-wide contact material values to use when none have
   been otherwise specified. */
   DefaultProximityProperties default_proximity_properties;
 
+  /** The maximum number of threads used to build the compliant hydroelastic
+  representations whose construction was deferred (see
+  AddCompliantHydroelasticProperties()). A contact query builds the deferred
+  representations it needs all at once, in parallel when this is greater than
+  one. Must be positive; the default builds them serially. */
+  int hydroelastic_build_threads{1};
+
   /** Throws if the values are inconsistent. */
   void ValidateOrThrow() const;
 };
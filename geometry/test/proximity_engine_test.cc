@@ -78,6 +78,11 @@ class ProximityEngineTester {
     return engine.hydroelastic_geometries().hydroelastic_type(id);
   }
 
+  template <typename T>
+  static bool is_deferred(GeometryId id, const ProximityEngine<T>& engine) {
+    return engine.hydroelastic_geometries().is_deferred(id);
+  }
+
   template <typename T>
   static bool IsFclConvexType(const ProximityEngine<T>& engine, GeometryId id) {
     return engine.IsFclConvexType(id);
@@ -1724,6 +1729,62 @@ TEST_F(ProximityEngineTests, ComputeContactSurfaces) {
   EXPECT_FALSE(derivs.isZero());
 }
 
+// Deferred compliant representations are built by the contact queries that
+// need them, and give the same contact surfaces as representations that were
+// built up front. Geometries that overlap nothing are never built.
+TEST_F(ProximityEngineTests, ComputeContactSurfacesDeferred) {
+  const Convex convex(
+      FindResourceOrThrow("drake/geometry/test/octahedron.obj"));
+  ProximityProperties eager_props;
+  AddCompliantHydroelasticProperties(0.5, 1e8, &eager_props);
+  ProximityProperties deferred_props(eager_props);
+  deferred_props.AddProperty(kHydroGroup, kDeferConstruction, true);
+
+  // The same overlapping pair, built eagerly and deferred, 10 m apart, and a
+  // deferred geometry far from everything.
+  const Vector3d p_EagerDeferred(0, 10, 0);
+  const GeometryId eager_A = AddDynamic(convex, V3{0, 0, 0}, eager_props);
+  const GeometryId eager_B = AddDynamic(convex, V3{1.5, 0, 0}, eager_props);
+  const GeometryId deferred_A =
+      AddDynamic(convex, p_EagerDeferred, deferred_props);
+  const GeometryId deferred_B =
+      AddDynamic(convex, p_EagerDeferred + V3{1.5, 0, 0}, deferred_props);
+  const GeometryId far = AddDynamic(convex, V3{0, 20, 0}, deferred_props);
+  for (const GeometryId id : {deferred_A, deferred_B, far}) {
+    EXPECT_EQ(Tester::hydroelastic_type(id, engine_),
+              HydroelasticType::kCompliant);
+    EXPECT_TRUE(Tester::is_deferred(id, engine_));
+  }
+
+  EXPECT_EQ(engine_.hydroelastic_build_parallelism().num_threads(), 1);
+  engine_.set_hydroelastic_build_parallelism(Parallelism(2));
+  EXPECT_EQ(engine_.hydroelastic_build_parallelism().num_threads(), 2);
+  EXPECT_EQ(ProximityEngine<double>(engine_)
+                .hydroelastic_build_parallelism()
+                .num_threads(),
+            2);
+
+  engine_.UpdateWorldPoses(X_WGs_);
+  const vector<ContactSurface<double>> surfaces =
+      engine_.ComputeContactSurfaces(
+          HydroelasticContactRepresentation::kPolygon, X_WGs_);
+  ASSERT_EQ(surfaces.size(), 2);
+  const ContactSurface<double>& eager = surfaces[0];
+  const ContactSurface<double>& deferred = surfaces[1];
+  EXPECT_EQ(eager.id_M(), eager_A);
+  EXPECT_EQ(eager.id_N(), eager_B);
+  EXPECT_EQ(deferred.id_M(), deferred_A);
+  EXPECT_EQ(deferred.id_N(), deferred_B);
+  EXPECT_EQ(deferred.num_faces(), eager.num_faces());
+  EXPECT_NEAR(deferred.total_area(), eager.total_area(), 1e-10);
+  EXPECT_TRUE(CompareMatrices(deferred.centroid(),
+                              eager.centroid() + p_EagerDeferred, 1e-10));
+
+  EXPECT_FALSE(Tester::is_deferred(deferred_A, engine_));
+  EXPECT_FALSE(Tester::is_deferred(deferred_B, engine_));
+  EXPECT_TRUE(Tester::is_deferred(far, engine_));
+}
+
 /* ComputeContactSurfacesWithFallback() responsibilities:
   1. Empty engine produces no results.
   2. Collision result for dynamic-dynamic pair.
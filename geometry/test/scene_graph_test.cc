@@ -460,6 +460,30 @@ TEST_F(SceneGraphTest, ApplyConfig) {
   EXPECT_FALSE(props->HasProperty(kHydroGroup, kPointStiffness));
 }
 
+// The hydroelastic build threads of the config reach the proximity engine of
+// the contexts allocated afterwards, and of their clones.
+TEST_F(SceneGraphTest, ApplyConfigHydroelasticBuildThreads) {
+  CreateDefaultContext();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *context_)
+                .hydroelastic_build_parallelism()
+                .num_threads(),
+            1);
+
+  SceneGraphConfig config;
+  config.hydroelastic_build_threads = 3;
+  scene_graph_.set_config(config);
+  CreateDefaultContext();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *context_)
+                .hydroelastic_build_parallelism()
+                .num_threads(),
+            3);
+  const unique_ptr<Context<double>> clone = context_->Clone();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *clone)
+                .hydroelastic_build_parallelism()
+                .num_threads(),
+            3);
+}
+
 template <typename T>
 class TypedSceneGraphTest : public SceneGraphTest {
  public:
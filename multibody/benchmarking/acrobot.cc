@@ -1,5 +1,6 @@
 // @file
-// Benchmarks for Acrobot autodiff, with and without MultibodyPlant.
+// Benchmarks for Acrobot autodiff, with and without MultibodyPlant, and for
+// the straight-line code generated from its model by generate_kernels.
 //
 // This program is a successor to Hongkai Dai's original benchmark; see #8482.
 
@@ -14,8 +15,10 @@
 #include "drake/examples/acrobot/acrobot_plant.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
+#include "drake/multibody/benchmarking/acrobot_kernels.h"
 #include "drake/multibody/benchmarks/acrobot/make_acrobot_plant.h"
 #include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/tree/multibody_forces.h"
 #include "drake/tools/performance/fixture_common.h"
 
 using drake::multibody::MultibodyPlant;
@@ -145,6 +148,47 @@ BENCHMARK_F(MultibodyFixtureAdx, MultibodyAdxMassMatrixViaInverseDynamics)
   }
 }
 
+// clang-format off
+BENCHMARK_F(MultibodyFixtureD, MultibodyDInverseDynamics)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state)  // clang-format on
+{
+  const VectorX<double> vdot = VectorX<double>::Ones(nv_);
+  multibody::MultibodyForces<double> forces(*plant_);
+  for (auto _ : state) {
+    InvalidateState();
+    plant_->CalcForceElementsContribution(*context_, &forces);
+    plant_->CalcInverseDynamics(*context_, vdot, forces);
+  }
+}
+
+// The generated kernels evaluate the same quantities as the MultibodyD
+// benchmarks above, for the same model, with straight-line code.
+static_assert(acrobot_num_positions == 2 && acrobot_num_velocities == 2);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+void GeneratedMassMatrix(benchmark::State& state) {
+  const double q[2] = {0.3, -1.2};
+  double M[4];
+  for (auto _ : state) {
+    acrobot_mass_matrix(q, M);
+    benchmark::DoNotOptimize(M);
+  }
+}
+BENCHMARK(GeneratedMassMatrix);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+void GeneratedInverseDynamics(benchmark::State& state) {
+  // [q; v; vdot].
+  const double p[6] = {0.3, -1.2, 0.0, 0.0, 1.0, 1.0};
+  double tau[2];
+  for (auto _ : state) {
+    acrobot_inverse_dynamics(p, tau);
+    benchmark::DoNotOptimize(tau);
+  }
+}
+BENCHMARK(GeneratedInverseDynamics);
+
 }  // namespace
 }  // namespace acrobot
 }  // namespace examples
@@ -0,0 +1,67 @@
+#include <fstream>
+#include <memory>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/text_logging.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/kernel_codegen.h"
+
+DEFINE_string(model, "", "Model filename (URDF, SDFormat, ...) to read");
+DEFINE_string(prefix, "", "Prefix for the names of the generated functions");
+DEFINE_string(output_source, "", "C++ source filename to write");
+DEFINE_string(output_header, "", "C++ header filename to write");
+DEFINE_string(header_include, "",
+              "How the source includes the header, e.g., "
+              "drake/multibody/benchmarking/acrobot_kernels.h");
+
+namespace drake {
+namespace {
+
+void WriteFile(const std::string& filename, const std::string& contents) {
+  std::ofstream out(filename);
+  DRAKE_THROW_UNLESS(out.good());
+  out << contents;
+  DRAKE_THROW_UNLESS(out.good());
+}
+
+void main() {
+  DRAKE_THROW_UNLESS(!FLAGS_model.empty());
+  DRAKE_THROW_UNLESS(!FLAGS_prefix.empty());
+  DRAKE_THROW_UNLESS(!FLAGS_output_source.empty());
+  DRAKE_THROW_UNLESS(!FLAGS_output_header.empty());
+  DRAKE_THROW_UNLESS(!FLAGS_header_include.empty());
+
+  multibody::MultibodyPlant<double> plant(0.0);
+  multibody::Parser(&plant).AddModels(FLAGS_model);
+  plant.Finalize();
+
+  const multibody::internal::KernelExpressions kernels =
+      multibody::internal::CalcKernelExpressions(plant);
+  log()->debug("Generating kernels for {} bodies, nq = {}, nv = {}",
+               kernels.num_bodies(), kernels.num_positions(),
+               kernels.num_velocities());
+  WriteFile(FLAGS_output_source,
+            multibody::internal::GenerateKernelSource(kernels, FLAGS_prefix,
+                                                      FLAGS_header_include));
+  WriteFile(FLAGS_output_header, multibody::internal::GenerateKernelHeader(
+                                     kernels, FLAGS_prefix));
+}
+
+}  // namespace
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(
+      R"""(Reads in a model and writes out straight-line C++ code that computes
+its body poses, body Jacobians, mass matrix, and inverse dynamics.
+
+NOTE: The generated code grows quickly with the size of the model, since
+symbolic expressions are not simplified across outputs. It is intended for
+small models with few degrees of freedom.
+)""");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  drake::main();
+  return 0;
+}
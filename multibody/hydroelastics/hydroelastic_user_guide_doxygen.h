@@ -286,6 +286,15 @@ each of the properties and then discuss how they can be specified.
       @ref speculative_constraints.
     - The default value is set in
       drake::geometry::DefaultProximityProperties::margin.
+- Defer construction
+  - A boolean; false by default.
+  - Only used for compliant Mesh and Convex shapes without a margin. When
+    true, the shape's compliant representation is built when a contact query
+    first needs it, rather than when the geometry is added to `SceneGraph`.
+    Scenes with many compliant meshes that rarely touch load faster.
+  - The representations needed by one query can be built in parallel, see
+    drake::geometry::SceneGraphConfig::hydroelastic_build_threads.
+  - See drake::geometry::AddCompliantHydroelasticProperties() for details.
 - Slab thickness
   - A positive real value in meters
   - Only used for compliant half spaces. Declaring a half space to be compliant
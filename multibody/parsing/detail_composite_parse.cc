@@ -19,7 +19,7 @@ CompositeParse::CompositeParse(Parser* parser)
       options_({parser->GetAutoRenaming()}),
       workspace_(options_, parser->package_map(), parser->diagnostic_policy_,
                  parser->builder(), &parser->plant(), &resolver_,
-                 SelectParser) {}
+                 SelectParser, parser->mesh_inertia_cache()) {}
 
 CompositeParse::~CompositeParse() = default;
 
@@ -0,0 +1,60 @@
+#include "drake/multibody/parsing/detail_mesh_inertia_cache.h"
+
+#include <filesystem>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+MeshInertiaCache::MeshInertiaCache() = default;
+
+MeshInertiaCache::~MeshInertiaCache() = default;
+
+CalcSpatialInertiaResult MeshInertiaCache::CalcSpatialInertiaWithFallback(
+    const geometry::Mesh& mesh, double density,
+    const std::function<void(const std::string&)>& warn_for_convex) {
+  const geometry::MeshSource& source = mesh.source();
+  // A missing file has no canonical path to key on; let the uncached function
+  // report the problem.
+  if (source.is_path() && !std::filesystem::exists(source.path())) {
+    return internal::CalcSpatialInertiaWithFallback(mesh, density,
+                                                    warn_for_convex);
+  }
+
+  const Vector3<double>& scale = mesh.scale3();
+  const std::string key =
+      fmt::format("{}|{}|{}|{}|{}", source.GetCacheKey(/* is_convex= */ false),
+                  scale.x(), scale.y(), scale.z(), density);
+  auto iter = entries_.find(key);
+  if (iter == entries_.end()) {
+    std::optional<std::string> convex_warning;
+    CalcSpatialInertiaResult result = internal::CalcSpatialInertiaWithFallback(
+        mesh, density, [&convex_warning](const std::string& message) {
+          convex_warning = message;
+        });
+    Entry entry{std::move(result), std::move(convex_warning)};
+    iter = entries_.emplace(key, std::move(entry)).first;
+  }
+
+  const Entry& entry = iter->second;
+  if (entry.convex_warning.has_value() && warn_for_convex != nullptr) {
+    warn_for_convex(*entry.convex_warning);
+  }
+  return entry.result;
+}
+
+CalcSpatialInertiaResult CalcSpatialInertiaWithFallbackCached(
+    MeshInertiaCache* cache, const geometry::Mesh& mesh, double density,
+    const std::function<void(const std::string&)>& warn_for_convex) {
+  if (cache == nullptr) {
+    return CalcSpatialInertiaWithFallback(mesh, density, warn_for_convex);
+  }
+  return cache->CalcSpatialInertiaWithFallback(mesh, density, warn_for_convex);
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/multibody/tree/geometry_spatial_inertia.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// Memoizes CalcSpatialInertiaWithFallback() for meshes, across all of the
+// models parsed by a single Parser. Scenes often contain many copies of the
+// same model (e.g., a bin of identical objects), each of which asks for the
+// inertia of the same mesh; only the first copy pays for reading the mesh
+// and integrating over it.
+//
+// Entries are keyed by the mesh's MeshSource::GetCacheKey() (i.e., its
+// canonical path, or the checksum of its in-memory contents), its scale, and
+// the density. Like the geometry caches keyed the same way, this assumes that
+// mesh files don't change on disk while a Parser is in use.
+class MeshInertiaCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshInertiaCache);
+
+  MeshInertiaCache();
+
+  ~MeshInertiaCache();
+
+  // Returns CalcSpatialInertiaWithFallback(mesh, density, warn_for_convex),
+  // computing it only if no equivalent call was made before. When the result
+  // comes from the cache, any warning that the original computation passed to
+  // its `warn_for_convex` is passed to this call's `warn_for_convex` too, so
+  // that each model still gets its own diagnostics.
+  CalcSpatialInertiaResult CalcSpatialInertiaWithFallback(
+      const geometry::Mesh& mesh, double density,
+      const std::function<void(const std::string&)>& warn_for_convex);
+
+  // Returns the number of distinct results computed so far.
+  int num_entries() const { return static_cast<int>(entries_.size()); }
+
+ private:
+  struct Entry {
+    CalcSpatialInertiaResult result;
+    std::optional<std::string> convex_warning;
+  };
+
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+// Calls `cache->CalcSpatialInertiaWithFallback()`, or the uncached
+// CalcSpatialInertiaWithFallback() if `cache` is nullptr.
+CalcSpatialInertiaResult CalcSpatialInertiaWithFallbackCached(
+    MeshInertiaCache* cache, const geometry::Mesh& mesh, double density,
+    const std::function<void(const std::string&)>& warn_for_convex);
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
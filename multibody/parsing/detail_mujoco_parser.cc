@@ -571,11 +571,16 @@ class MujocoParser {
     DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(InertiaCalculator);
     // The reifier aliases the pre-computed mesh spatial inertias. When looking
     // up mesh inertias, it uses the mujoco geometry _name_ and not the
-    // mesh filename.
+    // mesh filename. Meshes not found there are computed via the (optional)
+    // `mesh_inertia_cache`, which is shared with other models.
     InertiaCalculator(
         const DiagnosticPolicy& policy, std::string name,
-        std::map<std::string, SpatialInertia<double>>* mesh_inertia)
-        : policy_(policy), name_(std::move(name)), mesh_inertia_(mesh_inertia) {
+        std::map<std::string, SpatialInertia<double>>* mesh_inertia,
+        MeshInertiaCache* mesh_inertia_cache)
+        : policy_(policy),
+          name_(std::move(name)),
+          mesh_inertia_(mesh_inertia),
+          mesh_inertia_cache_(mesh_inertia_cache) {
       DRAKE_DEMAND(mesh_inertia != nullptr);
     }
 
@@ -606,8 +611,8 @@ class MujocoParser {
       if (mesh_inertia_->contains(name_)) {
         M_GGo_G_unitDensity = mesh_inertia_->at(name_);
       } else {
-        CalcSpatialInertiaResult result = CalcSpatialInertiaWithFallback(
-            mesh, /* density= */ 1.0,
+        CalcSpatialInertiaResult result = CalcSpatialInertiaWithFallbackCached(
+            mesh_inertia_cache_, mesh, /* density= */ 1.0,
             /* warn_on_convex= */ [this](const std::string& message) {
               used_convex_hull_fallback_ = true;
               policy_.Warning(message);
@@ -637,6 +642,7 @@ class MujocoParser {
     const DiagnosticPolicy& policy_;
     std::string name_;
     std::map<std::string, SpatialInertia<double>>* mesh_inertia_{nullptr};
+    MeshInertiaCache* mesh_inertia_cache_{nullptr};
     bool used_convex_hull_fallback_{false};
     // Note: The spatial inertia below uses unit density so that the shape's
     // volume value is equal to its mass value. To be clear, unit density is a
@@ -989,7 +995,8 @@ class MujocoParser {
 
     if (compute_inertia) {
       auto policy = diagnostic_.MakePolicyForNode(node);
-      InertiaCalculator calculator(policy, mesh, &mesh_inertia_);
+      InertiaCalculator calculator(policy, mesh, &mesh_inertia_,
+                                   workspace_.mesh_inertia_cache);
       const auto [volume, p_GoGcm_G, G_GGo_G] = calculator.Calc(*geom.shape);
       if (calculator.used_convex_hull_fallback()) {
         // When the Mujoco parser falls back to using a convex hull, it prints
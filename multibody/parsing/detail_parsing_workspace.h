@@ -9,6 +9,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/multibody/parsing/detail_collision_filter_group_resolver.h"
 #include "drake/multibody/parsing/detail_common.h"
+#include "drake/multibody/parsing/detail_mesh_inertia_cache.h"
 #include "drake/multibody/parsing/package_map.h"
 #include "drake/multibody/plant/multibody_plant.h"
 
@@ -132,14 +133,15 @@ struct ParsingWorkspace {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParsingWorkspace);
 
   // All parameters are aliased; they must have a lifetime greater than that of
-  // this struct.
+  // this struct. The `mesh_inertia_cache_in` is optional.
   ParsingWorkspace(
       const ParsingOptions& options_in, const PackageMap& package_map_in,
       const drake::internal::DiagnosticPolicy& diagnostic_in,
       systems::DiagramBuilder<double>* builder_in,
       MultibodyPlant<double>* plant_in,
       internal::CollisionFilterGroupResolver* collision_resolver_in,
-      ParserSelector parser_selector_in)
+      ParserSelector parser_selector_in,
+      MeshInertiaCache* mesh_inertia_cache_in = nullptr)
       : options(options_in),
         package_map(package_map_in),
         diagnostic(diagnostic_in),
@@ -149,7 +151,8 @@ struct ParsingWorkspace {
                         ? plant_in->GetMutableSceneGraphPreFinalize()
                         : nullptr),
         collision_resolver(collision_resolver_in),
-        parser_selector(parser_selector_in) {
+        parser_selector(parser_selector_in),
+        mesh_inertia_cache(mesh_inertia_cache_in) {
     DRAKE_DEMAND(plant != nullptr);
     DRAKE_DEMAND(collision_resolver != nullptr);
     DRAKE_DEMAND(parser_selector != nullptr);
@@ -163,6 +166,9 @@ struct ParsingWorkspace {
   geometry::SceneGraph<double>* const scene_graph;
   internal::CollisionFilterGroupResolver* const collision_resolver;
   const ParserSelector parser_selector;
+  // When non-null, mesh inertia computations should go through this cache;
+  // see CalcSpatialInertiaWithFallbackCached().
+  MeshInertiaCache* const mesh_inertia_cache;
 };
 
 }  // namespace internal
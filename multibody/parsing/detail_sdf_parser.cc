@@ -2800,8 +2800,8 @@ gz::math::Inertiald CalculateMeshInertia(const ParsingWorkspace& workspace,
   const Vector3d scale = ToVector3(mesh.Scale());
   const geometry::Mesh mesh_geo(filename, scale);
 
-  CalcSpatialInertiaResult result = internal::CalcSpatialInertiaWithFallback(
-      mesh_geo, density,
+  CalcSpatialInertiaResult result = CalcSpatialInertiaWithFallbackCached(
+      workspace.mesh_inertia_cache, mesh_geo, density,
       /* warn_for_convex= */ [&workspace](const std::string& message) {
         workspace.diagnostic.Warning(message);
       });
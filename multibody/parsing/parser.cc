@@ -9,6 +9,7 @@
 #include "drake/multibody/parsing/detail_common.h"
 #include "drake/multibody/parsing/detail_composite_parse.h"
 #include "drake/multibody/parsing/detail_instanced_name.h"
+#include "drake/multibody/parsing/detail_mesh_inertia_cache.h"
 #include "drake/multibody/parsing/detail_parsing_workspace.h"
 #include "drake/multibody/parsing/detail_path_utils.h"
 #include "drake/multibody/parsing/detail_select_parser.h"
@@ -32,6 +33,9 @@ struct Parser::ParserInternalData {
   // Collision filter groups that use InstancedName. This representation is
   // invariant with respect to model renaming via the plant.
   CollisionFilterGroupsImpl<InstancedName> collision_filter_groups_storage_;
+
+  // Spatial inertias computed from meshes, shared by all parses.
+  internal::MeshInertiaCache mesh_inertia_cache_;
 };
 
 Parser::Parser(MultibodyPlant<double>* plant,
@@ -158,5 +162,9 @@ void Parser::ResolveCollisionFilterGroupsFromCompositeParse(
   data_->collision_filter_groups_storage_.Merge(groups);
 }
 
+internal::MeshInertiaCache* Parser::mesh_inertia_cache() {
+  return &data_->mesh_inertia_cache_;
+}
+
 }  // namespace multibody
 }  // namespace drake
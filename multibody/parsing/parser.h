@@ -18,6 +18,7 @@ namespace multibody {
 namespace internal {
 class CollisionFilterGroupResolver;
 class CompositeParse;
+class MeshInertiaCache;
 }  // namespace internal
 
 /// Parses model description input into a MultibodyPlant and (optionally) a
@@ -275,6 +276,10 @@ class Parser final {
   void ResolveCollisionFilterGroupsFromCompositeParse(
       internal::CollisionFilterGroupResolver* resolver);
 
+  // Used by CompositeParse, to share mesh inertia computations among all of
+  // the models parsed by this parser.
+  internal::MeshInertiaCache* mesh_inertia_cache();
+
   bool is_strict_{false};
   bool enable_auto_rename_{false};
   PackageMap package_map_;
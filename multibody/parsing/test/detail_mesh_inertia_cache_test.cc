@@ -0,0 +1,98 @@
+#include "drake/multibody/parsing/detail_mesh_inertia_cache.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+const SpatialInertia<double>& GetInertia(
+    const CalcSpatialInertiaResult& result) {
+  EXPECT_TRUE(std::holds_alternative<SpatialInertia<double>>(result));
+  return std::get<SpatialInertia<double>>(result);
+}
+
+void ExpectSameInertia(const SpatialInertia<double>& a,
+                       const SpatialInertia<double>& b) {
+  EXPECT_TRUE(CompareMatrices(a.CopyToFullMatrix6(), b.CopyToFullMatrix6()));
+}
+
+GTEST_TEST(MeshInertiaCacheTest, ReusesResults) {
+  const geometry::Mesh box(FindResourceOrThrow(
+      "drake/multibody/parsing/test/box_package/meshes/box.obj"));
+  const geometry::Mesh scaled_box(box.source().path(), 2.0);
+  const SpatialInertia<double> expected =
+      GetInertia(CalcSpatialInertiaWithFallback(box, 1000.0));
+
+  MeshInertiaCache dut;
+  ExpectSameInertia(
+      GetInertia(dut.CalcSpatialInertiaWithFallback(box, 1000.0, nullptr)),
+      expected);
+  EXPECT_EQ(dut.num_entries(), 1);
+
+  // Asking again (even via a different Mesh object) reuses the entry.
+  const geometry::Mesh same_box(box.source().path());
+  ExpectSameInertia(GetInertia(dut.CalcSpatialInertiaWithFallback(
+                        same_box, 1000.0, nullptr)),
+                    expected);
+  EXPECT_EQ(dut.num_entries(), 1);
+
+  // A different density or scale is a different entry.
+  ExpectSameInertia(
+      GetInertia(dut.CalcSpatialInertiaWithFallback(box, 500.0, nullptr)),
+      GetInertia(CalcSpatialInertiaWithFallback(box, 500.0)));
+  EXPECT_EQ(dut.num_entries(), 2);
+  ExpectSameInertia(GetInertia(dut.CalcSpatialInertiaWithFallback(
+                        scaled_box, 1000.0, nullptr)),
+                    GetInertia(CalcSpatialInertiaWithFallback(scaled_box,
+                                                              1000.0)));
+  EXPECT_EQ(dut.num_entries(), 3);
+
+  // The convenience function uses the cache when given one.
+  ExpectSameInertia(GetInertia(CalcSpatialInertiaWithFallbackCached(
+                        &dut, box, 1000.0, nullptr)),
+                    expected);
+  EXPECT_EQ(dut.num_entries(), 3);
+  ExpectSameInertia(GetInertia(CalcSpatialInertiaWithFallbackCached(
+                        nullptr, box, 1000.0, nullptr)),
+                    expected);
+}
+
+// Every caller gets the convex hull warning, even when the result is reused.
+GTEST_TEST(MeshInertiaCacheTest, RepeatsWarnings) {
+  const geometry::Mesh bad_mesh(
+      FindResourceOrThrow("drake/geometry/test/bad_geometry_volume_zero.obj"));
+  std::vector<std::string> warnings;
+  auto warn = [&warnings](const std::string& message) {
+    warnings.push_back(message);
+  };
+
+  MeshInertiaCache dut;
+  dut.CalcSpatialInertiaWithFallback(bad_mesh, 1000.0, warn);
+  dut.CalcSpatialInertiaWithFallback(bad_mesh, 1000.0, warn);
+  EXPECT_EQ(dut.num_entries(), 1);
+  ASSERT_EQ(warnings.size(), 2);
+  EXPECT_EQ(warnings[0], warnings[1]);
+}
+
+// Missing files are passed through, uncached, for the caller to report.
+GTEST_TEST(MeshInertiaCacheTest, MissingFile) {
+  const geometry::Mesh missing("/no/such/file.obj");
+  MeshInertiaCache dut;
+  const CalcSpatialInertiaResult result =
+      dut.CalcSpatialInertiaWithFallback(missing, 1000.0, nullptr);
+  EXPECT_TRUE(std::holds_alternative<std::string>(result));
+  EXPECT_EQ(dut.num_entries(), 0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
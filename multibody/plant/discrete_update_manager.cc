@@ -625,6 +625,68 @@ void DiscreteUpdateManager<T>::CalcDiscreteContactPairs(
   }
 }
 
+template <typename T>
+Vector3<T> DiscreteUpdateManager<T>::CalcContactJacobianTreeBlocks(
+    const systems::Context<T>& context, const RigidBody<T>& body_A,
+    const RigidBody<T>& body_B, const Vector3<T>& p_WC,
+    const math::RotationMatrix<T>& R_WC,
+    std::vector<JacobianTreeColumns<T>>* scratch,
+    std::vector<typename DiscreteContactPair<T>::JacobianTreeBlock>*
+        jacobian_blocks) const {
+  DRAKE_DEMAND(scratch != nullptr);
+  DRAKE_DEMAND(jacobian_blocks != nullptr);
+  const SpanningForest& forest = get_forest();
+  const Eigen::VectorBlock<const VectorX<T>> v = plant().GetVelocities(context);
+
+  // Spatial velocity Jacobians of Ac and Bc, restricted to their Trees.
+  const RigidTransform<T>& X_WA = plant().EvalBodyPoseInWorld(context, body_A);
+  const RigidTransform<T>& X_WB = plant().EvalBodyPoseInWorld(context, body_B);
+  Matrix3X<T> p_FC(3, 2);
+  p_FC.col(0) = X_WA.inverse() * p_WC;  // p_AoC_A
+  p_FC.col(1) = X_WB.inverse() * p_WC;  // p_BoC_B
+  internal_tree().CalcJacobianSpatialVelocityTreeBlocks(
+      context, {&body_A.body_frame(), &body_B.body_frame()}, p_FC, scratch);
+  const JacobianTreeColumns<T>& Jv_V_WAc_W = (*scratch)[0];
+  const JacobianTreeColumns<T>& Jv_V_WBc_W = (*scratch)[1];
+  const bool tree_A_has_dofs = Jv_V_WAc_W.J.cols() > 0;
+  const bool tree_B_has_dofs = Jv_V_WBc_W.J.cols() > 0;
+
+  // Since v_AcBc_W = v_WBc - v_WAc the relative velocity Jacobian will be:
+  //   J_AcBc_W = Jv_WBc_W - Jv_WAc_W.
+  // Expressed in C, its block for a Tree is the difference of the
+  // translational parts of the blocks above, for whichever of them belong to
+  // that Tree.
+  const Matrix3<T> R_CW = R_WC.matrix().transpose();
+  Vector3<T> v_AcBc_W = Vector3<T>::Zero();
+  jacobian_blocks->clear();
+  jacobian_blocks->reserve(2);  // We have at most two blocks per contact.
+  auto add_block = [&](const TreeIndex tree_index, Matrix3X<T> J_AcBc_W) {
+    const SpanningForest::Tree& tree = forest.trees(tree_index);
+    v_AcBc_W += J_AcBc_W * v.segment(tree.v_start(), tree.nv());
+    Matrix3X<T> J = R_CW * J_AcBc_W;
+    jacobian_blocks->emplace_back(tree_index, MatrixBlock<T>(std::move(J)));
+  };
+
+  // Tree A contribution to contact Jacobian Jv_W_AcBc_C.
+  if (tree_A_has_dofs) {
+    if (tree_B_has_dofs && Jv_V_WBc_W.tree == Jv_V_WAc_W.tree) {
+      add_block(Jv_V_WAc_W.tree, Jv_V_WBc_W.J.template bottomRows<3>() -
+                                     Jv_V_WAc_W.J.template bottomRows<3>());
+    } else {
+      add_block(Jv_V_WAc_W.tree, -Jv_V_WAc_W.J.template bottomRows<3>());
+    }
+  }
+
+  // Tree B contribution to contact Jacobian Jv_W_AcBc_C.
+  // This contribution must be added only if B is different from A.
+  if (tree_B_has_dofs &&
+      (!tree_A_has_dofs || Jv_V_WBc_W.tree != Jv_V_WAc_W.tree)) {
+    add_block(Jv_V_WBc_W.tree, Jv_V_WBc_W.J.template bottomRows<3>());
+  }
+
+  return v_AcBc_W;
+}
+
 template <typename T>
 void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForPointContact(
     const systems::Context<T>& context,
@@ -639,15 +701,9 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForPointContact(
   contact_pairs->Reserve(num_point_contacts, 0, 0);
   const geometry::SceneGraphInspector<T>& inspector =
       plant().EvalSceneGraphInspector(context);
-  const SpanningForest& forest = get_forest();
-  const Eigen::VectorBlock<const VectorX<T>> v = plant().GetVelocities(context);
-  const Frame<T>& frame_W = plant().world_frame();
 
   // Scratch workspace variables.
-  const int nv = plant().num_velocities();
-  Matrix3X<T> Jv_WAc_W(3, nv);
-  Matrix3X<T> Jv_WBc_W(3, nv);
-  Matrix3X<T> Jv_AcBc_W(3, nv);
+  std::vector<JacobianTreeColumns<T>> jacobian_scratch;
 
   // Fill in the point contact pairs.
   for (int point_pair_index = 0; point_pair_index < num_point_contacts;
@@ -658,14 +714,6 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForPointContact(
     const BodyIndex body_B_index = FindBodyByGeometryId(pair.id_B);
     const RigidBody<T>& body_B = plant().get_body(body_B_index);
 
-    const TreeIndex& tree_A_index = forest.link_to_tree_index(body_A_index);
-    const bool tree_A_has_dofs =
-        tree_A_index.is_valid() && forest.trees(tree_A_index).has_dofs();
-
-    const TreeIndex& tree_B_index = forest.link_to_tree_index(body_B_index);
-    const bool tree_B_has_dofs =
-        tree_B_index.is_valid() && forest.trees(tree_B_index).has_dofs();
-
     const T kA = GetPointContactStiffness(
         pair.id_A, default_contact_stiffness(), inspector);
     const T kB = GetPointContactStiffness(
@@ -678,18 +726,6 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForPointContact(
     const T wB = (denom == 0 ? 0.5 : kB / denom);
     const Vector3<T> p_WC = wA * pair.p_WCa + wB * pair.p_WCb;
 
-    // Since v_AcBc_W = v_WBc - v_WAc the relative velocity Jacobian will
-    // be:
-    //   J_AcBc_W = Jv_WBc_W - Jv_WAc_W.
-    // That is the relative velocity at C is v_AcBc_W = J_AcBc_W * v.
-    internal_tree().CalcJacobianTranslationalVelocity(
-        context, JacobianWrtVariable::kV, body_A.body_frame(), frame_W, p_WC,
-        frame_W, frame_W, &Jv_WAc_W);
-    internal_tree().CalcJacobianTranslationalVelocity(
-        context, JacobianWrtVariable::kV, body_B.body_frame(), frame_W, p_WC,
-        frame_W, frame_W, &Jv_WBc_W);
-    Jv_AcBc_W = Jv_WBc_W - Jv_WAc_W;
-
     // Define a contact frame C at the contact point such that the z-axis Cz
     // equals nhat_W. The tangent vectors are arbitrary, with the only
     // requirement being that they form a valid right handed basis with
@@ -698,33 +734,15 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForPointContact(
     math::RotationMatrix<T> R_WC =
         math::RotationMatrix<T>::MakeFromOneVector(nhat_AB_W, 2);
 
-    // Contact velocity stored in the current context (previous time step).
-    const Vector3<T> v_AcBc_W = Jv_AcBc_W * v;
-    const Vector3<T> v_AcBc_C = R_WC.transpose() * v_AcBc_W;
-    const T vn0 = v_AcBc_C(2);
-
-    // We have at most two blocks per contact.
+    // Contact Jacobian Jv_AcBc_C, in per-Tree blocks, and the contact
+    // velocity stored in the current context (previous time step).
     std::vector<typename DiscreteContactPair<T>::JacobianTreeBlock>
         jacobian_blocks;
-    jacobian_blocks.reserve(2);
-
-    // Tree A contribution to contact Jacobian Jv_W_AcBc_C.
-    if (tree_A_has_dofs) {
-      const SpanningForest::Tree& tree_A = forest.trees(tree_A_index);
-      Matrix3X<T> J = R_WC.matrix().transpose() *
-                      Jv_AcBc_W.middleCols(tree_A.v_start(), tree_A.nv());
-      jacobian_blocks.emplace_back(tree_A_index, MatrixBlock<T>(std::move(J)));
-    }
-
-    // Tree B contribution to contact Jacobian Jv_W_AcBc_C.
-    // This contribution must be added only if B is different from A.
-    if ((tree_B_has_dofs && !tree_A_has_dofs) ||
-        (tree_B_has_dofs && tree_B_index != tree_A_index)) {
-      const SpanningForest::Tree& tree_B = forest.trees(tree_B_index);
-      Matrix3X<T> J = R_WC.matrix().transpose() *
-                      Jv_AcBc_W.middleCols(tree_B.v_start(), tree_B.nv());
-      jacobian_blocks.emplace_back(tree_B_index, MatrixBlock<T>(std::move(J)));
-    }
+    const Vector3<T> v_AcBc_W =
+        CalcContactJacobianTreeBlocks(context, body_A, body_B, p_WC, R_WC,
+                                      &jacobian_scratch, &jacobian_blocks);
+    const Vector3<T> v_AcBc_C = R_WC.transpose() * v_AcBc_W;
+    const T vn0 = v_AcBc_C(2);
 
     // Contact stiffness and damping
     const T k = GetCombinedPointContactStiffness(
@@ -806,15 +824,9 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
   contact_pairs->Reserve(0, num_hydro_contacts, 0);
   const geometry::SceneGraphInspector<T>& inspector =
       plant().EvalSceneGraphInspector(context);
-  const SpanningForest& forest = get_forest();
-  const Eigen::VectorBlock<const VectorX<T>> v = plant().GetVelocities(context);
-  const Frame<T>& frame_W = plant().world_frame();
 
   // Scratch workspace variables.
-  const int nv = plant().num_velocities();
-  Matrix3X<T> Jv_WAc_W(3, nv);
-  Matrix3X<T> Jv_WBc_W(3, nv);
-  Matrix3X<T> Jv_AcBc_W(3, nv);
+  std::vector<JacobianTreeColumns<T>> jacobian_scratch;
 
   const int num_surfaces = surfaces.size();
   for (int surface_index = 0; surface_index < num_surfaces; ++surface_index) {
@@ -831,16 +843,6 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
     const BodyIndex body_B_index = FindBodyByGeometryId(s.id_N());
     const RigidBody<T>& body_B = plant().get_body(body_B_index);
 
-    const TreeIndex& tree_A_index = forest.link_to_tree_index(body_A_index);
-    // World isn't in any tree so we can't call forest.trees() on the index,
-    // which will be invalid.
-    const bool treeA_has_dofs =
-        tree_A_index.is_valid() && forest.trees(tree_A_index).has_dofs();
-
-    const TreeIndex& tree_B_index = forest.link_to_tree_index(body_B_index);
-    const bool treeB_has_dofs =
-        tree_B_index.is_valid() && forest.trees(tree_B_index).has_dofs();
-
     // TODO(amcastro-tri): Consider making the modulus required, instead of
     // a default infinite value.
     const T hydro_modulus_M = GetHydroelasticModulus(
@@ -917,18 +919,6 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
         // is measured and expressed in W).
         const Vector3<T>& p_WC = s.centroid(face);
 
-        // Since v_AcBc_W = v_WBc - v_WAc the relative velocity Jacobian
-        // will be:
-        //   J_AcBc_W = Jv_WBc_W - Jv_WAc_W.
-        // That is the relative velocity at C is v_AcBc_W = J_AcBc_W * v.
-        internal_tree().CalcJacobianTranslationalVelocity(
-            context, JacobianWrtVariable::kV, body_A.body_frame(), frame_W,
-            p_WC, frame_W, frame_W, &Jv_WAc_W);
-        internal_tree().CalcJacobianTranslationalVelocity(
-            context, JacobianWrtVariable::kV, body_B.body_frame(), frame_W,
-            p_WC, frame_W, frame_W, &Jv_WBc_W);
-        Jv_AcBc_W = Jv_WBc_W - Jv_WAc_W;
-
         // Define a contact frame C at the contact point such that the
         // z-axis Cz equals nhat_AB_W. The tangent vectors are arbitrary,
         // with the only requirement being that they form a valid right
@@ -937,36 +927,15 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
         math::RotationMatrix<T> R_WC =
             math::RotationMatrix<T>::MakeFromOneVector(nhat_AB_W, 2);
 
-        // Contact velocity stored in the current context (previous time
-        // step).
-        const Vector3<T> v_AcBc_W = Jv_AcBc_W * v;
-        const Vector3<T> v_AcBc_C = R_WC.transpose() * v_AcBc_W;
-        const T vn0 = v_AcBc_C(2);
-
-        // We have at most two blocks per contact.
+        // Contact Jacobian Jv_AcBc_C, in per-Tree blocks, and the contact
+        // velocity stored in the current context (previous time step).
         std::vector<typename DiscreteContactPair<T>::JacobianTreeBlock>
             jacobian_blocks;
-        jacobian_blocks.reserve(2);
-
-        // Tree A contribution to contact Jacobian Jv_W_AcBc_C.
-        if (treeA_has_dofs) {
-          const SpanningForest::Tree& tree_A = forest.trees(tree_A_index);
-          Matrix3X<T> J = R_WC.matrix().transpose() *
-                          Jv_AcBc_W.middleCols(tree_A.v_start(), tree_A.nv());
-          jacobian_blocks.emplace_back(tree_A_index,
-                                       MatrixBlock<T>(std::move(J)));
-        }
-
-        // Tree B contribution to contact Jacobian Jv_W_AcBc_C.
-        // This contribution must be added only if B is different from A.
-        if ((treeB_has_dofs && !treeA_has_dofs) ||
-            (treeB_has_dofs && tree_B_index != tree_A_index)) {
-          const SpanningForest::Tree& tree_B = forest.trees(tree_B_index);
-          Matrix3X<T> J = R_WC.matrix().transpose() *
-                          Jv_AcBc_W.middleCols(tree_B.v_start(), tree_B.nv());
-          jacobian_blocks.emplace_back(tree_B_index,
-                                       MatrixBlock<T>(std::move(J)));
-        }
+        const Vector3<T> v_AcBc_W =
+            CalcContactJacobianTreeBlocks(context, body_A, body_B, p_WC, R_WC,
+                                          &jacobian_scratch, &jacobian_blocks);
+        const Vector3<T> v_AcBc_C = R_WC.transpose() * v_AcBc_W;
+        const T vn0 = v_AcBc_C(2);
 
         // For a triangle, its centroid has the fixed barycentric
         // coordinates independent of the shape of the triangle. Using
@@ -24,6 +24,7 @@
 #include "drake/multibody/plant/geometry_contact_data.h"
 #include "drake/multibody/plant/hydroelastic_contact_info.h"
 #include "drake/multibody/plant/scalar_convertible_component.h"
+#include "drake/multibody/tree/block_system_jacobian_cache.h"
 #include "drake/multibody/tree/multibody_tree.h"
 #include "drake/systems/framework/context.h"
 
@@ -450,6 +451,21 @@ class DiscreteUpdateManager : public ScalarConvertibleComponent<T> {
       const systems::Context<T>& context,
       DiscreteContactData<DiscreteContactPair<T>>* result) const;
 
+  /* Helper function for the Append*() functions below. For the points Ac and
+   Bc of bodies A and B that are coincident with the contact point C (at
+   p_WC), computes the relative velocity v_AcBc_W and the blocks of the
+   contact Jacobian Jv_AcBc_C (with C's orientation given by R_WC), one for
+   each of A's and B's Trees that has dofs. The blocks are computed directly
+   from the block System Jacobian; no dense 3 x nv Jacobian is ever formed.
+   `scratch` holds workspace that callers reuse across contacts. */
+  Vector3<T> CalcContactJacobianTreeBlocks(
+      const systems::Context<T>& context, const RigidBody<T>& body_A,
+      const RigidBody<T>& body_B, const Vector3<T>& p_WC,
+      const math::RotationMatrix<T>& R_WC,
+      std::vector<JacobianTreeColumns<T>>* scratch,
+      std::vector<typename DiscreteContactPair<T>::JacobianTreeBlock>*
+          jacobian_blocks) const;
+
   /* Helper function for CalcDiscreteContactPairs() that computes all contact
    pairs from hydroelastic contact, if any. */
   void AppendDiscreteContactPairsForHydroelasticContact(
@@ -0,0 +1,184 @@
+#include "drake/multibody/plant/kernel_codegen.h"
+
+#include <memory>
+#include <sstream>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/symbolic/codegen.h"
+#include "drake/multibody/tree/multibody_forces.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+using symbolic::Expression;
+using symbolic::Variable;
+
+namespace {
+
+// Copies the variables of `vars` into a std::vector, as symbolic::CodeGen()
+// wants them.
+std::vector<Variable> ToVector(const VectorX<Variable>& vars) {
+  return std::vector<Variable>(vars.data(), vars.data() + vars.size());
+}
+
+constexpr char kGeneratedNotice[] =
+    "// Generated by drake/multibody/plant/kernel_codegen.h. Do not edit.\n";
+
+// A generated function, with the parameters and the output it is generated
+// for.
+struct Kernel {
+  template <typename Derived>
+  Kernel(std::string name_in, const std::vector<Variable>& parameters_in,
+         const Eigen::PlainObjectBase<Derived>& output)
+      : name(std::move(name_in)),
+        parameters(&parameters_in),
+        data(output.data()),
+        rows(output.rows()),
+        cols(output.cols()) {}
+
+  std::string name;
+  const std::vector<Variable>* parameters{};
+  // The output, in column-major order.
+  const Expression* data{};
+  int rows{};
+  int cols{};
+};
+
+std::vector<Kernel> MakeKernels(const KernelExpressions& kernels,
+                                const std::string& prefix,
+                                const std::vector<Variable>& q_v_vdot) {
+  return {
+      {prefix + "_body_poses", kernels.q, kernels.body_poses},
+      {prefix + "_body_jacobians", kernels.q, kernels.body_jacobians},
+      {prefix + "_mass_matrix", kernels.q, kernels.mass_matrix},
+      {prefix + "_inverse_dynamics", q_v_vdot, kernels.inverse_dynamics},
+  };
+}
+
+std::vector<Variable> ConcatenateQVVdot(const KernelExpressions& kernels) {
+  std::vector<Variable> q_v_vdot = kernels.q;
+  q_v_vdot.insert(q_v_vdot.end(), kernels.v.begin(), kernels.v.end());
+  q_v_vdot.insert(q_v_vdot.end(), kernels.vdot.begin(), kernels.vdot.end());
+  return q_v_vdot;
+}
+
+}  // namespace
+
+KernelExpressions CalcKernelExpressions(const MultibodyPlant<double>& plant) {
+  DRAKE_THROW_UNLESS(plant.is_finalized());
+  const std::unique_ptr<MultibodyPlant<Expression>> plant_sym =
+      systems::System<double>::ToSymbolic(plant);
+  const int nq = plant_sym->num_positions();
+  const int nv = plant_sym->num_velocities();
+  const int nb = plant_sym->num_bodies() - 1;
+
+  const VectorX<Variable> q = symbolic::MakeVectorVariable(nq, "q");
+  const VectorX<Variable> v = symbolic::MakeVectorVariable(nv, "v");
+  const VectorX<Variable> vdot = symbolic::MakeVectorVariable(nv, "vdot");
+
+  KernelExpressions result;
+  result.q = ToVector(q);
+  result.v = ToVector(v);
+  result.vdot = ToVector(vdot);
+
+  std::unique_ptr<systems::Context<Expression>> context =
+      plant_sym->CreateDefaultContext();
+  plant_sym->SetPositions(context.get(), q.cast<Expression>());
+  plant_sym->SetVelocities(context.get(), v.cast<Expression>());
+
+  const Frame<Expression>& world_frame = plant_sym->world_frame();
+  result.body_names.reserve(nb);
+  result.body_poses.resize(12, nb);
+  result.body_jacobians.resize(6 * nb, nv);
+  MatrixX<Expression> Jv_V_WB_W(6, nv);
+  for (BodyIndex body_index(1); body_index <= nb; ++body_index) {
+    const RigidBody<Expression>& body = plant_sym->get_body(body_index);
+    const int i = body_index - 1;
+    result.body_names.push_back(body.scoped_name().to_string());
+
+    const math::RigidTransform<Expression>& X_WB =
+        plant_sym->EvalBodyPoseInWorld(*context, body);
+    const Matrix3<Expression>& R_WB = X_WB.rotation().matrix();
+    result.body_poses.col(i).head<9>() =
+        Eigen::Map<const Vector<Expression, 9>>(R_WB.data());
+    result.body_poses.col(i).tail<3>() = X_WB.translation();
+
+    plant_sym->CalcJacobianSpatialVelocity(
+        *context, JacobianWrtVariable::kV, body.body_frame(),
+        Vector3<Expression>::Zero(), world_frame, world_frame, &Jv_V_WB_W);
+    result.body_jacobians.middleRows(6 * i, 6) = Jv_V_WB_W;
+  }
+
+  result.mass_matrix.resize(nv, nv);
+  plant_sym->CalcMassMatrix(*context, &result.mass_matrix);
+
+  MultibodyForces<Expression> forces(*plant_sym);
+  plant_sym->CalcForceElementsContribution(*context, &forces);
+  result.inverse_dynamics = plant_sym->CalcInverseDynamics(
+      *context, vdot.cast<Expression>(), forces);
+
+  return result;
+}
+
+std::string GenerateKernelSource(const KernelExpressions& kernels,
+                                 const std::string& prefix,
+                                 const std::string& header_include) {
+  const std::vector<Variable> q_v_vdot = ConcatenateQVVdot(kernels);
+  std::ostringstream oss;
+  oss << kGeneratedNotice;
+  oss << "// clang-format off\n";
+  oss << "// NOLINTBEGIN\n";
+  oss << fmt::format("#include \"{}\"\n\n", header_include);
+  oss << "#include <math.h>\n\n";
+  // The same as symbolic::CodeGen(), except that the <name>_meta_t types are
+  // declared by the header instead.
+  for (const Kernel& kernel : MakeKernels(kernels, prefix, q_v_vdot)) {
+    symbolic::internal::CodeGenDenseData(kernel.name, *kernel.parameters,
+                                         kernel.data, kernel.rows * kernel.cols,
+                                         &oss);
+    oss << fmt::format(
+        "{0}_meta_t {0}_meta() {{ return {{{{{1}}}, {{{2}, {3}}}}}; }}\n",
+        kernel.name, kernel.parameters->size(), kernel.rows, kernel.cols);
+  }
+  oss << "// NOLINTEND\n";
+  return oss.str();
+}
+
+std::string GenerateKernelHeader(const KernelExpressions& kernels,
+                                 const std::string& prefix) {
+  const std::vector<Variable> q_v_vdot = ConcatenateQVVdot(kernels);
+  std::ostringstream oss;
+  oss << kGeneratedNotice;
+  oss << "// clang-format off\n";
+  oss << "// NOLINTBEGIN\n";
+  oss << "#pragma once\n\n";
+  oss << fmt::format("constexpr int {}_num_positions = {};\n", prefix,
+                     kernels.num_positions());
+  oss << fmt::format("constexpr int {}_num_velocities = {};\n", prefix,
+                     kernels.num_velocities());
+  oss << fmt::format("constexpr int {}_num_bodies = {};\n", prefix,
+                     kernels.num_bodies());
+  for (const Kernel& kernel : MakeKernels(kernels, prefix, q_v_vdot)) {
+    // The <name>_meta_t type matches the one of symbolic::CodeGen().
+    oss << "\n";
+    oss << "typedef struct {\n"
+           "    /* p: input, vector */\n"
+           "    struct { int size; } p;\n"
+           "    /* m: output, matrix */\n"
+           "    struct { int rows; int cols; } m;\n"
+           "} "
+        << kernel.name << "_meta_t;\n";
+    oss << fmt::format("void {}(const double* p, double* m);\n", kernel.name);
+    oss << fmt::format("{0}_meta_t {0}_meta();\n", kernel.name);
+  }
+  oss << "// NOLINTEND\n";
+  return oss.str();
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic/expression.h"
+#include "drake/multibody/plant/multibody_plant.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/* Symbolic expressions for the kinematics and dynamics of a fixed model, as
+functions of its generalized positions q, velocities v, and accelerations v̇.
+Once generated into C++ by GenerateKernelSource(), these evaluate without any
+of the run-time generality of MultibodyPlant: no joint-type dispatch, no
+caching, and no dynamically-sized storage. */
+struct KernelExpressions {
+  int num_positions() const { return ssize(q); }
+  int num_velocities() const { return ssize(v); }
+  int num_bodies() const { return body_poses.cols(); }
+
+  std::vector<symbolic::Variable> q;
+  std::vector<symbolic::Variable> v;
+  std::vector<symbolic::Variable> vdot;
+
+  /* Names of the bodies, in the order of the columns of body_poses. World is
+  excluded, so body_names[i] is the body with BodyIndex i + 1. */
+  std::vector<std::string> body_names;
+
+  /* 12 x num_bodies(). Column i holds the pose X_WB of body B = body_names[i]
+  as the 9 entries of R_WB (column major), followed by p_WoBo_W. A function of
+  q. */
+  MatrixX<symbolic::Expression> body_poses;
+
+  /* 6 num_bodies() x nv. Rows 6 i to 6 i + 5 hold Jv_V_WB_W, the Jacobian with
+  respect to v of the spatial velocity of body B = body_names[i] (at Bo) in
+  World, expressed in World, with the rotational part first. A function of q.
+  */
+  MatrixX<symbolic::Expression> body_jacobians;
+
+  /* The nv x nv mass matrix M(q), see MultibodyPlant::CalcMassMatrix(). */
+  MatrixX<symbolic::Expression> mass_matrix;
+
+  /* The generalized forces τ = M(q)v̇ + C(q, v)v − τₑ(q, v) needed to produce
+  the accelerations v̇, where τₑ are the generalized forces due to the force
+  elements of the model (e.g., gravity) and joint damping. A function of q, v,
+  and v̇. */
+  VectorX<symbolic::Expression> inverse_dynamics;
+};
+
+/* Computes the KernelExpressions for the given `plant`, with all parameters
+at their default values.
+@throws std::exception if `plant` is not finalized or does not support
+        scalar conversion to symbolic::Expression. */
+KernelExpressions CalcKernelExpressions(const MultibodyPlant<double>& plant);
+
+/* Generates C++ source code that defines the functions below, for the given
+`prefix`. Each function writes into `m` in column-major order and has a
+companion `<name>_meta()` reporting its sizes in a `<name>_meta_t`; see
+symbolic::CodeGen().
+
+  // p = q; m is 12 x nb, see KernelExpressions::body_poses.
+  void <prefix>_body_poses(const double* p, double* m);
+  // p = q; m is 6 nb x nv, see KernelExpressions::body_jacobians.
+  void <prefix>_body_jacobians(const double* p, double* m);
+  // p = q; m is nv x nv.
+  void <prefix>_mass_matrix(const double* p, double* m);
+  // p = [q; v; v̇]; m is nv x 1.
+  void <prefix>_inverse_dynamics(const double* p, double* m);
+
+The output includes <math.h> and `header_include`, which must name the header
+generated by GenerateKernelHeader() for the same `prefix` (so that every
+function is declared before it is defined). It has no dependencies on Drake.
+@pre `prefix` is a valid C identifier. */
+std::string GenerateKernelSource(const KernelExpressions& kernels,
+                                 const std::string& prefix,
+                                 const std::string& header_include);
+
+/* Generates a C++ header declaring the functions defined by
+GenerateKernelSource(), their `<name>_meta()` companions and `<name>_meta_t`
+types, plus constants `<prefix>_num_positions`, `<prefix>_num_velocities`, and
+`<prefix>_num_bodies`. */
+std::string GenerateKernelHeader(const KernelExpressions& kernels,
+                                 const std::string& prefix);
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -17,6 +17,7 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/drake_export.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/random.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/math/rigid_transform.h"
@@ -3747,6 +3748,26 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
   /// cache.
   /// @{
 
+  /// Sets the parallelism used by the articulated body algorithm, which
+  /// computes forward dynamics for continuous-time plants (see
+  /// @ref mbp_equations_of_motion "Equations of motion"). When more than one
+  /// thread is requested, the sweeps over each of the
+  /// independent kinematic trees of the model run concurrently; this pays off
+  /// for models with many trees, e.g., dozens of free bodies in a bin. Models
+  /// with a single tree and symbolic::Expression scalars are always computed
+  /// serially. The default is Parallelism::None().
+  ///
+  /// This setting is not part of the Context and may be changed at any time,
+  /// pre- or post-finalize.
+  void SetForwardDynamicsParallelism(Parallelism parallelism) {
+    mutable_tree().set_forward_dynamics_parallelism(parallelism);
+  }
+
+  /// Returns the parallelism set by SetForwardDynamicsParallelism().
+  Parallelism forward_dynamics_parallelism() const {
+    return internal_tree().forward_dynamics_parallelism();
+  }
+
   /// Evaluate the pose `X_WB` of a body B in the world frame W.
   /// @param[in] context
   ///   The context storing the state of the model.
@@ -4224,6 +4245,90 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
                                                external_forces);
   }
 
+  /// Computes the partial derivatives of the generalized forces required to
+  /// attain the generalized accelerations `known_vdot`, under the effect of
+  /// gravity and `external_forces`, with respect to the state and `known_vdot`.
+  /// That is, this method differentiates <pre>
+  ///   tau_id = M(q)v̇ + C(q, v)v - tau_g(q) - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W
+  /// </pre>
+  /// which equals `CalcInverseDynamics(context, known_vdot, external_forces) -
+  /// CalcGravityGeneralizedForces(context)`. The applied generalized forces
+  /// `tau_app` and spatial forces `Fapp_Bo_W` in `external_forces` are held
+  /// constant (in particular, `Fapp_Bo_W` stays fixed in the world frame W as
+  /// the bodies move). Other force elements are not included.
+  ///
+  /// The derivatives are computed analytically, differentiating the recursive
+  /// Newton-Euler algorithm in `O(n⋅d)` operations (with n the number of
+  /// bodies and d the depth of the tree) rather than with automatic
+  /// differentiation. For positions in quaternions, the derivatives are those
+  /// of the normalized quaternion, consistent with how the quaternion is
+  /// interpreted everywhere else.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] known_vdot
+  ///   A vector with the known generalized accelerations `vdot` for the full
+  ///   model.
+  /// @param[in] external_forces
+  ///   A set of forces to be applied to the system either as body spatial
+  ///   forces `Fapp_Bo_W` or generalized forces `tau_app`, see MultibodyForces
+  ///   for details.
+  /// @param[out] dtau_dq
+  ///   On output, the `nv x nq` matrix ∂tau_id/∂q.
+  /// @param[out] dtau_dv
+  ///   On output, the `nv x nv` matrix ∂tau_id/∂v.
+  /// @param[out] dtau_dvdot
+  ///   On output, the `nv x nv` matrix ∂tau_id/∂v̇, which is the mass matrix
+  ///   M(q), see CalcMassMatrix().
+  /// @throws std::exception if any of the outputs is nullptr or has the wrong
+  ///   size, or if `external_forces` is not compatible with this model.
+  /// @throws std::exception if the model contains a joint whose hinge matrix
+  ///   depends on its positions (a UniversalJoint or a CurvilinearJoint).
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      const MultibodyForces<T>& external_forces, EigenPtr<MatrixX<T>> dtau_dq,
+      EigenPtr<MatrixX<T>> dtau_dv, EigenPtr<MatrixX<T>> dtau_dvdot) const {
+    this->ValidateContext(context);
+    internal_tree().CalcInverseDynamicsDerivatives(
+        context, known_vdot, external_forces, dtau_dq, dtau_dv, dtau_dvdot);
+  }
+
+  /// Computes the partial derivatives of the generalized accelerations <pre>
+  ///   v̇ = M(q)⁻¹⋅(tau_g(q) + tau_app + ∑ J_WBᵀ(q) Fapp_Bo_W - C(q, v)v)
+  /// </pre>
+  /// with respect to the state and to `tau_app`, where `tau_app` and the
+  /// spatial forces `Fapp_Bo_W` are given by `applied_forces`. Since `v̇`
+  /// solves `tau_id(q, v, v̇) = 0` (see CalcInverseDynamicsDerivatives()), the
+  /// derivatives are computed as `∂v̇/∂x = -M⁻¹⋅∂tau_id/∂x` and `∂v̇/∂tau_app =
+  /// M⁻¹`. Only gravity and `applied_forces` are considered; to include other
+  /// forces (force elements, actuation, contact) add them to `applied_forces`,
+  /// noting that their own dependence on the state is then ignored.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] applied_forces
+  ///   The applied generalized forces `tau_app` and spatial forces `Fapp_Bo_W`,
+  ///   see MultibodyForces for details.
+  /// @param[out] dvdot_dq
+  ///   On output, the `nv x nq` matrix ∂v̇/∂q.
+  /// @param[out] dvdot_dv
+  ///   On output, the `nv x nv` matrix ∂v̇/∂v.
+  /// @param[out] dvdot_dtau
+  ///   On output, the `nv x nv` matrix ∂v̇/∂tau_app = M(q)⁻¹.
+  /// @throws std::exception if any of the outputs is nullptr or has the wrong
+  ///   size, or if `applied_forces` is not compatible with this model.
+  /// @throws std::exception if the model contains a joint whose hinge matrix
+  ///   depends on its positions (a UniversalJoint or a CurvilinearJoint).
+  void CalcForwardDynamicsDerivatives(const systems::Context<T>& context,
+                                      const MultibodyForces<T>& applied_forces,
+                                      EigenPtr<MatrixX<T>> dvdot_dq,
+                                      EigenPtr<MatrixX<T>> dvdot_dv,
+                                      EigenPtr<MatrixX<T>> dvdot_dtau) const {
+    this->ValidateContext(context);
+    internal_tree().CalcForwardDynamicsDerivatives(
+        context, applied_forces, dvdot_dq, dvdot_dv, dvdot_dtau);
+  }
+
 #ifdef DRAKE_DOXYGEN_CXX
   // MultibodyPlant uses the NVI implementation of
   // CalcImplicitTimeDerivativesResidual from
@@ -4520,6 +4625,28 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
     internal_tree().CalcMassMatrix(context, M);
   }
 
+  /// Computes a sparse `Lᵀ⋅D⋅L` factorization of the mass matrix `M(q)` that
+  /// exploits the branch-induced sparsity of the kinematic trees. The result
+  /// solves `M⋅x = b` and computes `M⋅x` in `O(n⋅d)` without forming a dense
+  /// matrix, where n is num_velocities() and d is the depth of the deepest
+  /// generalized velocity; see MassMatrixFactorization for details. For models
+  /// made of several shallow trees (e.g., multiple robot arms) this is far
+  /// cheaper than a dense Cholesky factorization of the result of
+  /// CalcMassMatrix().
+  ///
+  /// The factored matrix includes the same terms as CalcMassMatrix(), and the
+  /// MassMatrixFactorization::parent_indices() of the result encode the
+  /// velocity ordering of `this` plant.
+  ///
+  /// @param[in] context
+  ///   The Context containing the state of the model from which generalized
+  ///   coordinates q are extracted.
+  MassMatrixFactorization<T> CalcMassMatrixFactorization(
+      const systems::Context<T>& context) const {
+    this->ValidateContext(context);
+    return internal_tree().CalcMassMatrixFactorization(context);
+  }
+
   /// This method allows users to map the state of `this` model, x, into a
   /// vector of selected state xₛ with a given preferred ordering.
   /// The mapping, or selection, is returned in the form of a selector matrix
@@ -4686,6 +4813,35 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
     return sjc.ToFullMatrix();
   }
 
+  /// (Internal use only) For many points at once, calculates each point's
+  /// spatial velocity Jacobian in World with respect to v, in the per-Tree
+  /// block form of EvalBlockSystemJacobian(). For each i, point Pᵢ is fixed to
+  /// `*frames[i]` (frame Fᵢ) at position `p_FP_list.col(i)`, expressed in Fᵢ.
+  /// On return, entry i of `Jv_V_WP_W_blocks` holds the columns of
+  /// Jv_V_WPᵢ_W (6 x nv, rotational part first, expressed in World) that
+  /// belong to the Tree of Fᵢ's body; all the other columns are zero. See
+  /// internal::JacobianTreeColumns for details.
+  ///
+  /// All the points share one evaluation of the block System Jacobian, and
+  /// each only touches the columns of its body's inboard path. That is much
+  /// cheaper than calling CalcJacobianSpatialVelocity() once per point, which
+  /// walks the path to World and fills in all nv columns each time. The
+  /// storage in `Jv_V_WP_W_blocks` is reused when the frames are the same
+  /// from one call to the next.
+  /// @throws std::exception if `Jv_V_WP_W_blocks` is nullptr, if any entry
+  ///   of `frames` is nullptr, or if `p_FP_list` does not have one column per
+  ///   frame.
+  /// @see CalcJacobianSpatialVelocity()
+  void CalcJacobianSpatialVelocityTreeBlocks(
+      const systems::Context<T>& context,
+      const std::vector<const Frame<T>*>& frames,
+      const Eigen::Ref<const Matrix3X<T>>& p_FP_list,
+      std::vector<internal::JacobianTreeColumns<T>>* Jv_V_WP_W_blocks) const {
+    this->ValidateContext(context);
+    internal_tree().CalcJacobianSpatialVelocityTreeBlocks(
+        context, frames, p_FP_list, Jv_V_WP_W_blocks);
+  }
+
   /// For one point Bp fixed/welded to a frame B, calculates J𝑠_V_ABp, Bp's
   /// spatial velocity Jacobian in frame A with respect to "speeds" 𝑠.
   /// <pre>
@@ -0,0 +1,152 @@
+#include "drake/multibody/plant/kernel_codegen.h"
+
+#include <memory>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/benchmarks/acrobot/make_acrobot_plant.h"
+#include "drake/multibody/tree/multibody_forces.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using benchmarks::acrobot::AcrobotParameters;
+using benchmarks::acrobot::MakeAcrobotPlant;
+using symbolic::Environment;
+using symbolic::Expression;
+
+constexpr double kTolerance = 1e-12;
+
+class KernelCodegenTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    plant_ = MakeAcrobotPlant(AcrobotParameters(), true);
+    context_ = plant_->CreateDefaultContext();
+    kernels_ = CalcKernelExpressions(*plant_);
+  }
+
+  // Sets the state of context_ and returns the matching environment.
+  Environment MakeEnvironment(const Eigen::VectorXd& q,
+                              const Eigen::VectorXd& v,
+                              const Eigen::VectorXd& vdot) {
+    plant_->SetPositions(context_.get(), q);
+    plant_->SetVelocities(context_.get(), v);
+    Environment env;
+    for (int i = 0; i < q.size(); ++i) env.insert(kernels_.q[i], q(i));
+    for (int i = 0; i < v.size(); ++i) {
+      env.insert(kernels_.v[i], v(i));
+      env.insert(kernels_.vdot[i], vdot(i));
+    }
+    return env;
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<systems::Context<double>> context_;
+  KernelExpressions kernels_;
+};
+
+TEST_F(KernelCodegenTest, Sizes) {
+  EXPECT_EQ(kernels_.num_positions(), 2);
+  EXPECT_EQ(kernels_.num_velocities(), 2);
+  EXPECT_EQ(kernels_.num_bodies(), 2);
+  ASSERT_EQ(kernels_.body_names.size(), 2);
+  EXPECT_EQ(kernels_.body_jacobians.rows(), 12);
+  EXPECT_EQ(kernels_.body_jacobians.cols(), 2);
+  EXPECT_EQ(kernels_.mass_matrix.rows(), 2);
+  EXPECT_EQ(kernels_.inverse_dynamics.size(), 2);
+}
+
+// The expressions must agree with MultibodyPlant<double> at arbitrary states.
+TEST_F(KernelCodegenTest, MatchesPlant) {
+  const Eigen::Vector2d q(0.3, -1.2);
+  const Eigen::Vector2d v(0.5, 2.0);
+  const Eigen::Vector2d vdot(-1.5, 0.7);
+  const Environment env = MakeEnvironment(q, v, vdot);
+
+  for (int i = 0; i < kernels_.num_bodies(); ++i) {
+    const RigidBody<double>& body = plant_->get_body(BodyIndex(i + 1));
+    EXPECT_EQ(kernels_.body_names[i], body.scoped_name().to_string());
+
+    const math::RigidTransformd& X_WB =
+        plant_->EvalBodyPoseInWorld(*context_, body);
+    const Eigen::VectorXd pose =
+        symbolic::Evaluate(kernels_.body_poses.col(i), env);
+    EXPECT_TRUE(CompareMatrices(
+        pose.head<9>(),
+        Eigen::Map<const Vector<double, 9>>(X_WB.rotation().matrix().data()),
+        kTolerance));
+    EXPECT_TRUE(CompareMatrices(pose.tail<3>(), X_WB.translation(),
+                                kTolerance));
+
+    Eigen::MatrixXd Jv_V_WB_W(6, 2);
+    plant_->CalcJacobianSpatialVelocity(
+        *context_, JacobianWrtVariable::kV, body.body_frame(),
+        Eigen::Vector3d::Zero(), plant_->world_frame(), plant_->world_frame(),
+        &Jv_V_WB_W);
+    EXPECT_TRUE(CompareMatrices(
+        symbolic::Evaluate(kernels_.body_jacobians.middleRows(6 * i, 6), env),
+        Jv_V_WB_W, kTolerance));
+  }
+
+  Eigen::MatrixXd M(2, 2);
+  plant_->CalcMassMatrix(*context_, &M);
+  EXPECT_TRUE(CompareMatrices(symbolic::Evaluate(kernels_.mass_matrix, env), M,
+                              kTolerance));
+
+  MultibodyForces<double> forces(*plant_);
+  plant_->CalcForceElementsContribution(*context_, &forces);
+  const Eigen::VectorXd tau =
+      plant_->CalcInverseDynamics(*context_, vdot, forces);
+  EXPECT_TRUE(CompareMatrices(
+      symbolic::Evaluate(kernels_.inverse_dynamics, env), tau, kTolerance));
+}
+
+TEST_F(KernelCodegenTest, GenerateSource) {
+  const std::string source =
+      GenerateKernelSource(kernels_, "acrobot", "acrobot_kernels.h");
+  const std::string header = GenerateKernelHeader(kernels_, "acrobot");
+
+  // The source includes the header, and nothing from Drake.
+  EXPECT_NE(source.find("#include \"acrobot_kernels.h\""), std::string::npos);
+  EXPECT_EQ(source.find("#include \"drake"), std::string::npos);
+
+  // The header declares everything the source defines, and the source defines
+  // no types (which would clash with the header's).
+  EXPECT_NE(header.find("#pragma once"), std::string::npos);
+  EXPECT_EQ(source.find("typedef"), std::string::npos);
+  for (const char* name :
+       {"acrobot_body_poses", "acrobot_body_jacobians", "acrobot_mass_matrix",
+        "acrobot_inverse_dynamics"}) {
+    const std::string function =
+        fmt::format("void {}(const double* p, double* m)", name);
+    EXPECT_NE(source.find(function + " {"), std::string::npos) << name;
+    EXPECT_NE(header.find(function + ";"), std::string::npos) << name;
+    const std::string meta = fmt::format("{0}_meta_t {0}_meta()", name);
+    EXPECT_NE(source.find(meta + " {"), std::string::npos) << name;
+    EXPECT_NE(header.find(meta + ";"), std::string::npos) << name;
+    EXPECT_NE(header.find(fmt::format("}} {}_meta_t;", name)),
+              std::string::npos)
+        << name;
+  }
+  EXPECT_NE(source.find("acrobot_mass_matrix_meta() { return {{2}, {2, 2}}; }"),
+            std::string::npos);
+  EXPECT_NE(source.find(
+                "acrobot_inverse_dynamics_meta() { return {{6}, {2, 1}}; }"),
+            std::string::npos);
+
+  EXPECT_NE(header.find("constexpr int acrobot_num_positions = 2;"),
+            std::string::npos);
+  EXPECT_NE(header.find("constexpr int acrobot_num_velocities = 2;"),
+            std::string::npos);
+  EXPECT_NE(header.find("constexpr int acrobot_num_bodies = 2;"),
+            std::string::npos);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
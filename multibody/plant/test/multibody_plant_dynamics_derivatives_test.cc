@@ -0,0 +1,259 @@
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/ball_rpy_joint.h"
+#include "drake/multibody/tree/planar_joint.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/quaternion_floating_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rpy_floating_joint.h"
+#include "drake/multibody/tree/screw_joint.h"
+#include "drake/multibody/tree/universal_joint.h"
+#include "drake/multibody/tree/weld_joint.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+constexpr double kTolerance = 1e-10;
+
+// Returns a spatial inertia with an offset center of mass and a rotated
+// central inertia, so that no term of the dynamics vanishes by symmetry.
+SpatialInertia<double> MakeInertia(double mass, const Vector3d& p_BoBcm_B) {
+  const RotationalInertia<double> I_BBcm_B =
+      RotationalInertia<double>(0.3, 0.4, 0.5)
+          .ReExpress(math::RotationMatrixd(RollPitchYawd(0.2, -0.4, 0.7)));
+  return SpatialInertia<double>::MakeFromCentralInertia(mass, p_BoBcm_B,
+                                                        I_BBcm_B);
+}
+
+// Returns a pose used as a joint frame offset.
+RigidTransformd MakeOffset(double a, double b, double c) {
+  return RigidTransformd(RollPitchYawd(a, b, c), Vector3d(c, a, b));
+}
+
+// Builds a tree with every joint type that has a constant hinge matrix, in
+// two model instances, one of which is not subject to gravity.
+class DynamicsDerivativesTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.0);
+    MultibodyPlant<double>& plant = *plant_;
+    const ModelInstanceIndex arm = plant.AddModelInstance("arm");
+    const ModelInstanceIndex drone = plant.AddModelInstance("drone");
+
+    const RigidBody<double>& base =
+        plant.AddRigidBody("base", arm, MakeInertia(2.0, {0.1, -0.2, 0.3}));
+    const RigidBody<double>& link1 =
+        plant.AddRigidBody("link1", arm, MakeInertia(1.5, {0.2, 0.1, -0.1}));
+    const RigidBody<double>& link2 =
+        plant.AddRigidBody("link2", arm, MakeInertia(1.2, {-0.1, 0.3, 0.2}));
+    const RigidBody<double>& link3 =
+        plant.AddRigidBody("link3", arm, MakeInertia(0.8, {0.3, 0.0, 0.1}));
+    const RigidBody<double>& link4 =
+        plant.AddRigidBody("link4", arm, MakeInertia(1.1, {0.0, -0.2, 0.2}));
+    const RigidBody<double>& link5 =
+        plant.AddRigidBody("link5", arm, MakeInertia(0.9, {0.1, 0.2, 0.0}));
+    const RigidBody<double>& link6 =
+        plant.AddRigidBody("link6", arm, MakeInertia(0.5, {-0.2, 0.1, 0.3}));
+    const RigidBody<double>& hull =
+        plant.AddRigidBody("hull", drone, MakeInertia(3.0, {0.0, 0.1, -0.1}));
+    const RigidBody<double>& rotor =
+        plant.AddRigidBody("rotor", drone, MakeInertia(0.4, {0.1, 0.1, 0.1}));
+
+    plant.AddJoint<QuaternionFloatingJoint>("base_joint", plant.world_body(),
+                                            MakeOffset(0.1, 0.2, 0.3), base,
+                                            MakeOffset(-0.3, 0.1, 0.2));
+    plant.AddJoint<RevoluteJoint>("revolute", base, MakeOffset(0.4, -0.1, 0.2),
+                                  link1, MakeOffset(0.2, 0.3, -0.1),
+                                  Vector3d(0.3, 0.5, 0.8).normalized());
+    plant.AddJoint<PrismaticJoint>("prismatic", link1,
+                                   MakeOffset(-0.2, 0.3, 0.1), link2,
+                                   MakeOffset(0.1, 0.1, 0.4),
+                                   Vector3d(-0.6, 0.0, 0.8));
+    plant.AddJoint<ScrewJoint>("screw", link2, MakeOffset(0.3, 0.2, -0.3),
+                               link3, MakeOffset(0.2, -0.2, 0.1),
+                               Vector3d(0.0, 0.6, 0.8), 0.05, 0.0);
+    // A branch off of link1.
+    plant.AddJoint<BallRpyJoint>("ball", link1, MakeOffset(0.1, -0.3, 0.2),
+                                 link4, MakeOffset(-0.1, 0.2, 0.3));
+    plant.AddJoint<PlanarJoint>("planar", link4, MakeOffset(0.2, 0.1, 0.1),
+                                link5, MakeOffset(0.3, -0.1, -0.2),
+                                Vector3d::Zero());
+    plant.AddJoint<WeldJoint>("weld", link5, MakeOffset(0.1, 0.1, 0.2), link6,
+                              MakeOffset(0.2, 0.0, 0.1),
+                              RigidTransformd::Identity());
+    plant.AddJoint<RpyFloatingJoint>("drone_joint", plant.world_body(),
+                                     MakeOffset(0.2, -0.1, 0.3), hull,
+                                     MakeOffset(0.1, 0.2, 0.1));
+    plant.AddJoint<RevoluteJoint>("rotor_joint", hull,
+                                  MakeOffset(0.0, 0.1, 0.2), rotor,
+                                  std::nullopt, Vector3d::UnitZ());
+    plant.set_gravity_enabled(drone, false);
+    plant.Finalize();
+
+    context_ = plant.CreateDefaultContext();
+    const int nq = plant.num_positions();
+    const int nv = plant.num_velocities();
+    VectorXd q = VectorXd::LinSpaced(nq, -1.1, 1.3);
+    const int quaternion_start =
+        plant.GetJointByName("base_joint").position_start();
+    q.segment<4>(quaternion_start).normalize();
+    plant.SetPositions(context_.get(), q);
+    plant.SetVelocities(context_.get(), VectorXd::LinSpaced(nv, 1.5, -0.9));
+
+    forces_ = std::make_unique<MultibodyForces<double>>(plant);
+    for (int i = 0; i < ssize(forces_->body_forces()); ++i) {
+      forces_->mutable_body_forces()[i] = SpatialForce<double>(
+          Vector3d(0.3 * i, -0.2, 0.1 + 0.1 * i), Vector3d(-0.4, 0.2 * i, 0.5));
+    }
+    forces_->mutable_generalized_forces() = VectorXd::LinSpaced(nv, -0.5, 0.7);
+
+    plant_ad_ = systems::System<double>::ToAutoDiffXd(plant);
+    context_ad_ = plant_ad_->CreateDefaultContext();
+    forces_ad_ = std::make_unique<MultibodyForces<AutoDiffXd>>(*plant_ad_);
+    for (int i = 0; i < ssize(forces_->body_forces()); ++i) {
+      forces_ad_->mutable_body_forces()[i] = SpatialForce<AutoDiffXd>(
+          forces_->body_forces()[i].get_coeffs().cast<AutoDiffXd>());
+    }
+    forces_ad_->mutable_generalized_forces() =
+        forces_->generalized_forces().cast<AutoDiffXd>();
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<MultibodyForces<double>> forces_;
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_ad_;
+  std::unique_ptr<Context<AutoDiffXd>> context_ad_;
+  std::unique_ptr<MultibodyForces<AutoDiffXd>> forces_ad_;
+};
+
+TEST_F(DynamicsDerivativesTest, InverseDynamics) {
+  const MultibodyPlant<double>& plant = *plant_;
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  const VectorXd vdot = VectorXd::LinSpaced(nv, 0.8, -1.2);
+
+  MatrixXd dtau_dq(nv, nq);
+  MatrixXd dtau_dv(nv, nv);
+  MatrixXd dtau_dvdot(nv, nv);
+  plant.CalcInverseDynamicsDerivatives(*context_, vdot, *forces_, &dtau_dq,
+                                       &dtau_dv, &dtau_dvdot);
+
+  // Differentiate tau_id = ID(q, v, v̇) - tau_g(q) with automatic
+  // differentiation, with respect to x = [q; v; v̇].
+  VectorXd x(nq + 2 * nv);
+  x << plant.GetPositions(*context_), plant.GetVelocities(*context_), vdot;
+  const VectorX<AutoDiffXd> x_ad = math::InitializeAutoDiff(x);
+  plant_ad_->SetPositions(context_ad_.get(), x_ad.head(nq));
+  plant_ad_->SetVelocities(context_ad_.get(), x_ad.segment(nq, nv));
+  const VectorX<AutoDiffXd> tau_id =
+      plant_ad_->CalcInverseDynamics(*context_ad_, x_ad.tail(nv),
+                                     *forces_ad_) -
+      plant_ad_->CalcGravityGeneralizedForces(*context_ad_);
+  const MatrixXd dtau_dx = math::ExtractGradient(tau_id);
+
+  EXPECT_TRUE(CompareMatrices(dtau_dq, dtau_dx.leftCols(nq), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, dtau_dx.middleCols(nq, nv), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dvdot, dtau_dx.rightCols(nv), kTolerance,
+                              MatrixCompareType::relative));
+
+  // Bad arguments.
+  MatrixXd bad(nv, nv + 1);
+  EXPECT_THROW(plant.CalcInverseDynamicsDerivatives(
+                   *context_, vdot, *forces_, &bad, &dtau_dv, &dtau_dvdot),
+               std::exception);
+  EXPECT_THROW(plant.CalcInverseDynamicsDerivatives(
+                   *context_, vdot, *forces_, &dtau_dq, nullptr, &dtau_dvdot),
+               std::exception);
+}
+
+TEST_F(DynamicsDerivativesTest, ForwardDynamics) {
+  const MultibodyPlant<double>& plant = *plant_;
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+
+  // Without applied forces, the forward dynamics are the time derivatives of
+  // the plant, computed with the articulated body algorithm.
+  const MultibodyForces<double> no_forces(plant);
+  MatrixXd dvdot_dq(nv, nq);
+  MatrixXd dvdot_dv(nv, nv);
+  MatrixXd dvdot_dtau(nv, nv);
+  plant.CalcForwardDynamicsDerivatives(*context_, no_forces, &dvdot_dq,
+                                       &dvdot_dv, &dvdot_dtau);
+
+  const VectorX<AutoDiffXd> x_ad =
+      math::InitializeAutoDiff(plant.GetPositionsAndVelocities(*context_));
+  plant_ad_->SetPositionsAndVelocities(context_ad_.get(), x_ad);
+  const VectorX<AutoDiffXd> vdot = plant_ad_->EvalTimeDerivatives(*context_ad_)
+                                       .get_generalized_velocity()
+                                       .CopyToVector();
+  const MatrixXd dvdot_dx = math::ExtractGradient(vdot);
+  EXPECT_TRUE(CompareMatrices(dvdot_dq, dvdot_dx.leftCols(nq), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dvdot_dv, dvdot_dx.rightCols(nv), kTolerance,
+                              MatrixCompareType::relative));
+
+  MatrixXd M(nv, nv);
+  plant.CalcMassMatrix(*context_, &M);
+  EXPECT_TRUE(CompareMatrices(M * dvdot_dtau, MatrixXd::Identity(nv, nv),
+                              kTolerance));
+
+  // With applied forces, the accelerations solve the inverse dynamics, and so
+  // the derivatives satisfy M⋅∂v̇/∂x = -∂tau_id/∂x.
+  plant.CalcForwardDynamicsDerivatives(*context_, *forces_, &dvdot_dq,
+                                       &dvdot_dv, &dvdot_dtau);
+  const VectorXd vdot_applied = M.llt().solve(
+      plant.CalcGravityGeneralizedForces(*context_) -
+      plant.CalcInverseDynamics(*context_, VectorXd::Zero(nv), *forces_));
+  MatrixXd dtau_dq(nv, nq);
+  MatrixXd dtau_dv(nv, nv);
+  MatrixXd dtau_dvdot(nv, nv);
+  plant.CalcInverseDynamicsDerivatives(*context_, vdot_applied, *forces_,
+                                       &dtau_dq, &dtau_dv, &dtau_dvdot);
+  EXPECT_TRUE(CompareMatrices(M * dvdot_dq, -dtau_dq, kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(M * dvdot_dv, -dtau_dv, kTolerance,
+                              MatrixCompareType::relative));
+}
+
+GTEST_TEST(DynamicsDerivativesUnsupportedTest, UniversalJoint) {
+  MultibodyPlant<double> plant(0.0);
+  const RigidBody<double>& body = plant.AddRigidBody(
+      "body", SpatialInertia<double>::SolidCubeWithMass(1.0, 0.1));
+  plant.AddJoint<UniversalJoint>("universal", plant.world_body(), std::nullopt,
+                                 body, std::nullopt);
+  plant.Finalize();
+  const auto context = plant.CreateDefaultContext();
+  const MultibodyForces<double> forces(plant);
+  MatrixXd dtau_dq(2, 2);
+  MatrixXd dtau_dv(2, 2);
+  MatrixXd dtau_dvdot(2, 2);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant.CalcInverseDynamicsDerivatives(*context, Eigen::Vector2d::Zero(),
+                                           forces, &dtau_dq, &dtau_dv,
+                                           &dtau_dvdot),
+      ".*body 'body'.*hinge matrix depends on its generalized positions.*");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -1,6 +1,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -793,6 +794,63 @@ GTEST_TEST(JointLocking, FreebodyAccelerationTest) {
   }
 }
 
+// Sweeping the independent trees of the forest concurrently must give the same
+// accelerations as the serial level-by-level sweeps.
+GTEST_TEST(MultibodyPlantForwardDynamics, ParallelTrees) {
+  MultibodyPlant<double> plant(0.0);
+  EXPECT_EQ(plant.forward_dynamics_parallelism().num_threads(), 1);
+
+  const SpatialInertia<double> M_BBo_B =
+      SpatialInertia<double>::SolidBoxWithMass(1.5, 0.1, 0.2, 0.3);
+  // A number of free bodies, and a number of double pendulums.
+  for (int i = 0; i < 6; ++i) {
+    plant.AddRigidBody(fmt::format("free{}", i), M_BBo_B);
+  }
+  std::vector<const RevoluteJoint<double>*> joints;
+  for (int i = 0; i < 4; ++i) {
+    const RigidBody<double>& upper =
+        plant.AddRigidBody(fmt::format("upper{}", i), M_BBo_B);
+    const RigidBody<double>& lower =
+        plant.AddRigidBody(fmt::format("lower{}", i), M_BBo_B);
+    joints.push_back(&plant.AddJoint<RevoluteJoint>(
+        fmt::format("shoulder{}", i), plant.world_body(),
+        RigidTransformd(Vector3d(i, 0, 0)), upper, std::nullopt,
+        Vector3d::UnitY()));
+    joints.push_back(&plant.AddJoint<RevoluteJoint>(
+        fmt::format("elbow{}", i), upper,
+        RigidTransformd(Vector3d(0, 0, -0.3)), lower, std::nullopt,
+        Vector3d::UnitX()));
+  }
+  plant.Finalize();
+  EXPECT_EQ(plant.num_velocities(), 6 * 6 + 2 * 4);
+
+  std::unique_ptr<Context<double>> context = plant.CreateDefaultContext();
+  for (int i = 0; i < ssize(joints); ++i) {
+    joints[i]->set_angle(context.get(), 0.3 * i - 1.0);
+  }
+  const VectorXd q = plant.GetPositions(*context);
+  plant.SetVelocities(context.get(),
+                      VectorXd::LinSpaced(plant.num_velocities(), 2.0, -1.0));
+  const VectorXd vdot_serial =
+      MultibodyPlantTester::CalcGeneralizedAccelerations(plant, *context);
+
+  plant.SetForwardDynamicsParallelism(Parallelism(2));
+  EXPECT_EQ(plant.forward_dynamics_parallelism().num_threads(), 2);
+  // The parallelism is not part of the Context, so we write the same state
+  // again to invalidate the cached results.
+  plant.SetPositions(context.get(), q);
+  const VectorXd vdot_parallel =
+      MultibodyPlantTester::CalcGeneralizedAccelerations(plant, *context);
+
+  // Each node's computation is unchanged; only the order across trees is.
+  EXPECT_TRUE(CompareMatrices(vdot_parallel, vdot_serial, 0.0));
+
+  // The setting carries over to scalar-converted plants.
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_ad =
+      systems::System<double>::ToAutoDiffXd(plant);
+  EXPECT_EQ(plant_ad->forward_dynamics_parallelism().num_threads(), 2);
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -1125,6 +1125,47 @@ GTEST_TEST(BlockSystemJacobian, MultipleTrees) {
   EXPECT_EQ(Jv_V_WB2.cols(), plant.num_velocities());
 
   EXPECT_TRUE(CompareMatrices(Jv_V_WB1, Jv_V_WB2, kTolerance));
+
+  // Now compute the Jacobians of a point on each body (and on World) all at
+  // once, in tree-block form, and compare to the dense per-point Jacobians.
+  std::vector<const Frame<double>*> frames;
+  for (BodyIndex body_index{0}; body_index < plant.num_bodies(); ++body_index) {
+    frames.push_back(&plant.get_body(body_index).body_frame());
+  }
+  Matrix3X<double> p_FP_list(3, ssize(frames));
+  for (int i = 0; i < ssize(frames); ++i) {
+    p_FP_list.col(i) = Vector3d(0.1 * i, -0.2, 0.3);
+  }
+  std::vector<internal::JacobianTreeColumns<double>> blocks;
+  plant.CalcJacobianSpatialVelocityTreeBlocks(*context, frames, p_FP_list,
+                                              &blocks);
+  ASSERT_EQ(ssize(blocks), ssize(frames));
+  const internal::SpanningForest& forest = plant.graph().forest();
+  MatrixX<double> Jv_V_WP_W(6, plant.num_velocities());
+  for (int i = 0; i < ssize(frames); ++i) {
+    MatrixX<double> expected(6, plant.num_velocities());
+    plant.CalcJacobianSpatialVelocity(
+        *context, JacobianWrtVariable::kV, *frames[i], p_FP_list.col(i),
+        plant.world_frame(), plant.world_frame(), &expected);
+    Jv_V_WP_W.setZero();
+    if (blocks[i].tree.is_valid()) {
+      const internal::SpanningForest::Tree& tree =
+          forest.trees(blocks[i].tree);
+      ASSERT_EQ(blocks[i].J.cols(), tree.nv());
+      Jv_V_WP_W.middleCols(tree.v_start(), tree.nv()) = blocks[i].J;
+    } else {
+      EXPECT_EQ(frames[i]->body().index(), world_index());
+    }
+    ASSERT_EQ(blocks[i].J.rows(), 6);
+    EXPECT_TRUE(CompareMatrices(Jv_V_WP_W, expected, kTolerance));
+  }
+  // The welded body can't move, so its block is empty.
+  EXPECT_EQ(blocks.back().J.cols(), 0);
+
+  // Mismatched sizes are rejected.
+  EXPECT_THROW(plant.CalcJacobianSpatialVelocityTreeBlocks(
+                   *context, frames, p_FP_list.leftCols(1), &blocks),
+               std::exception);
 }
 
 }  // namespace
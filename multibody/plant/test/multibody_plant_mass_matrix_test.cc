@@ -89,6 +89,30 @@ class MultibodyPlantMassMatrixTests : public ::testing::Test {
                              Mcba_via_W.norm() / plant_.num_velocities();
     EXPECT_TRUE(CompareMatrices(Mcba_via_W, M_via_id, tolerance,
                                 MatrixCompareType::relative));
+
+    VerifyMassMatrixFactorization(context, Mcba_via_W);
+  }
+
+  // Verifies that the tree-sparse factorization reproduces the dense mass
+  // matrix M, and that it solves and multiplies consistently with M.
+  void VerifyMassMatrixFactorization(const Context<double>& context,
+                                     const MatrixX<double>& M) {
+    const int nv = plant_.num_velocities();
+    const MassMatrixFactorization<double> factorization =
+        plant_.CalcMassMatrixFactorization(context);
+    ASSERT_EQ(factorization.size(), nv);
+
+    const MatrixX<double> L = factorization.CalcDenseL();
+    const MatrixX<double> LtDL =
+        L.transpose() * factorization.D().asDiagonal() * L;
+    const double tolerance =
+        100.0 * std::numeric_limits<double>::epsilon() * M.norm();
+    EXPECT_TRUE(CompareMatrices(LtDL, M, tolerance));
+
+    const VectorX<double> b = VectorX<double>::LinSpaced(nv, -1.0, 2.0);
+    EXPECT_TRUE(CompareMatrices(factorization.Multiply(b), M * b, tolerance));
+    EXPECT_TRUE(CompareMatrices(M * factorization.Solve(b), b,
+                                tolerance * M.inverse().norm() * b.norm()));
   }
 
  protected:
@@ -50,6 +50,20 @@ class BlockSystemJacobianCache {
   std::vector<Eigen::MatrixX<T>> block_system_jacobian_;
 };
 
+/* The nonzero part of a Jacobian with respect to v of the velocity of a point
+fixed to a single mobilized body B. Only the mobilities of B's Tree can move B,
+so every other column of such a Jacobian is zero; `J` holds the columns of
+B's Tree, starting at tree.v_start(). Within those, only the columns for the
+mobilities of B and its inboard ancestors can be nonzero. If B can't move,
+`J` has no columns; `tree` is invalid if B is World itself.
+
+@tparam_default_scalar */
+template <typename T>
+struct JacobianTreeColumns {
+  TreeIndex tree;
+  Eigen::MatrixX<T> J;
+};
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
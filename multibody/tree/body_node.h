@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
@@ -215,6 +216,18 @@ class BodyNode : public MultibodyElement<T> {
       const FrameBodyPoseCache<T>& frame_body_pose_cache, const T* positions,
       PositionKinematicsCache<T>* pc) const = 0;
 
+  // Batched version of CalcPositionKinematicsCache_BaseToTip(), invoked once
+  // per run of same-type nodes within a single level of the forest. Each node
+  // in `nodes` must have the same concrete type as `this` (`this` is usually
+  // nodes.front()), so implementations can call the per-node kernel without
+  // virtual dispatch. Nodes within a run are at the same level, so they may be
+  // processed in any order.
+  // @pre The parents of all `nodes` have already been processed.
+  virtual void CalcPositionKinematicsCacheBatch_BaseToTip(
+      std::span<const BodyNode<T>* const> nodes,
+      const FrameBodyPoseCache<T>& frame_body_pose_cache, const T* positions,
+      PositionKinematicsCache<T>* pc) const = 0;
+
   // Calculates the hinge matrix H_PB_W, the `6 x nm` hinge matrix that relates
   // `V_PB_W`(body B's spatial velocity in its parent body P, expressed in world
   // W) to this node's nm generalized velocities (or mobilities) v_B as
@@ -266,6 +279,15 @@ class BodyNode : public MultibodyElement<T> {
       const std::vector<Vector6<T>>& H_PB_W_cache, const T* velocities,
       VelocityKinematicsCache<T>* vc) const = 0;
 
+  // Batched version of CalcVelocityKinematicsCache_BaseToTip(); see
+  // CalcPositionKinematicsCacheBatch_BaseToTip() for the requirements on
+  // `nodes`.
+  virtual void CalcVelocityKinematicsCacheBatch_BaseToTip(
+      std::span<const BodyNode<T>* const> nodes, const T* positions,
+      const PositionKinematicsCache<T>& pc,
+      const std::vector<Vector6<T>>& H_PB_W_cache, const T* velocities,
+      VelocityKinematicsCache<T>* vc) const = 0;
+
   // The CalcMassMatrix() algorithm invokes this on each body k, serving
   // as the composite body R(k) in the outer loop of Jain's algorithm 9.3.
   // This node must fill in its nv x nv diagonal block in M, and then
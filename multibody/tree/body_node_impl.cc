@@ -1,5 +1,7 @@
 #include "drake/multibody/tree/body_node_impl.h"
 
+#include <typeinfo>
+
 #include "drake/multibody/tree/curvilinear_mobilizer.h"
 #include "drake/multibody/tree/planar_mobilizer.h"
 #include "drake/multibody/tree/prismatic_mobilizer.h"
@@ -123,6 +125,23 @@ void BodyNodeImpl<T, ConcreteMobilizer>::CalcPositionKinematicsCache_BaseToTip(
   p_PoBo_W = R_WP * p_PoBo_P;
 }
 
+// The batched kernels call the per-node kernel through a pointer to this final
+// class, so each call is statically bound (and inlinable) rather than
+// dispatched virtually once per node.
+template <typename T, class ConcreteMobilizer>
+void BodyNodeImpl<T, ConcreteMobilizer>::
+    CalcPositionKinematicsCacheBatch_BaseToTip(
+        std::span<const BodyNode<T>* const> nodes,
+        const FrameBodyPoseCache<T>& frame_body_pose_cache, const T* positions,
+        PositionKinematicsCache<T>* pc) const {
+  for (const BodyNode<T>* node : nodes) {
+    DRAKE_ASSERT(typeid(*node) == typeid(*this));
+    static_cast<const BodyNodeImpl*>(node)
+        ->CalcPositionKinematicsCache_BaseToTip(frame_body_pose_cache,
+                                                positions, pc);
+  }
+}
+
 // TODO(sherm1) Consider combining this with VelocityCache computation
 //  so that we don't have to make a separate pass. Or better, get rid of this
 //  computation altogether by working in better frames.
@@ -300,6 +319,21 @@ void BodyNodeImpl<T, ConcreteMobilizer>::CalcVelocityKinematicsCache_BaseToTip(
   vc->SetV_WL(mobilizer_->mobod().active_link_ordinal(), V_WB);
 }
 
+template <typename T, class ConcreteMobilizer>
+void BodyNodeImpl<T, ConcreteMobilizer>::
+    CalcVelocityKinematicsCacheBatch_BaseToTip(
+        std::span<const BodyNode<T>* const> nodes, const T* positions,
+        const PositionKinematicsCache<T>& pc,
+        const std::vector<Vector6<T>>& H_PB_W_cache, const T* velocities,
+        VelocityKinematicsCache<T>* vc) const {
+  for (const BodyNode<T>* node : nodes) {
+    DRAKE_ASSERT(typeid(*node) == typeid(*this));
+    static_cast<const BodyNodeImpl*>(node)
+        ->CalcVelocityKinematicsCache_BaseToTip(positions, pc, H_PB_W_cache,
+                                                velocities, vc);
+  }
+}
+
 // As a guideline for developers, a summary of the computations performed in
 // this method is provided:
 // Notation:
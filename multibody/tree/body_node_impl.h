@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
@@ -73,6 +74,11 @@ class BodyNodeImpl final : public BodyNode<T> {
       const FrameBodyPoseCache<T>& frame_body_pose_cache, const T* positions,
       PositionKinematicsCache<T>* pc) const final;
 
+  void CalcPositionKinematicsCacheBatch_BaseToTip(
+      std::span<const BodyNode<T>* const> nodes,
+      const FrameBodyPoseCache<T>& frame_body_pose_cache, const T* positions,
+      PositionKinematicsCache<T>* pc) const final;
+
   void CalcAcrossNodeJacobianWrtVExpressedInWorld(
       const FrameBodyPoseCache<T>& frame_body_pose_cache, const T* positions,
       const PositionKinematicsCache<T>& pc,
@@ -83,6 +89,12 @@ class BodyNodeImpl final : public BodyNode<T> {
       const std::vector<Vector6<T>>& H_PB_W_cache, const T* velocities,
       VelocityKinematicsCache<T>* vc) const final;
 
+  void CalcVelocityKinematicsCacheBatch_BaseToTip(
+      std::span<const BodyNode<T>* const> nodes, const T* positions,
+      const PositionKinematicsCache<T>& pc,
+      const std::vector<Vector6<T>>& H_PB_W_cache, const T* velocities,
+      VelocityKinematicsCache<T>* vc) const final;
+
   void CalcMassMatrixContributionViaWorld_TipToBase(
       const PositionKinematicsCache<T>& pc,
       const std::vector<SpatialInertia<T>>& K_BBo_W_cache,  // composites
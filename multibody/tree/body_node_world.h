@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
@@ -31,6 +32,12 @@ class BodyNodeWorld final : public BodyNode<T> {
     DRAKE_UNREACHABLE();
   }
 
+  void CalcPositionKinematicsCacheBatch_BaseToTip(
+      std::span<const BodyNode<T>* const>, const FrameBodyPoseCache<T>&,
+      const T*, PositionKinematicsCache<T>*) const final {
+    DRAKE_UNREACHABLE();
+  }
+
   void CalcAcrossNodeJacobianWrtVExpressedInWorld(
       const FrameBodyPoseCache<T>&, const T*, const PositionKinematicsCache<T>&,
       std::vector<Vector6<T>>*) const final {
@@ -44,6 +51,13 @@ class BodyNodeWorld final : public BodyNode<T> {
     DRAKE_UNREACHABLE();
   }
 
+  void CalcVelocityKinematicsCacheBatch_BaseToTip(
+      std::span<const BodyNode<T>* const>, const T*,
+      const PositionKinematicsCache<T>&, const std::vector<Vector6<T>>&,
+      const T*, VelocityKinematicsCache<T>*) const final {
+    DRAKE_UNREACHABLE();
+  }
+
   void CalcMassMatrixContributionViaWorld_TipToBase(
       const PositionKinematicsCache<T>&, const std::vector<SpatialInertia<T>>&,
       const std::vector<Vector6<T>>&, EigenPtr<MatrixX<T>>) const final {
@@ -0,0 +1,153 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+MassMatrixFactorization<T>::MassMatrixFactorization() : L_start_{0} {}
+
+template <typename T>
+MassMatrixFactorization<T>::MassMatrixFactorization(
+    std::vector<int> parent_indices, const Eigen::Ref<const MatrixX<T>>& M)
+    : parent_indices_(std::move(parent_indices)) {
+  const int n = size();
+  DRAKE_THROW_UNLESS(M.rows() == n && M.cols() == n);
+
+  // Lay out the rows of L. The number of ancestors of i is one more than the
+  // number of ancestors of its parent.
+  std::vector<int> num_ancestors(n, 0);
+  L_start_.resize(n + 1);
+  L_start_[0] = 0;
+  for (int i = 0; i < n; ++i) {
+    const int parent = parent_indices_[i];
+    DRAKE_THROW_UNLESS(-1 <= parent && parent < i);
+    if (parent >= 0) num_ancestors[i] = num_ancestors[parent] + 1;
+    L_start_[i + 1] = L_start_[i] + num_ancestors[i];
+  }
+
+  // Gather the nonzeros of the lower triangle of M.
+  D_ = M.diagonal();
+  L_.resize(L_start_[n]);
+  for (int i = 0; i < n; ++i) {
+    T* Li = L_.data() + L_start_[i];
+    for (int j = parent_indices_[i]; j >= 0; j = parent_indices_[j]) {
+      *Li++ = M(i, j);
+    }
+  }
+
+  // Factor in place, from the tips to the bases; this is Featherstone's
+  // LTDL algorithm (Table 6.3 in [Featherstone 2008]), with each row stored
+  // along its ancestor chain. Row k is used to eliminate M(k, i) for each
+  // ancestor i of k. Doing so updates M(i, i) and M(i, j) for each ancestor j
+  // of i. Those M(i, j) are the entries of row i, which are stored in the same
+  // order as the tail of row k.
+  for (int k = n - 1; k >= 0; --k) {
+    T* Lk = L_.data() + L_start_[k];
+    const int length_k = L_start_[k + 1] - L_start_[k];
+    int i = parent_indices_[k];
+    for (int m = 0; m < length_k; ++m, i = parent_indices_[i]) {
+      DRAKE_ASSERT(i >= 0);
+      const T a = Lk[m] / D_(k);
+      D_(i) -= a * Lk[m];
+      T* Li = L_.data() + L_start_[i];
+      DRAKE_ASSERT(L_start_[i + 1] - L_start_[i] == length_k - m - 1);
+      for (int p = 0; p < length_k - m - 1; ++p) {
+        Li[p] -= a * Lk[m + 1 + p];
+      }
+      Lk[m] = a;
+    }
+  }
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::SolveVectorInPlace(T* x) const {
+  const int n = size();
+  // M⁻¹ = L⁻¹⋅D⁻¹⋅L⁻ᵀ. Solve with Lᵀ, from the tips to the bases.
+  for (int i = n - 1; i >= 0; --i) {
+    const T* Li = L_.data() + L_start_[i];
+    for (int j = parent_indices_[i]; j >= 0; j = parent_indices_[j]) {
+      x[j] -= *Li++ * x[i];
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    x[i] /= D_(i);
+  }
+  // Solve with L, from the bases to the tips.
+  for (int i = 0; i < n; ++i) {
+    const T* Li = L_.data() + L_start_[i];
+    for (int j = parent_indices_[i]; j >= 0; j = parent_indices_[j]) {
+      x[i] -= *Li++ * x[j];
+    }
+  }
+}
+
+template <typename T>
+VectorX<T> MassMatrixFactorization<T>::Solve(
+    const Eigen::Ref<const VectorX<T>>& b) const {
+  DRAKE_THROW_UNLESS(b.size() == size());
+  VectorX<T> x = b;
+  SolveVectorInPlace(x.data());
+  return x;
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::SolveInPlace(EigenPtr<MatrixX<T>> B) const {
+  DRAKE_THROW_UNLESS(B != nullptr);
+  DRAKE_THROW_UNLESS(B->rows() == size());
+  VectorX<T> x(size());
+  for (int c = 0; c < B->cols(); ++c) {
+    x = B->col(c);
+    SolveVectorInPlace(x.data());
+    B->col(c) = x;
+  }
+}
+
+template <typename T>
+VectorX<T> MassMatrixFactorization<T>::Multiply(
+    const Eigen::Ref<const VectorX<T>>& x) const {
+  const int n = size();
+  DRAKE_THROW_UNLESS(x.size() == n);
+  VectorX<T> y = x;
+  // M = Lᵀ⋅D⋅L. Multiply by L from the tips to the bases, so that the entries
+  // of ancestors are still unmodified when read.
+  for (int i = n - 1; i >= 0; --i) {
+    const T* Li = L_.data() + L_start_[i];
+    for (int j = parent_indices_[i]; j >= 0; j = parent_indices_[j]) {
+      y(i) += *Li++ * y(j);
+    }
+  }
+  y.array() *= D_.array();
+  // Multiply by Lᵀ from the bases to the tips. Entry i only receives
+  // contributions from its descendants, so it still holds D⋅L⋅x when read.
+  for (int i = 0; i < n; ++i) {
+    const T* Li = L_.data() + L_start_[i];
+    for (int j = parent_indices_[i]; j >= 0; j = parent_indices_[j]) {
+      y(j) += *Li++ * y(i);
+    }
+  }
+  return y;
+}
+
+template <typename T>
+MatrixX<T> MassMatrixFactorization<T>::CalcDenseL() const {
+  const int n = size();
+  MatrixX<T> L = MatrixX<T>::Identity(n, n);
+  for (int i = 0; i < n; ++i) {
+    const T* Li = L_.data() + L_start_[i];
+    for (int j = parent_indices_[i]; j >= 0; j = parent_indices_[j]) {
+      L(i, j) = *Li++;
+    }
+  }
+  return L;
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::MassMatrixFactorization);
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+
+/// A sparse `Lᵀ⋅D⋅L` factorization of the mass matrix `M ∈ ℝⁿˣⁿ` of a
+/// multibody system with tree topology, where L is unit lower triangular and D
+/// is diagonal. See MultibodyPlant::CalcMassMatrixFactorization().
+///
+/// The generalized velocities of a tree-structured system can be ordered so
+/// that every velocity index i has a "parent" index λ(i) < i (or none, for the
+/// first velocity of a tree base). Entry `M(i, j)` can only be nonzero when one
+/// of i, j is an ancestor of the other under λ. Factoring in the order
+/// `Lᵀ⋅D⋅L` (rather than `L⋅D⋅Lᵀ`) introduces no fill-in: L has exactly the
+/// sparsity of the lower triangle of M. This is the branch-induced sparsity
+/// exploited by [Featherstone 2005] and described in Section 6.5 of
+/// [Featherstone 2008].
+///
+/// Storage is `O(n⋅d)`, with d the depth of the deepest velocity in the
+/// forest. Factorization costs `O(n⋅d²)` and each solve or multiply costs
+/// `O(n⋅d)`, compared with `O(n²)` storage and `O(n³)` factorization for a
+/// dense Cholesky decomposition. None of the operations forms a dense matrix.
+///
+/// - [Featherstone 2005] Featherstone, R., 2005. Efficient factorization of the
+///   joint-space inertia matrix for branched kinematic trees. The International
+///   Journal of Robotics Research, 24(6), pp.487-500.
+/// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+///   algorithms. Springer.
+///
+/// @tparam_default_scalar
+template <typename T>
+class MassMatrixFactorization {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MassMatrixFactorization);
+
+  /// Constructs the factorization of a zero-sized matrix.
+  MassMatrixFactorization();
+
+  /// Factors the symmetric positive definite matrix M, whose sparsity is
+  /// described by `parent_indices`.
+  /// @param parent_indices
+  ///   Of size n. `parent_indices[i]` is λ(i), the parent index of index i, or
+  ///   -1 when i has no parent.
+  /// @param M
+  ///   The n x n matrix to factor. Only the diagonal and the entries
+  ///   `M(i, j)`, with j an ancestor of i, are read.
+  /// @throws std::exception if M is not square with size n, or if
+  ///   `parent_indices[i]` is not in the range [-1, i) for some i.
+  /// @pre M is symmetric positive definite and is zero at the entries not read.
+  MassMatrixFactorization(std::vector<int> parent_indices,
+                          const Eigen::Ref<const MatrixX<T>>& M);
+
+  /// Returns n, the size of the factored matrix.
+  int size() const { return ssize(parent_indices_); }
+
+  /// Returns the parent indices provided at construction.
+  const std::vector<int>& parent_indices() const { return parent_indices_; }
+
+  /// Returns the diagonal of D.
+  const VectorX<T>& D() const { return D_; }
+
+  /// Returns `M⁻¹⋅b`.
+  /// @throws std::exception if b.size() != size().
+  VectorX<T> Solve(const Eigen::Ref<const VectorX<T>>& b) const;
+
+  /// Overwrites each column bᵢ of B with `M⁻¹⋅bᵢ`.
+  /// @throws std::exception if B is nullptr or B->rows() != size().
+  void SolveInPlace(EigenPtr<MatrixX<T>> B) const;
+
+  /// Returns `M⋅x`, computed from the factors.
+  /// @throws std::exception if x.size() != size().
+  VectorX<T> Multiply(const Eigen::Ref<const VectorX<T>>& x) const;
+
+  /// Returns the dense unit lower triangular factor L. This is intended for
+  /// testing and debugging only.
+  MatrixX<T> CalcDenseL() const;
+
+ private:
+  // Operations on a single vector, in place.
+  void SolveVectorInPlace(T* x) const;
+
+  std::vector<int> parent_indices_;
+  // Row i of L occupies L_[L_start_[i]] up to (excluding) L_[L_start_[i + 1]],
+  // one entry per ancestor of i, in the order L(i, λ(i)), L(i, λ(λ(i))), etc.
+  // Thus the column indices of an ancestor's row are a suffix of those of row
+  // i.
+  std::vector<int> L_start_;
+  std::vector<T> L_;
+  VectorX<T> D_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::MassMatrixFactorization);
@@ -362,6 +362,12 @@ class Mobilizer : public MultibodyElement<T> {
   // Returns `true` if `this` uses a quaternion parameterization of rotations.
   virtual bool has_quaternion_dofs() const { return false; }
 
+  // Returns `true` if the hinge matrix H_FM_F(q), which maps the generalized
+  // velocities v to the spatial velocity V_FM_F = H_FM_F⋅v, does not depend on
+  // q (and therefore Hdot_FM_F = 0). MultibodyTree's analytical dynamics
+  // derivatives are limited to mobilizers for which this is true.
+  virtual bool has_constant_hinge_matrix() const { return false; }
+
   // @name         Methods that define the Mobilizer abstraction
   // For inner-loop computations, don't use this API. Use the templatized
   // APIs of the concrete mobilizers.
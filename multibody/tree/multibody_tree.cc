@@ -6,14 +6,18 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <typeinfo>
 #include <unordered_set>
 #include <utility>
 
+#include <common_robotics_utilities/parallelism.hpp>
 #include <fmt/ranges.h>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/unused.h"
+#include "drake/math/cross_product.h"
+#include "drake/math/linear_solve.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/body_node_world.h"
@@ -34,6 +38,9 @@ namespace drake {
 namespace multibody {
 namespace internal {
 
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
+using common_robotics_utilities::parallelism::ParallelForBackend;
 using internal::BodyNode;
 using internal::BodyNodeWorld;
 using math::RigidTransform;
@@ -881,6 +888,29 @@ void MultibodyTree<T>::FinalizeInternals() {
     CreateBodyNode(mobod_index);
   }
 
+  // Partition each level into runs of BodyNodes sharing a concrete type (i.e.,
+  // the same mobilizer type), in order of first appearance within the level.
+  // Base-to-tip passes dispatch virtually once per run instead of once per
+  // node. Every parent lies in a lower level, so this order is a valid
+  // base-to-tip traversal.
+  body_node_batches_.clear();
+  for (int level = 1; level < ssize(body_node_levels_); ++level) {
+    const int first_batch = ssize(body_node_batches_);
+    for (MobodIndex mobod_index : body_node_levels_[level]) {
+      const BodyNode<T>* node = body_nodes_[mobod_index].get();
+      auto batch = std::find_if(
+          body_node_batches_.begin() + first_batch, body_node_batches_.end(),
+          [node](const std::vector<const BodyNode<T>*>& candidate) {
+            return typeid(*candidate.front()) == typeid(*node);
+          });
+      if (batch == body_node_batches_.end()) {
+        body_node_batches_.push_back({node});
+      } else {
+        batch->push_back(node);
+      }
+    }
+  }
+
   FinalizeModelInstances();
 
   // For each floating base body, transfer its default pose to its newly-added
@@ -1375,14 +1405,12 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
   // information for each body, we are now in position to perform a base-to-tip
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
-  // Performs a base-to-tip recursion computing body poses.
-  // Skip the World which is mobod_index(0).
-  for (MobodIndex mobod_index(1); mobod_index < num_mobods(); ++mobod_index) {
-    const BodyNode<T>& node = *body_nodes_[mobod_index];
-    DRAKE_ASSERT(node.mobod_index() == mobod_index);
-
+  // Performs a base-to-tip recursion computing body poses, one run of
+  // same-type nodes at a time. The World is not in any run.
+  for (const std::vector<const BodyNode<T>*>& batch : body_node_batches_) {
     // Update per-node kinematics.
-    node.CalcPositionKinematicsCache_BaseToTip(frame_body_pose_cache, q, pc);
+    batch.front()->CalcPositionKinematicsCacheBatch_BaseToTip(
+        batch, frame_body_pose_cache, q, pc);
   }
 }
 
@@ -1477,15 +1505,12 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
   const T* positions = get_positions(context).data();
   const T* velocities = get_velocities(context).data();
 
-  // Performs a base-to-tip recursion computing body velocities.
-  // Skip the World which is mobod_index(0).
-  for (MobodIndex mobod_index(1); mobod_index < num_mobods(); ++mobod_index) {
-    const BodyNode<T>& node = *body_nodes_[mobod_index];
-    DRAKE_ASSERT(node.mobod_index() == mobod_index);
-
+  // Performs a base-to-tip recursion computing body velocities, one run of
+  // same-type nodes at a time. The World is not in any run.
+  for (const std::vector<const BodyNode<T>*>& batch : body_node_batches_) {
     // Update per-mobod kinematics.
-    node.CalcVelocityKinematicsCache_BaseToTip(positions, pc, H_PB_W_cache,
-                                               velocities, vc);
+    batch.front()->CalcVelocityKinematicsCacheBatch_BaseToTip(
+        batch, positions, pc, H_PB_W_cache, velocities, vc);
   }
 }
 
@@ -2097,6 +2122,34 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
   M->diagonal() += reflected_inertia;
 }
 
+template <typename T>
+MassMatrixFactorization<T> MultibodyTree<T>::CalcMassMatrixFactorization(
+    const systems::Context<T>& context) const {
+  // The O(n²) dense M is cheap next to the O(n³) dense factorization this
+  // replaces; the factorization only reads its structurally nonzero entries.
+  MatrixX<T> M(num_velocities(), num_velocities());
+  CalcMassMatrix(context, &M);
+  return MassMatrixFactorization<T>(CalcVelocityParentIndices(), M);
+}
+
+template <typename T>
+std::vector<int> MultibodyTree<T>::CalcVelocityParentIndices() const {
+  std::vector<int> parent_indices(num_velocities(), -1);
+  for (const SpanningForest::Mobod& mobod : forest().mobods()) {
+    if (mobod.nv() == 0) continue;
+    const SpanningForest::Mobod* inboard = &mobod;
+    do {
+      inboard = &forest().mobods(inboard->inboard_mobod());
+    } while (!inboard->is_world() && inboard->nv() == 0);
+    parent_indices[mobod.v_start()] =
+        inboard->is_world() ? -1 : inboard->v_start() + inboard->nv() - 1;
+    for (int v = mobod.v_start() + 1; v < mobod.v_start() + mobod.nv(); ++v) {
+      parent_indices[v] = v - 1;
+    }
+  }
+  return parent_indices;
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcBiasTerm(const systems::Context<T>& context,
                                     EigenPtr<VectorX<T>> Cv) const {
@@ -2123,6 +2176,377 @@ VectorX<T> MultibodyTree<T>::CalcGravityGeneralizedForces(
   return VectorX<T>::Zero(num_velocities());
 }
 
+namespace {
+
+// The helpers below operate on spatial vectors about the world origin Wo,
+// expressed in W, with the rotational component first.
+
+// Returns the matrix of the motion cross product, i.e. V×S = crm(V)⋅S.
+template <typename T>
+Matrix6<T> MotionCrossMatrix(const Vector6<T>& V) {
+  using math::VectorToSkewSymmetric;
+  Matrix6<T> X = Matrix6<T>::Zero();
+  X.template topLeftCorner<3, 3>() =
+      VectorToSkewSymmetric(V.template head<3>());
+  X.template bottomLeftCorner<3, 3>() =
+      VectorToSkewSymmetric(V.template tail<3>());
+  X.template bottomRightCorner<3, 3>() = X.template topLeftCorner<3, 3>();
+  return X;
+}
+
+// Returns the matrix of the force cross product, i.e. V×*F = crf(V)⋅F, where
+// crf(V) = -crm(V)ᵀ.
+template <typename T>
+Matrix6<T> ForceCrossMatrix(const Vector6<T>& V) {
+  return -MotionCrossMatrix(V).transpose();
+}
+
+// Returns the matrix which maps a motion S to S×*h, for the momentum h.
+template <typename T>
+Matrix6<T> MomentumCrossMatrix(const Vector6<T>& h) {
+  using math::VectorToSkewSymmetric;
+  Matrix6<T> X = Matrix6<T>::Zero();
+  X.template topLeftCorner<3, 3>() =
+      -VectorToSkewSymmetric(h.template head<3>());
+  X.template topRightCorner<3, 3>() =
+      -VectorToSkewSymmetric(h.template tail<3>());
+  X.template bottomLeftCorner<3, 3>() = X.template topRightCorner<3, 3>();
+  return X;
+}
+
+// Returns the spatial motion (w, v) of a body, with v the translational
+// motion of the point P at p_WoP_W, shifted to Wo.
+template <typename T>
+Vector6<T> ShiftMotionToWorldOrigin(const Vector3<T>& p_WoP_W,
+                                    const Vector3<T>& w, const Vector3<T>& v) {
+  Vector6<T> V;
+  V << w, v + p_WoP_W.cross(w);
+  return V;
+}
+
+}  // namespace
+
+// This method differentiates the recursive Newton-Euler algorithm along the
+// lines of [Carpentier 2018], with all quantities about the world origin Wo
+// and expressed in W. In these coordinates the motion subspace S (the columns
+// of H_PB_W) of each mobilizer only changes by the motion of its inboard
+// bodies, since we require the hinge matrices H_FM_F to be constant. For each
+// body B and a perturbation of velocity (or position) k of a mobilizer on B's
+// inboard path, we propagate the derivatives of the spatial velocity V and
+// acceleration A of B. The derivative of the force on B then is
+//   δF_B = I_B⋅δA_B + (crf(V_B)⋅I_B - I_B⋅crm(V_B) + Hmat(I_B⋅V_B))⋅δV_B
+// plus, for position perturbations, the rotation of the world-fixed gravity
+// and applied forces relative to the moving body. Accumulating these
+// per-body matrices into composites lets us evaluate all of the derivatives
+// in O(n⋅d) operations, with d the depth of the tree.
+//
+// - [Carpentier 2018] Carpentier, J. and Mansard, N., 2018. Analytical
+//   derivatives of rigid body dynamics algorithms. Robotics: Science and
+//   Systems.
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsTangentDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    const std::vector<SpatialForce<T>>& Fapplied_Bo_W_array,
+    EigenPtr<MatrixX<T>> dtau_dw, EigenPtr<MatrixX<T>> dtau_dv) const {
+  using math::VectorToSkewSymmetric;
+  const int nv = num_velocities();
+  DRAKE_DEMAND(known_vdot.size() == nv);
+  DRAKE_DEMAND(ssize(Fapplied_Bo_W_array) == num_mobods());
+  DRAKE_DEMAND(dtau_dw != nullptr && dtau_dw->rows() == nv &&
+               dtau_dw->cols() == nv);
+  DRAKE_DEMAND(dtau_dv != nullptr && dtau_dv->rows() == nv &&
+               dtau_dv->cols() == nv);
+
+  for (MobodIndex mobod_index(1); mobod_index < num_mobods(); ++mobod_index) {
+    const Mobilizer<T>& mobilizer = body_nodes_[mobod_index]->get_mobilizer();
+    if (!mobilizer.has_constant_hinge_matrix()) {
+      throw std::logic_error(fmt::format(
+          "Analytical dynamics derivatives are not supported for the "
+          "mobilizer of body '{}', whose hinge matrix depends on its "
+          "generalized positions (as for universal and curvilinear joints). "
+          "Use automatic differentiation instead.",
+          mobilizer.outboard_body().name()));
+    }
+  }
+
+  const FrameBodyPoseCache<T>& frame_body_pose_cache =
+      EvalFrameBodyPoses(context);
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
+  const std::vector<SpatialInertia<T>>& M_B_W_cache =
+      EvalSpatialInertiaInWorldCache(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+  std::vector<SpatialAcceleration<T>> A_WB_array(num_mobods());
+  CalcSpatialAccelerationsFromVdot(context, known_vdot,
+                                   false /* ignore_velocities */, &A_WB_array);
+
+  // Per body quantities, about Wo and expressed in W, indexed by MobodIndex.
+  // The forces F, inertias I, velocity derivative coefficients B and gravity
+  // coefficients Psi are accumulated into composites after this loop.
+  std::vector<Vector6<T>> V(num_mobods(), Vector6<T>::Zero());
+  std::vector<Vector6<T>> A(num_mobods(), Vector6<T>::Zero());
+  std::vector<Vector6<T>> F(num_mobods(), Vector6<T>::Zero());
+  std::vector<Matrix6<T>> I(num_mobods(), Matrix6<T>::Zero());
+  std::vector<Matrix6<T>> B(num_mobods(), Matrix6<T>::Zero());
+  std::vector<Eigen::Matrix<T, 6, 3>> Psi(num_mobods(),
+                                          Eigen::Matrix<T, 6, 3>::Zero());
+  // Position of each mobilizer's outboard frame origin Mo.
+  std::vector<Vector3<T>> p_WoMo_W(num_mobods(), Vector3<T>::Zero());
+  // The motion subspace, i.e. the columns of H_PB_W shifted to Wo.
+  Matrix6X<T> S(6, nv);
+
+  Vector3<T> g_W = Vector3<T>::Zero();
+  if (gravity_field_ != nullptr) {
+    g_W = gravity_field_->gravity_vector().template cast<T>();
+  }
+  for (MobodIndex mobod_index(1); mobod_index < num_mobods(); ++mobod_index) {
+    const BodyNode<T>& node = *body_nodes_[mobod_index];
+    const RigidTransform<T>& X_WB = pc.get_X_WB(mobod_index);
+    const Vector3<T>& p_WoBo_W = X_WB.translation();
+    const SpatialVelocity<T>& V_WB = vc.get_V_WB(mobod_index);
+    const SpatialAcceleration<T>& A_WB = A_WB_array[mobod_index];
+
+    V[mobod_index] = ShiftMotionToWorldOrigin(
+        p_WoBo_W, V_WB.rotational(), V_WB.translational());
+    // The spatial acceleration about Wo includes the change of the point of
+    // Bo that coincides with Wo.
+    A[mobod_index] << A_WB.rotational(),
+        A_WB.translational() + V_WB.translational().cross(V_WB.rotational()) +
+            p_WoBo_W.cross(A_WB.rotational());
+
+    I[mobod_index] =
+        M_B_W_cache[mobod_index].Shift(-p_WoBo_W).CopyToFullMatrix6();
+    const Matrix6<T>& I_B = I[mobod_index];
+    const Vector6<T> h_B = I_B * V[mobod_index];
+    const bool gravity_is_enabled =
+        gravity_field_ != nullptr &&
+        gravity_field_->is_enabled(node.body().model_instance());
+    Vector6<T> G_W = Vector6<T>::Zero();
+    if (gravity_is_enabled) G_W.template tail<3>() = g_W;
+    const SpatialForce<T>& Fapp_Bo_W = Fapplied_Bo_W_array[mobod_index];
+    const Vector3<T>& f_app = Fapp_Bo_W.translational();
+    Vector6<T> Fapp_Wo_W;
+    Fapp_Wo_W << Fapp_Bo_W.rotational() + p_WoBo_W.cross(f_app), f_app;
+
+    F[mobod_index] = I_B * (A[mobod_index] - G_W) +
+                     ForceCrossMatrix(V[mobod_index]) * h_B - Fapp_Wo_W;
+    B[mobod_index] = ForceCrossMatrix(V[mobod_index]) * I_B -
+                     I_B * MotionCrossMatrix(V[mobod_index]) +
+                     MomentumCrossMatrix(h_B);
+    // Under a rotation δθ of the body, the gravity force changes as if gravity
+    // rotated by -δθ relative to the body, while the world-fixed applied force
+    // moves with its point of application Bo.
+    Eigen::Matrix<T, 6, 3> E = Eigen::Matrix<T, 6, 3>::Zero();
+    if (gravity_is_enabled) {
+      E.template bottomRows<3>() = -VectorToSkewSymmetric(g_W);
+    }
+    Eigen::Matrix<T, 6, 3> Phi;
+    Phi.template topRows<3>() =
+        VectorToSkewSymmetric(Fapp_Bo_W.rotational()) +
+        VectorToSkewSymmetric(p_WoBo_W) * VectorToSkewSymmetric(f_app);
+    Phi.template bottomRows<3>() = VectorToSkewSymmetric(f_app);
+    Psi[mobod_index] = I_B * E - Phi;
+
+    p_WoMo_W[mobod_index] =
+        X_WB * node.outboard_frame().get_X_BF(frame_body_pose_cache)
+                   .translation();
+    const int v_start = node.velocity_start_in_v();
+    for (int i = 0; i < node.get_num_mobilizer_velocities(); ++i) {
+      const Vector6<T>& Hi_PB_W = H_PB_W_cache[v_start + i];
+      S.col(v_start + i) = ShiftMotionToWorldOrigin(
+          p_WoBo_W, Vector3<T>(Hi_PB_W.template head<3>()),
+          Vector3<T>(Hi_PB_W.template tail<3>()));
+    }
+  }
+
+  // Tip-to-base accumulation of the composites.
+  for (MobodIndex mobod_index(num_mobods() - 1); mobod_index > 0;
+       --mobod_index) {
+    const MobodIndex parent = body_nodes_[mobod_index]->inboard_mobod_index();
+    F[parent] += F[mobod_index];
+    I[parent] += I[mobod_index];
+    B[parent] += B[mobod_index];
+    Psi[parent] += Psi[mobod_index];
+  }
+
+  // Derivatives of the spatial accelerations (w) and velocities (z) of the
+  // bodies outboard of each mobilizer, for each of its velocities. The
+  // subscripts q and v denote the perturbations of positions and velocities.
+  Matrix6X<T> Wq(6, nv);
+  Matrix6X<T> Zq(6, nv);
+  Matrix6X<T> Wv(6, nv);
+  const Eigen::VectorBlock<const VectorX<T>> v = get_velocities(context);
+  dtau_dw->setZero();
+  dtau_dv->setZero();
+  for (MobodIndex mobod_index(1); mobod_index < num_mobods(); ++mobod_index) {
+    const BodyNode<T>& node = *body_nodes_[mobod_index];
+    const int c_nv = node.get_num_mobilizer_velocities();
+    if (c_nv == 0) continue;
+    const int c_start = node.velocity_start_in_v();
+    const auto S_c = S.middleCols(c_start, c_nv);
+    const Vector3<T>& p_Mo = p_WoMo_W[mobod_index];
+    const Vector6<T>& V_P = V[node.inboard_mobod_index()];
+    const Vector6<T>& V_B = V[mobod_index];
+    // Relative spatial velocity and acceleration across the mobilizer, and the
+    // translational velocity of Mo.
+    const Vector6<T> V_rel = S_c * v.segment(c_start, c_nv);
+    const Vector3<T> w_rel = V_rel.template head<3>();
+    const Vector3<T> u_rel = V_rel.template tail<3>() - p_Mo.cross(w_rel);
+    const Vector3<T> alpha_rel =
+        S_c.template topRows<3>() * known_vdot.segment(c_start, c_nv);
+    const Matrix6<T> crm_V_P = MotionCrossMatrix(V_P);
+    const Matrix6<T> crm_V_B = MotionCrossMatrix(V_B);
+
+    MatrixX<T> Yq(6, c_nv);
+    MatrixX<T> Yv(6, c_nv);
+    for (int k = 0; k < c_nv; ++k) {
+      const Vector6<T> S_k = S.col(c_start + k);
+      const Vector3<T> w_k = S_k.template head<3>();
+      const Vector3<T> u_k = S_k.template tail<3>() - p_Mo.cross(w_k);
+
+      // Velocity perturbation.
+      Vector6<T> dA_v = crm_V_P * S_k;
+      dA_v.template tail<3>() += u_k.cross(w_rel) + u_rel.cross(w_k);
+      Wv.col(c_start + k) = dA_v + crm_V_B * S_k;
+      Yv.col(k) = I[mobod_index] * Wv.col(c_start + k) + B[mobod_index] * S_k;
+
+      // Position perturbation. The subspace of this mobilizer and all
+      // outboard ones rotates with w_k about Mo.
+      Vector6<T> zeta = Vector6<T>::Zero();
+      zeta.template tail<3>() = u_k.cross(w_rel);
+      const Matrix6<T> crm_S_k = MotionCrossMatrix(S_k);
+      const Vector6<T> dV_q = zeta - crm_S_k * V_B;
+      Vector6<T> dA_q = crm_V_P * zeta - crm_S_k * A[mobod_index];
+      dA_q.template tail<3>() += u_k.cross(alpha_rel);
+      Wq.col(c_start + k) = dA_q + crm_V_B * dV_q;
+      Zq.col(c_start + k) = dV_q;
+      Yq.col(k) = ForceCrossMatrix(S_k) * F[mobod_index] +
+                  I[mobod_index] * Wq.col(c_start + k) +
+                  B[mobod_index] * dV_q + Psi[mobod_index] * w_k;
+    }
+
+    // The mobilizer itself and its inboard mobilizers.
+    for (MobodIndex d = mobod_index; d != world_mobod_index();
+         d = body_nodes_[d]->inboard_mobod_index()) {
+      const BodyNode<T>& d_node = *body_nodes_[d];
+      const int d_nv = d_node.get_num_mobilizer_velocities();
+      if (d_nv == 0) continue;
+      const int d_start = d_node.velocity_start_in_v();
+      const auto S_d = S.middleCols(d_start, d_nv);
+      dtau_dw->block(d_start, c_start, d_nv, c_nv) = S_d.transpose() * Yq;
+      dtau_dv->block(d_start, c_start, d_nv, c_nv) = S_d.transpose() * Yv;
+    }
+    // The mobilizer's own subspace also moves with its positions.
+    for (int m = 0; m < c_nv; ++m) {
+      const Vector3<T> w_m = S.col(c_start + m).template head<3>();
+      for (int k = 0; k < c_nv; ++k) {
+        const Vector6<T> S_k = S.col(c_start + k);
+        const Vector3<T> u_k =
+            S_k.template tail<3>() - p_Mo.cross(S_k.template head<3>());
+        (*dtau_dw)(c_start + m, c_start + k) +=
+            u_k.cross(w_m).dot(F[mobod_index].template tail<3>());
+      }
+    }
+  }
+
+  // Perturbations of a mobilizer on the inboard path of the outboard
+  // mobilizers d.
+  for (MobodIndex d(1); d < num_mobods(); ++d) {
+    const BodyNode<T>& d_node = *body_nodes_[d];
+    const int d_nv = d_node.get_num_mobilizer_velocities();
+    if (d_nv == 0) continue;
+    const int d_start = d_node.velocity_start_in_v();
+    const auto S_d = S.middleCols(d_start, d_nv);
+    const MatrixX<T> SI = S_d.transpose() * I[d];
+    const MatrixX<T> SB = S_d.transpose() * B[d];
+    const MatrixX<T> SPsi = S_d.transpose() * Psi[d];
+    for (MobodIndex c = d_node.inboard_mobod_index(); c != world_mobod_index();
+         c = body_nodes_[c]->inboard_mobod_index()) {
+      const BodyNode<T>& c_node = *body_nodes_[c];
+      const int c_nv = c_node.get_num_mobilizer_velocities();
+      if (c_nv == 0) continue;
+      const int c_start = c_node.velocity_start_in_v();
+      dtau_dw->block(d_start, c_start, d_nv, c_nv) =
+          SI * Wq.middleCols(c_start, c_nv) +
+          SB * Zq.middleCols(c_start, c_nv) +
+          SPsi * S.block(0, c_start, 3, c_nv);
+      dtau_dv->block(d_start, c_start, d_nv, c_nv) =
+          SI * Wv.middleCols(c_start, c_nv) + SB * S.middleCols(c_start, c_nv);
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    const MultibodyForces<T>& external_forces, EigenPtr<MatrixX<T>> dtau_dq,
+    EigenPtr<MatrixX<T>> dtau_dv, EigenPtr<MatrixX<T>> dtau_dvdot) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  const int nq = num_positions();
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(known_vdot.size() == nv);
+  DRAKE_THROW_UNLESS(external_forces.CheckHasRightSizeForModel(*this));
+  DRAKE_THROW_UNLESS(dtau_dq != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dq->rows() == nv && dtau_dq->cols() == nq);
+  DRAKE_THROW_UNLESS(dtau_dv != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dv->rows() == nv && dtau_dv->cols() == nv);
+  DRAKE_THROW_UNLESS(dtau_dvdot != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dvdot->rows() == nv && dtau_dvdot->cols() == nv);
+
+  MatrixX<T> dtau_dw(nv, nv);
+  CalcInverseDynamicsTangentDerivatives(
+      context, known_vdot, external_forces.body_forces(), &dtau_dw, dtau_dv);
+  *dtau_dq = dtau_dw * MakeQDotToVelocityMap(context);
+  CalcMassMatrix(context, dtau_dvdot);
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsDerivatives(
+    const systems::Context<T>& context,
+    const MultibodyForces<T>& applied_forces, EigenPtr<MatrixX<T>> dvdot_dq,
+    EigenPtr<MatrixX<T>> dvdot_dv, EigenPtr<MatrixX<T>> dvdot_dtau) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  const int nq = num_positions();
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(applied_forces.CheckHasRightSizeForModel(*this));
+  DRAKE_THROW_UNLESS(dvdot_dq != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dq->rows() == nv && dvdot_dq->cols() == nq);
+  DRAKE_THROW_UNLESS(dvdot_dv != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dv->rows() == nv && dvdot_dv->cols() == nv);
+  DRAKE_THROW_UNLESS(dvdot_dtau != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dtau->rows() == nv && dvdot_dtau->cols() == nv);
+
+  // The forward dynamics v̇ = M⁻¹⋅(tau_g + tau_app + ∑ J_WBᵀ Fapp_Bo_W - C⋅v)
+  // solves tau_id(q, v, v̇) = 0, see CalcInverseDynamicsTangentDerivatives().
+  // Therefore ∂v̇/∂x = -M⁻¹⋅∂tau_id/∂x, evaluated at the forward dynamics v̇.
+  MatrixX<T> M(nv, nv);
+  CalcMassMatrix(context, &M);
+  const math::LinearSolver<Eigen::LLT, MatrixX<T>> llt_M(M);
+  if (llt_M.eigen_linear_solver().info() != Eigen::Success) {
+    throw std::logic_error(
+        "CalcForwardDynamicsDerivatives(): the mass matrix is not positive "
+        "definite.");
+  }
+  VectorX<T> tau_id(nv);
+  std::vector<SpatialAcceleration<T>> A_WB_array(num_mobods());
+  std::vector<SpatialForce<T>> F_BMo_W_array(num_mobods());
+  CalcInverseDynamics(context, VectorX<T>::Zero(nv),
+                      applied_forces.body_forces(),
+                      applied_forces.generalized_forces(), &A_WB_array,
+                      &F_BMo_W_array, &tau_id);
+  const VectorX<T> vdot =
+      llt_M.Solve(CalcGravityGeneralizedForces(context) - tau_id);
+
+  MatrixX<T> dtau_dw(nv, nv);
+  MatrixX<T> dtau_dv(nv, nv);
+  CalcInverseDynamicsTangentDerivatives(
+      context, vdot, applied_forces.body_forces(), &dtau_dw, &dtau_dv);
+  *dvdot_dq = -llt_M.Solve(dtau_dw) * MakeQDotToVelocityMap(context);
+  *dvdot_dv = -llt_M.Solve(dtau_dv);
+  *dvdot_dtau = llt_M.Solve(MatrixX<T>::Identity(nv, nv));
+}
+
 template <typename T>
 RigidTransform<T> MultibodyTree<T>::CalcRelativeTransform(
     const systems::Context<T>& context, const Frame<T>& frame_F,
@@ -3055,6 +3479,63 @@ void MultibodyTree<T>::CalcJacobianSpatialVelocity(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcJacobianSpatialVelocityTreeBlocks(
+    const systems::Context<T>& context,
+    const std::vector<const Frame<T>*>& frames,
+    const Eigen::Ref<const Matrix3X<T>>& p_FP_list,
+    std::vector<JacobianTreeColumns<T>>* Jv_V_WP_W_blocks) const {
+  DRAKE_THROW_UNLESS(Jv_V_WP_W_blocks != nullptr);
+  DRAKE_THROW_UNLESS(p_FP_list.cols() == ssize(frames));
+
+  // All the frames share the one evaluation of the System Jacobian. It holds
+  // Jv_V_WB_W for the origin Bo of every mobilized body B, so each frame only
+  // needs to shift the nonzero columns of its body's rows to its point.
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<MatrixX<T>>& tree_jacobians =
+      EvalBlockSystemJacobianCache(context).block_system_jacobian();
+
+  Jv_V_WP_W_blocks->resize(frames.size());
+  for (int i = 0; i < ssize(frames); ++i) {
+    DRAKE_THROW_UNLESS(frames[i] != nullptr);
+    const Frame<T>& frame_F = *frames[i];
+    JacobianTreeColumns<T>& block = (*Jv_V_WP_W_blocks)[i];
+
+    const MobodIndex index_B = frame_F.body().mobod_index();
+    const SpanningForest::Mobod& mobod_B = forest().mobods(index_B);
+    if (mobod_B.is_world()) {
+      block.tree = TreeIndex{};
+      block.J.resize(6, 0);
+      continue;
+    }
+    const SpanningForest::Tree& tree = forest().trees(mobod_B.tree());
+    const MatrixX<T>& J_tree = tree_jacobians[tree.index()];
+    const int row_B = 6 * (index_B - tree.base_mobod());
+    const int base_v_start = tree.v_start();
+
+    const Vector3<T> p_WP = frame_F.CalcPoseInWorld(context) * p_FP_list.col(i);
+    const Vector3<T> p_BoP_W = p_WP - pc.get_X_WB(index_B).translation();
+
+    block.tree = tree.index();
+    block.J.resize(6, tree.nv());
+    block.J.setZero();
+    // Only the mobilities of B and its ancestors can move P, so we walk the
+    // path to World once and leave every other column zero.
+    for (const SpanningForest::Mobod* mobod = &mobod_B; !mobod->is_world();
+         mobod = &forest().mobods(mobod->inboard_mobod())) {
+      for (int k = 0; k < mobod->nv(); ++k) {
+        const int col = mobod->v_start() + k - base_v_start;
+        const auto Jk_V_WB = J_tree.template block<6, 1>(row_B, col);
+        const Vector3<T> w_WB = Jk_V_WB.template head<3>();
+        auto Jk_V_WP = block.J.col(col);
+        Jk_V_WP.template head<3>() = w_WB;
+        Jk_V_WP.template tail<3>() =
+            Jk_V_WB.template tail<3>() + w_WB.cross(p_BoP_W);
+      }
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcJacobianAngularVelocity(
     const systems::Context<T>& context,
@@ -3765,6 +4246,53 @@ bool MultibodyTree<T>::AreAllDefaultRotationalInertiaZero(
   return true;
 }
 
+template <typename T>
+template <typename CalcNode>
+void MultibodyTree<T>::SweepArticulatedBodyNodes(
+    bool tip_to_base, const CalcNode& calc_node) const {
+  const int num_threads = forward_dynamics_parallelism_.num_threads();
+  // Symbolic expressions are not parallelized.
+  if (scalar_predicate<T>::is_bool && num_threads > 1 &&
+      forest().num_trees() > 1) {
+    // The mobods of each tree are numbered consecutively in depth-first order,
+    // so within a tree, decreasing (increasing) indices visit children before
+    // (after) their parents. No data is shared between trees other than World,
+    // which is only read.
+    const auto sweep_tree = [&](const int, const int64_t tree_index) {
+      const SpanningForest::Tree& tree =
+          forest().trees(TreeIndex(static_cast<int>(tree_index)));
+      if (tip_to_base) {
+        for (MobodIndex i = tree.last_mobod(); i >= tree.base_mobod(); --i) {
+          calc_node(i);
+        }
+      } else {
+        for (MobodIndex i = tree.base_mobod(); i <= tree.last_mobod(); ++i) {
+          calc_node(i);
+        }
+      }
+    };
+    DynamicParallelForIndexLoop(DegreeOfParallelism(num_threads), 0,
+                                forest().num_trees(), sweep_tree,
+                                ParallelForBackend::BEST_AVAILABLE);
+    return;
+  }
+
+  // Sweep the whole forest level by level, skipping the world.
+  if (tip_to_base) {
+    for (int depth = forest_height() - 1; depth > 0; --depth) {
+      for (MobodIndex mobod_index : body_node_levels_[depth]) {
+        calc_node(mobod_index);
+      }
+    }
+  } else {
+    for (int level = 1; level < forest_height(); ++level) {
+      for (MobodIndex mobod_index : body_node_levels_[level]) {
+        calc_node(mobod_index);
+      }
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
     const systems::Context<T>& context,
@@ -3788,20 +4316,18 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
       EvalSpatialInertiaInWorldCache(context);
 
   // Perform tip-to-base recursion, skipping the world.
-  for (int depth = forest_height() - 1; depth > 0; --depth) {
-    for (MobodIndex mobod_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[mobod_index];
+  SweepArticulatedBodyNodes(true, [&](MobodIndex mobod_index) {
+    const BodyNode<T>& node = *body_nodes_[mobod_index];
 
-      // Get hinge matrix and spatial inertia for this node.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
-      const SpatialInertia<T>& M_B_W =
-          spatial_inertia_in_world_cache[mobod_index];
+    // Get hinge matrix and spatial inertia for this node.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    const SpatialInertia<T>& M_B_W =
+        spatial_inertia_in_world_cache[mobod_index];
 
-      node.CalcArticulatedBodyInertiaCache_TipToBase(context, pc, H_PB_W, M_B_W,
-                                                     diagonal_inertias, abic);
-    }
-  }
+    node.CalcArticulatedBodyInertiaCache_TipToBase(context, pc, H_PB_W, M_B_W,
+                                                   diagonal_inertias, abic);
+  });
 }
 
 template <typename T>
@@ -3831,27 +4357,25 @@ void MultibodyTree<T>::CalcArticulatedBodyForceCache(
       EvalDynamicBiasCache(context);
 
   // Perform tip-to-base recursion, skipping the world.
-  for (int depth = forest_height() - 1; depth > 0; --depth) {
-    for (MobodIndex mobod_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[mobod_index];
+  SweepArticulatedBodyNodes(true, [&](MobodIndex mobod_index) {
+    const BodyNode<T>& node = *body_nodes_[mobod_index];
 
-      // Get generalized force and body force for this node.
-      Eigen::Ref<const VectorX<T>> tau_applied =
-          node.get_mobilizer().get_generalized_forces_from_array(
-              generalized_forces);
-      const SpatialForce<T>& Fapplied_Bo_W = body_forces[mobod_index];
-
-      // Get references to the hinge matrix and force bias for this node.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
-      const SpatialForce<T>& Fb_B_W = dynamic_bias_cache[mobod_index];
-      const SpatialForce<T>& Zb_Bo_W = Zb_Bo_W_cache[mobod_index];
-
-      node.CalcArticulatedBodyForceCache_TipToBase(
-          context, pc, &vc, Fb_B_W, abic, Zb_Bo_W, Fapplied_Bo_W, tau_applied,
-          H_PB_W, aba_force_cache);
-    }
-  }
+    // Get generalized force and body force for this node.
+    Eigen::Ref<const VectorX<T>> tau_applied =
+        node.get_mobilizer().get_generalized_forces_from_array(
+            generalized_forces);
+    const SpatialForce<T>& Fapplied_Bo_W = body_forces[mobod_index];
+
+    // Get references to the hinge matrix and force bias for this node.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    const SpatialForce<T>& Fb_B_W = dynamic_bias_cache[mobod_index];
+    const SpatialForce<T>& Zb_Bo_W = Zb_Bo_W_cache[mobod_index];
+
+    node.CalcArticulatedBodyForceCache_TipToBase(
+        context, pc, &vc, Fb_B_W, abic, Zb_Bo_W, Fapplied_Bo_W, tau_applied,
+        H_PB_W, aba_force_cache);
+  });
 }
 
 template <typename T>
@@ -3885,20 +4409,18 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
       EvalSpatialAccelerationBiasCache(context);
 
   // Perform base-to-tip recursion, skipping the world.
-  for (int level = 1; level < forest_height(); ++level) {
-    for (MobodIndex mobod_index : body_node_levels_[level]) {
-      const BodyNode<T>& node = *body_nodes_[mobod_index];
+  SweepArticulatedBodyNodes(false, [&](MobodIndex mobod_index) {
+    const BodyNode<T>& node = *body_nodes_[mobod_index];
 
-      const SpatialAcceleration<T>& Ab_WB = Ab_WB_cache[mobod_index];
+    const SpatialAcceleration<T>& Ab_WB = Ab_WB_cache[mobod_index];
 
-      // Get reference to the hinge mapping matrix.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
+    // Get reference to the hinge mapping matrix.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
 
-      node.CalcArticulatedBodyAccelerations_BaseToTip(
-          context, pc, abic, aba_force_cache, H_PB_W, Ab_WB, ac);
-    }
-  }
+    node.CalcArticulatedBodyAccelerations_BaseToTip(
+        context, pc, abic, aba_force_cache, H_PB_W, Ab_WB, ac);
+  });
 }
 
 template <typename T>
@@ -4228,6 +4750,8 @@ std::unique_ptr<MultibodyTree<ToScalar>> MultibodyTree<T>::CloneToScalar()
   // required to be finalized.
   tree_clone->joint_to_mobilizer_ = this->joint_to_mobilizer_;
   tree_clone->discrete_state_index_ = this->discrete_state_index_;
+  tree_clone->forward_dynamics_parallelism_ =
+      this->forward_dynamics_parallelism_;
 
   // All other internals templated on T are created with the following call to
   // FinalizeInternals(), which also sets the "is_finalized" flag to true.
@@ -15,6 +15,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/common/random.h"
 #include "drake/math/rigid_transform.h"
@@ -23,6 +24,7 @@
 #include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
 #include "drake/multibody/tree/element_collection.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/position_kinematics_cache.h"
@@ -1235,6 +1237,13 @@ class MultibodyTree {
                                    const Frame<T>& frame_E,
                                    EigenPtr<MatrixX<T>> Js_V_ABp_E) const;
 
+  // See MultibodyPlant method.
+  void CalcJacobianSpatialVelocityTreeBlocks(
+      const systems::Context<T>& context,
+      const std::vector<const Frame<T>*>& frames,
+      const Eigen::Ref<const Matrix3X<T>>& p_FP_list,
+      std::vector<JacobianTreeColumns<T>>* Jv_V_WP_W_blocks) const;
+
   // See MultibodyPlant method.
   void CalcJacobianAngularVelocity(const systems::Context<T>& context,
                                    JacobianWrtVariable with_respect_to,
@@ -1626,6 +1635,17 @@ class MultibodyTree {
   void CalcMassMatrix(const systems::Context<T>& context,
                       EigenPtr<MatrixX<T>> M) const;
 
+  // See MultibodyPlant method.
+  MassMatrixFactorization<T> CalcMassMatrixFactorization(
+      const systems::Context<T>& context) const;
+
+  // Returns λ, the parent of each generalized velocity in the forest, as used
+  // by MassMatrixFactorization. The parent of the first velocity of a mobod is
+  // the last velocity of its nearest inboard mobod that has any velocities (-1
+  // if there is none); the parent of each subsequent velocity of a mobod is the
+  // previous velocity.
+  std::vector<int> CalcVelocityParentIndices() const;
+
   // See MultibodyPlant method.
   void CalcBiasTerm(const systems::Context<T>& context,
                     EigenPtr<VectorX<T>> Cv) const;
@@ -1634,6 +1654,19 @@ class MultibodyTree {
   VectorX<T> CalcGravityGeneralizedForces(
       const systems::Context<T>& context) const;
 
+  // See MultibodyPlant method.
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      const MultibodyForces<T>& external_forces, EigenPtr<MatrixX<T>> dtau_dq,
+      EigenPtr<MatrixX<T>> dtau_dv, EigenPtr<MatrixX<T>> dtau_dvdot) const;
+
+  // See MultibodyPlant method.
+  void CalcForwardDynamicsDerivatives(const systems::Context<T>& context,
+                                      const MultibodyForces<T>& applied_forces,
+                                      EigenPtr<MatrixX<T>> dvdot_dq,
+                                      EigenPtr<MatrixX<T>> dvdot_dv,
+                                      EigenPtr<MatrixX<T>> dvdot_dtau) const;
+
   // See MultibodyPlant method.
   bool IsVelocityEqualToQDot() const;
 
@@ -2247,6 +2280,12 @@ class MultibodyTree {
     return tree_system_->EvalArticulatedBodyInertiaCache(context);
   }
 
+  // Evaluate the cache entry storing the block System Jacobian in `context`.
+  const BlockSystemJacobianCache<T>& EvalBlockSystemJacobianCache(
+      const systems::Context<T>& context) const {
+    return tree_system_->EvalBlockSystemJacobianCache(context);
+  }
+
   // Evaluate the cache entry storing the across node Jacobian H_PB_W in
   // `context`.
   const std::vector<Vector6<T>>& EvalAcrossNodeJacobianWrtVExpressedInWorld(
@@ -2400,6 +2439,20 @@ class MultibodyTree {
       const systems::Context<T>& context, const PositionKinematicsCache<T>& pc,
       std::vector<Vector6<T>>* H_PB_W_cache) const;
 
+  // Sets the parallelism used by the articulated body algorithm passes
+  // (CalcArticulatedBodyInertiaCache(), CalcArticulatedBodyForceCache(), and
+  // CalcArticulatedBodyAccelerations()). When more than one thread is
+  // requested, the independent trees of the forest are swept concurrently
+  // rather than level by level. Only non-symbolic scalars are parallelized.
+  void set_forward_dynamics_parallelism(Parallelism parallelism) {
+    forward_dynamics_parallelism_ = parallelism;
+  }
+
+  // Returns the parallelism set by set_forward_dynamics_parallelism().
+  Parallelism forward_dynamics_parallelism() const {
+    return forward_dynamics_parallelism_;
+  }
+
   // (Internal use only) Sets the discrete state index for the multibody
   // state.
   void set_discrete_state_index(systems::DiscreteStateIndex index) {
@@ -2785,6 +2838,30 @@ class MultibodyTree {
   void AddJointDampingForces(const systems::Context<T>& context,
                              MultibodyForces<T>* forces) const;
 
+  // Helper for CalcInverseDynamicsDerivatives() and
+  // CalcForwardDynamicsDerivatives(). Computes the derivatives of
+  //   tau_id = M(q)v̇ + C(q, v)v - tau_g(q) - ∑ J_WBᵀ(q) Fapp_Bo_W
+  // with respect to v (in dtau_dv) and with respect to the positions
+  // perturbed along the velocities (in dtau_dw). That is, column j of dtau_dw
+  // is the derivative of tau_id as the positions move with vⱼ = 1 and all other
+  // velocities zero, so that ∂tau_id/∂q = dtau_dw⋅N⁺(q). The applied spatial
+  // forces Fapp_Bo_W (indexed by MobodIndex) are held constant in W.
+  // @throws std::exception if any mobilizer does not have a constant hinge
+  //   matrix, see Mobilizer::has_constant_hinge_matrix().
+  void CalcInverseDynamicsTangentDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      const std::vector<SpatialForce<T>>& Fapplied_Bo_W_array,
+      EigenPtr<MatrixX<T>> dtau_dw, EigenPtr<MatrixX<T>> dtau_dv) const;
+
+  // Invokes calc_node(mobod_index) once for every mobod except World, with
+  // children before their parents when `tip_to_base` is true, and parents
+  // before their children otherwise. Independent trees are swept concurrently
+  // as configured by set_forward_dynamics_parallelism(), so calc_node must
+  // only write data that belongs to the mobod it is given.
+  template <typename CalcNode>
+  void SweepArticulatedBodyNodes(bool tip_to_base,
+                                 const CalcNode& calc_node) const;
+
   void CreateBodyNode(MobodIndex mobod_index);
 
   void FinalizeModelInstances();
@@ -2867,6 +2944,13 @@ class MultibodyTree {
   // body_node_levels_[i] contains the list of all MobodIndexes at level i.
   std::vector<std::vector<MobodIndex>> body_node_levels_;
 
+  // The BodyNodes of body_node_levels_ (World excluded), level by level, with
+  // each level split into runs of nodes having the same concrete type. The
+  // base-to-tip kinematics passes iterate over these runs so that the
+  // per-node kernels are statically bound within a run. The pointers refer to
+  // elements of body_nodes_.
+  std::vector<std::vector<const internal::BodyNode<T>*>> body_node_batches_;
+
   // Joint to Mobilizer map, of size num_joints(). For a joint with index
   // joint_index, mobilizer_index = joint_to_mobilizer_[joint_index] maps to the
   // mobilizer model of the joint, or an invalid index if the joint is modeled
@@ -2896,6 +2980,9 @@ class MultibodyTree {
   // The discrete state index for the multibody state if the system is discrete.
   systems::DiscreteStateIndex discrete_state_index_;
 
+  // See set_forward_dynamics_parallelism().
+  Parallelism forward_dynamics_parallelism_{false};
+
   // True only if we get all the way through Finalize().
   bool is_finalized_{false};
 };
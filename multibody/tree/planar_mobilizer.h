@@ -81,6 +81,7 @@ class PlanarMobilizer final : public MobilizerImpl<T, 3, 3> {
 
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return true; }
+  bool has_constant_hinge_matrix() const final { return true; }
 
   /* Retrieves from `context` the two translations (x, y) which describe the
    position for `this` mobilizer as documented in this class's documentation.
@@ -77,6 +77,7 @@ class PrismaticMobilizer : public MobilizerImpl<T, 1, 1> {
 
   bool can_rotate() const final { return false; }
   bool can_translate() const final { return true; }
+  bool has_constant_hinge_matrix() const final { return true; }
 
   // @retval axis The translation axis as a unit vector expressed identically
   // in both the F and M frames. This will be one of the coordinate axes,
@@ -83,6 +83,7 @@ class QuaternionFloatingMobilizer final : public MobilizerImpl<T, 7, 6> {
 
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return true; }
+  bool has_constant_hinge_matrix() const final { return true; }
 
   // @name Methods to get and set the state for a QuaternionFloatingMobilizer
   // @{
@@ -75,6 +75,7 @@ class RevoluteMobilizer : public MobilizerImpl<T, 1, 1> {
 
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return false; }
+  bool has_constant_hinge_matrix() const final { return true; }
 
   // @retval axis The rotation axis as a unit vector expressed identically in
   // both the F and M frames. This will be one of the coordinate axes,
@@ -101,6 +101,7 @@ class RpyBallMobilizer final : public MobilizerImpl<T, 3, 3> {
 
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return false; }
+  bool has_constant_hinge_matrix() const final { return true; }
 
   // Retrieves from context the three roll-pitch-yaw angles θ₀, θ₁, θ₂ which
   // describe the state for this mobilizer as documented in this class's
@@ -99,6 +99,7 @@ class RpyFloatingMobilizer final : public MobilizerImpl<T, 6, 6> {
 
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return true; }
+  bool has_constant_hinge_matrix() const final { return true; }
 
   // Returns the generalized positions for this mobilizer stored in context.
   // Generalized positions q for this mobilizer are packed in exactly the
@@ -109,6 +109,7 @@ class ScrewMobilizer final : public MobilizerImpl<T, 1, 1> {
 
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return true; }
+  bool has_constant_hinge_matrix() const final { return true; }
 
   /* @returns the normalized axis of motion as a unit vector.
    Since the measures of this axis in either frame F or M are the same (see
@@ -0,0 +1,137 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/autodiff.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr double kTolerance = 1.0e-13;
+
+// Two trees: 0 → 1 → {2 → 7 → {8, 9}, 3 → 4}, and 5 → 6.
+const std::vector<int> kParents{-1, 0, 1, 1, 3, -1, 5, 2, 7, 7};
+
+// Returns a unit lower triangular matrix with arbitrary values in the entries
+// permitted by `parents`.
+MatrixXd MakeL(const std::vector<int>& parents) {
+  const int n = ssize(parents);
+  MatrixXd L = MatrixXd::Identity(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = parents[i]; j >= 0; j = parents[j]) {
+      L(i, j) = 0.1 * (i + 1) + 0.2 * (j + 1);
+    }
+  }
+  return L;
+}
+
+VectorXd MakeD(int n) {
+  return VectorXd::LinSpaced(n, 1.0, 3.0);
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, Empty) {
+  const MassMatrixFactorization<double> dut;
+  EXPECT_EQ(dut.size(), 0);
+  EXPECT_EQ(dut.Solve(VectorXd(0)).size(), 0);
+  EXPECT_EQ(dut.Multiply(VectorXd(0)).size(), 0);
+}
+
+// Builds M = Lᵀ⋅D⋅L from known factors and verifies they are recovered.
+GTEST_TEST(MassMatrixFactorizationTest, RecoversFactors) {
+  const int n = ssize(kParents);
+  const MatrixXd L = MakeL(kParents);
+  const VectorXd D = MakeD(n);
+  const MatrixXd M = L.transpose() * D.asDiagonal() * L;
+
+  // The factorization has no fill-in, so M has the same sparsity as L.
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < i; ++j) {
+      if (L(i, j) == 0.0) EXPECT_EQ(M(i, j), 0.0);
+    }
+  }
+
+  const MassMatrixFactorization<double> dut(kParents, M);
+  EXPECT_EQ(dut.size(), n);
+  EXPECT_EQ(dut.parent_indices(), kParents);
+  EXPECT_TRUE(CompareMatrices(dut.CalcDenseL(), L, kTolerance));
+  EXPECT_TRUE(CompareMatrices(dut.D(), D, kTolerance));
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, SolveAndMultiply) {
+  const int n = ssize(kParents);
+  const MatrixXd L = MakeL(kParents);
+  const MatrixXd M = L.transpose() * MakeD(n).asDiagonal() * L;
+  const MassMatrixFactorization<double> dut(kParents, M);
+
+  const VectorXd b = VectorXd::LinSpaced(n, -2.0, 1.0);
+  EXPECT_TRUE(CompareMatrices(dut.Solve(b), M.llt().solve(b), kTolerance));
+  EXPECT_TRUE(CompareMatrices(dut.Multiply(b), M * b, kTolerance));
+
+  MatrixXd B(n, 3);
+  B << b, 2.0 * b, VectorXd::Ones(n);
+  const MatrixXd B_expected = M.llt().solve(B);
+  dut.SolveInPlace(&B);
+  EXPECT_TRUE(CompareMatrices(B, B_expected, kTolerance));
+}
+
+// A single chain has no sparsity; the result must match a dense
+// factorization.
+GTEST_TEST(MassMatrixFactorizationTest, Chain) {
+  const int n = 4;
+  MatrixXd A = MatrixXd::Identity(n, n);
+  A(1, 0) = 0.5;
+  A(2, 0) = -0.25;
+  A(3, 2) = 0.75;
+  const MatrixXd M = A * A.transpose() + MatrixXd::Identity(n, n);
+  const MassMatrixFactorization<double> dut({-1, 0, 1, 2}, M);
+  const VectorXd b = VectorXd::LinSpaced(n, 1.0, 4.0);
+  EXPECT_TRUE(CompareMatrices(dut.Solve(b), M.llt().solve(b), kTolerance));
+  const MatrixXd L = dut.CalcDenseL();
+  EXPECT_TRUE(CompareMatrices(L.transpose() * dut.D().asDiagonal() * L, M,
+                              kTolerance));
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, AutoDiff) {
+  const int n = ssize(kParents);
+  const MatrixXd L = MakeL(kParents);
+  const MatrixXd M = L.transpose() * MakeD(n).asDiagonal() * L;
+  const MassMatrixFactorization<AutoDiffXd> dut(kParents,
+                                                M.cast<AutoDiffXd>());
+  const VectorXd b = VectorXd::LinSpaced(n, -2.0, 1.0);
+  const VectorX<AutoDiffXd> x = dut.Solve(b.cast<AutoDiffXd>());
+  EXPECT_TRUE(CompareMatrices(math::DiscardGradient(x), M.llt().solve(b),
+                              kTolerance));
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, Errors) {
+  const MatrixXd M = MatrixXd::Identity(3, 3);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MassMatrixFactorization<double>({-1, 0}, M),
+      ".*M.rows\\(\\) == n.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MassMatrixFactorization<double>({-1, 2, 0}, M),
+      ".*parent < i.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MassMatrixFactorization<double>({-2, 0, 0}, M),
+      ".*-1 <= parent.*");
+
+  const MassMatrixFactorization<double> dut({-1, 0, 0}, M);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.Solve(VectorXd(2)), ".*size\\(\\).*");
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.Multiply(VectorXd(4)), ".*size\\(\\).*");
+  MatrixXd B(2, 2);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.SolveInPlace(&B), ".*rows\\(\\).*");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -117,6 +117,7 @@ class WeldMobilizer final : public MobilizerImpl<T, 0, 0> {
 
   bool can_rotate() const final { return false; }
   bool can_translate() const final { return false; }
+  bool has_constant_hinge_matrix() const final { return true; }
 
  protected:
   void DoCalcNMatrix(const systems::Context<T>& context,
@@ -35,6 +35,33 @@ void SymmetrizeTripletList(
   }
 }
 
+BitsetGraph::BitsetGraph(const Eigen::SparseMatrix<bool>& adjacency_matrix,
+                         const std::vector<int>& order)
+    : num_vertices_(adjacency_matrix.rows()),
+      num_words_((num_vertices_ + kBitsPerWord - 1) / kBitsPerWord),
+      words_(static_cast<int64_t>(num_vertices_) * num_words_, 0) {
+  DRAKE_THROW_UNLESS(adjacency_matrix.cols() == num_vertices_);
+  DRAKE_THROW_UNLESS(order.empty() ||
+                     static_cast<int>(order.size()) == num_vertices_);
+  // position[i] is the vertex of this graph for vertex i of the matrix.
+  std::vector<int> position(num_vertices_, -1);
+  for (int k = 0; k < num_vertices_; ++k) {
+    const int i = order.empty() ? k : order[k];
+    DRAKE_THROW_UNLESS(0 <= i && i < num_vertices_ && position[i] < 0);
+    position[i] = k;
+  }
+  for (int j = 0; j < adjacency_matrix.outerSize(); ++j) {
+    Word* neighbors_j = words_.data() +
+                        static_cast<int64_t>(position[j]) * num_words_;
+    for (Eigen::SparseMatrix<bool>::InnerIterator it(adjacency_matrix, j); it;
+         ++it) {
+      if (it.value() && it.index() != j) {
+        Set(neighbors_j, position[it.index()]);
+      }
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace graph_algorithms
 }  // namespace planning
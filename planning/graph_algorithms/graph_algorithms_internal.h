@@ -1,10 +1,14 @@
 #pragma once
 
-#include <memory>
+#include <bit>
+#include <cstdint>
 #include <vector>
 
 #include <Eigen/Sparse>
 
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+
 namespace drake {
 namespace planning {
 namespace graph_algorithms {
@@ -22,6 +26,78 @@ Eigen::SparseMatrix<bool> ComplementAdjacencyMatrix(
 // This is useful when constructing adjacency matrices.
 void SymmetrizeTripletList(std::vector<Eigen::Triplet<bool>>* expected_entries);
 
+// The adjacency of an undirected graph stored as one bitset per vertex, so that
+// the neighborhood of a vertex can be intersected with a set of vertices (and
+// the result counted with popcount) one 64-bit word at a time. The word loops
+// are simple enough for the compiler to vectorize. Self-loops are dropped.
+class BitsetGraph {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BitsetGraph);
+
+  using Word = uint64_t;
+  static constexpr int kBitsPerWord = 64;
+
+  // Constructs the graph of the (symmetric) `adjacency_matrix`. If `order` is
+  // given, vertex k of this graph is vertex order[k] of `adjacency_matrix`;
+  // `order` must be a permutation of the vertices.
+  explicit BitsetGraph(const Eigen::SparseMatrix<bool>& adjacency_matrix,
+                       const std::vector<int>& order = {});
+
+  int num_vertices() const { return num_vertices_; }
+
+  // The number of words of a bitset over the vertices.
+  int num_words() const { return num_words_; }
+
+  // Returns the bitset of the neighbors of `v`.
+  const Word* neighbors(int v) const {
+    DRAKE_ASSERT(0 <= v && v < num_vertices_);
+    return words_.data() + static_cast<int64_t>(v) * num_words_;
+  }
+
+  bool IsAdjacent(int i, int j) const { return Test(neighbors(i), j); }
+
+  int Degree(int v) const { return Count(neighbors(v), num_words_); }
+
+  static bool Test(const Word* set, int v) {
+    return (set[v / kBitsPerWord] >> (v % kBitsPerWord)) & 1;
+  }
+
+  static void Set(Word* set, int v) {
+    set[v / kBitsPerWord] |= Word{1} << (v % kBitsPerWord);
+  }
+
+  static void Reset(Word* set, int v) {
+    set[v / kBitsPerWord] &= ~(Word{1} << (v % kBitsPerWord));
+  }
+
+  // Returns the number of elements of `set`.
+  static int Count(const Word* set, int num_words) {
+    int count = 0;
+    for (int w = 0; w < num_words; ++w) {
+      count += std::popcount(set[w]);
+    }
+    return count;
+  }
+
+  // Sets `result` to the intersection of `a` and `b`, and returns its number of
+  // elements. `result` may alias `a` or `b`.
+  static int Intersect(const Word* a, const Word* b, int num_words,
+                       Word* result) {
+    int count = 0;
+    for (int w = 0; w < num_words; ++w) {
+      result[w] = a[w] & b[w];
+      count += std::popcount(result[w]);
+    }
+    return count;
+  }
+
+ private:
+  int num_vertices_{};
+  int num_words_{};
+  // The bitsets of the neighbors of each vertex, one after the other.
+  std::vector<Word> words_;
+};
+
 }  // namespace internal
 }  // namespace graph_algorithms
 }  // namespace planning
@@ -0,0 +1,313 @@
+#include "drake/planning/graph_algorithms/max_clique_solver_via_branch_and_bound.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <common_robotics_utilities/parallelism.hpp>
+
+#include "drake/common/text_logging.h"
+#include "drake/planning/graph_algorithms/graph_algorithms_internal.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using internal::BitsetGraph;
+using Word = BitsetGraph::Word;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The largest clique found so far, shared by all of the threads.
+class Incumbent {
+ public:
+  int size() const { return size_.load(std::memory_order_relaxed); }
+
+  // Replaces the incumbent by `clique` if it is larger.
+  void Offer(const std::vector<int>& clique) {
+    if (ssize(clique) <= size()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ssize(clique) > size()) {
+      clique_ = clique;
+      size_.store(ssize(clique), std::memory_order_relaxed);
+    }
+  }
+
+  const std::vector<int>& clique() const { return clique_; }
+
+ private:
+  std::atomic<int> size_{0};
+  std::mutex mutex_;
+  std::vector<int> clique_;
+};
+
+// Greedily colors the vertices of `candidates`: each color class is an
+// independent set, built by repeatedly taking the first uncolored vertex and
+// excluding its neighbors. Lists the vertices in `order` with their colors
+// (starting at 1) in `colors`, by non-decreasing color.
+void ColorSort(const BitsetGraph& graph, const Word* candidates,
+               std::vector<Word>* uncolored, std::vector<Word>* color_class,
+               std::vector<int>* order, std::vector<int>* colors) {
+  const int num_words = graph.num_words();
+  uncolored->assign(candidates, candidates + num_words);
+  color_class->resize(num_words);
+  order->clear();
+  colors->clear();
+  int num_uncolored = BitsetGraph::Count(candidates, num_words);
+  for (int color = 1; num_uncolored > 0; ++color) {
+    std::copy(uncolored->begin(), uncolored->end(), color_class->begin());
+    for (int w = 0; w < num_words; ++w) {
+      while ((*color_class)[w] != 0) {
+        const int v = w * BitsetGraph::kBitsPerWord +
+                      std::countr_zero((*color_class)[w]);
+        BitsetGraph::Reset(uncolored->data(), v);
+        BitsetGraph::Reset(color_class->data(), v);
+        const Word* neighbors = graph.neighbors(v);
+        for (int u = w; u < num_words; ++u) {
+          (*color_class)[u] &= ~neighbors[u];
+        }
+        order->push_back(v);
+        colors->push_back(color);
+        --num_uncolored;
+      }
+    }
+  }
+}
+
+// The search of one thread.
+class Search {
+ public:
+  Search(const BitsetGraph& graph, Incumbent* incumbent,
+         Clock::time_point deadline, std::atomic<bool>* timed_out)
+      : graph_(graph),
+        incumbent_(*incumbent),
+        deadline_(deadline),
+        timed_out_(*timed_out),
+        candidates_(graph.num_vertices() + 1),
+        orders_(graph.num_vertices() + 1),
+        colors_(graph.num_vertices() + 1) {}
+
+  // Searches the cliques which contain `clique` and otherwise only vertices of
+  // `candidates` (which must all be adjacent to the vertices of `clique`).
+  void Run(std::vector<int> clique, const std::vector<Word>& candidates) {
+    clique_ = std::move(clique);
+    if (BitsetGraph::Count(candidates.data(), graph_.num_words()) == 0) {
+      incumbent_.Offer(clique_);
+      return;
+    }
+    candidates_[0] = candidates;
+    Expand(0);
+  }
+
+ private:
+  bool TimedOut() {
+    if (timed_out_.load(std::memory_order_relaxed)) {
+      return true;
+    }
+    // Reading the clock is comparatively expensive, so only do it every so
+    // often.
+    if (++num_nodes_ % 256 == 0 && Clock::now() > deadline_) {
+      timed_out_.store(true, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  // Branches on the vertices of candidates_[depth].
+  void Expand(int depth) {
+    std::vector<Word>& candidates = candidates_[depth];
+    std::vector<int>& order = orders_[depth];
+    std::vector<int>& colors = colors_[depth];
+    ColorSort(graph_, candidates.data(), &uncolored_, &color_class_, &order,
+              &colors);
+    std::vector<Word>& next_candidates = candidates_[depth + 1];
+    next_candidates.resize(graph_.num_words());
+    // Branch on the vertices with the most colors first, since the others are
+    // more likely to be pruned once a large clique is found.
+    for (int k = ssize(order) - 1; k >= 0; --k) {
+      if (TimedOut() || ssize(clique_) + colors[k] <= incumbent_.size()) {
+        return;
+      }
+      const int v = order[k];
+      clique_.push_back(v);
+      const int num_next_candidates =
+          BitsetGraph::Intersect(candidates.data(), graph_.neighbors(v),
+                                 graph_.num_words(), next_candidates.data());
+      if (num_next_candidates == 0) {
+        incumbent_.Offer(clique_);
+      } else {
+        Expand(depth + 1);
+      }
+      clique_.pop_back();
+      BitsetGraph::Reset(candidates.data(), v);
+    }
+  }
+
+  const BitsetGraph& graph_;
+  Incumbent& incumbent_;
+  const Clock::time_point deadline_;
+  std::atomic<bool>& timed_out_;
+  int64_t num_nodes_{0};
+  std::vector<int> clique_;
+  // The scratch space of each depth of the search. The outer vectors are
+  // allocated up front, so that references to the inner ones stay valid.
+  std::vector<std::vector<Word>> candidates_;
+  std::vector<std::vector<int>> orders_;
+  std::vector<std::vector<int>> colors_;
+  std::vector<Word> uncolored_;
+  std::vector<Word> color_class_;
+};
+
+// Returns a clique built by repeatedly adding the candidate vertex with the
+// most candidate neighbors.
+std::vector<int> GreedyClique(const BitsetGraph& graph) {
+  std::vector<int> clique;
+  std::vector<Word> candidates(graph.num_words(), 0);
+  for (int v = 0; v < graph.num_vertices(); ++v) {
+    BitsetGraph::Set(candidates.data(), v);
+  }
+  std::vector<Word> scratch(graph.num_words());
+  while (BitsetGraph::Count(candidates.data(), graph.num_words()) > 0) {
+    int best_vertex = -1;
+    int best_degree = -1;
+    for (int v = 0; v < graph.num_vertices(); ++v) {
+      if (BitsetGraph::Test(candidates.data(), v)) {
+        const int degree =
+            BitsetGraph::Intersect(candidates.data(), graph.neighbors(v),
+                                   graph.num_words(), scratch.data());
+        if (degree > best_degree) {
+          best_vertex = v;
+          best_degree = degree;
+        }
+      }
+    }
+    clique.push_back(best_vertex);
+    BitsetGraph::Intersect(candidates.data(), graph.neighbors(best_vertex),
+                           graph.num_words(), candidates.data());
+  }
+  return clique;
+}
+
+}  // namespace
+
+MaxCliqueSolverViaBranchAndBound::MaxCliqueSolverViaBranchAndBound(
+    Parallelism parallelism, double time_limit)
+    : parallelism_(parallelism) {
+  SetTimeLimit(time_limit);
+}
+
+void MaxCliqueSolverViaBranchAndBound::SetTimeLimit(double time_limit) {
+  DRAKE_THROW_UNLESS(time_limit >= 0);
+  time_limit_ = time_limit;
+}
+
+VectorX<bool> MaxCliqueSolverViaBranchAndBound::DoSolveMaxClique(
+    const Eigen::SparseMatrix<bool>& adjacency_matrix) const {
+  const int num_vertices = adjacency_matrix.rows();
+  VectorX<bool> is_clique_member = VectorX<bool>::Constant(num_vertices, false);
+  if (num_vertices == 0) {
+    return is_clique_member;
+  }
+
+  // Relabel the vertices by non-increasing degree, so that the coloring (which
+  // visits the vertices in order) colors the vertices of high degree first.
+  std::vector<int> degree(num_vertices);
+  for (int j = 0; j < num_vertices; ++j) {
+    for (Eigen::SparseMatrix<bool>::InnerIterator it(adjacency_matrix, j); it;
+         ++it) {
+      degree[j] += (it.value() && it.index() != j);
+    }
+  }
+  std::vector<int> vertex_order(num_vertices);
+  std::iota(vertex_order.begin(), vertex_order.end(), 0);
+  std::stable_sort(vertex_order.begin(), vertex_order.end(),
+                   [&degree](int a, int b) {
+                     return degree[a] > degree[b];
+                   });
+  const BitsetGraph graph(adjacency_matrix, vertex_order);
+
+  Incumbent incumbent;
+  incumbent.Offer(GreedyClique(graph));
+
+  // Each vertex at the root of the search is a branch, which only has to
+  // consider the vertices before it in the coloring order.
+  std::vector<Word> all_vertices(graph.num_words(), 0);
+  for (int v = 0; v < num_vertices; ++v) {
+    BitsetGraph::Set(all_vertices.data(), v);
+  }
+  std::vector<Word> uncolored;
+  std::vector<Word> color_class;
+  std::vector<int> order;
+  std::vector<int> colors;
+  ColorSort(graph, all_vertices.data(), &uncolored, &color_class, &order,
+            &colors);
+  std::vector<int> rank(num_vertices);
+  for (int k = 0; k < num_vertices; ++k) {
+    rank[order[k]] = k;
+  }
+
+  // Time limits beyond a (generous) year are treated as infinite, to avoid
+  // overflowing the clock.
+  const Clock::time_point deadline =
+      time_limit_ < 3600.0 * 24 * 365
+          ? Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                               std::chrono::duration<double>(time_limit_))
+          : Clock::time_point::max();
+  std::atomic<bool> timed_out{false};
+  const int num_threads = std::min(parallelism_.num_threads(), num_vertices);
+  std::vector<Search> searches;
+  searches.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    searches.emplace_back(graph, &incumbent, deadline, &timed_out);
+  }
+
+  const auto branch_work = [&](const int thread_num, const int64_t index) {
+    const int k = num_vertices - 1 - static_cast<int>(index);
+    if (timed_out.load(std::memory_order_relaxed) ||
+        colors[k] <= incumbent.size()) {
+      return;
+    }
+    const int v = order[k];
+    std::vector<Word> candidates(graph.num_words(), 0);
+    const Word* neighbors = graph.neighbors(v);
+    for (int w = 0; w < graph.num_words(); ++w) {
+      for (Word bits = neighbors[w]; bits != 0; bits &= bits - 1) {
+        const int u = w * BitsetGraph::kBitsPerWord + std::countr_zero(bits);
+        if (rank[u] < k) {
+          BitsetGraph::Set(candidates.data(), u);
+        }
+      }
+    }
+    searches[thread_num].Run({v}, candidates);
+  };
+  DynamicParallelForIndexLoop(DegreeOfParallelism(num_threads), 0,
+                              num_vertices, branch_work,
+                              ParallelForBackend::BEST_AVAILABLE);
+
+  if (timed_out.load()) {
+    log()->info(
+        "MaxCliqueSolverViaBranchAndBound reached its time limit of {} s; the "
+        "returned clique of size {} might not be maximum.",
+        time_limit_, incumbent.size());
+  }
+  for (const int v : incumbent.clique()) {
+    is_clique_member(vertex_order[v]) = true;
+  }
+  return is_clique_member;
+}
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
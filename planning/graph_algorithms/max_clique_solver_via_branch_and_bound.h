@@ -0,0 +1,73 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+
+#include <Eigen/Sparse>
+
+#include "drake/common/parallelism.h"
+#include "drake/planning/graph_algorithms/max_clique_solver_base.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+
+/**
+ * Solves the maximum clique problem to global optimality by a combinatorial
+ * branch and bound, without the need for a Mixed-Integer Programming solver.
+ *
+ * The candidate vertices at each node of the search are greedily colored, and
+ * since the vertices of a clique all have different colors, the number of
+ * colors bounds the size of any clique among the candidates. Branches whose
+ * bound cannot beat the largest clique found so far are pruned. The adjacency
+ * is stored as bitsets, so that the candidate sets are intersected and counted
+ * a 64-bit word at a time. See
+ *
+ * P. San Segundo, D. Rodríguez-Losada and A. Jiménez, "An exact bit-parallel
+ * algorithm for the maximum clique problem," Computers & Operations Research,
+ * 38(2), 2011.
+ *
+ * The branches at the root of the search are distributed over the threads of
+ * `parallelism`, which share the largest clique found so far.
+ *
+ * The search can be given a time limit, after which the largest clique found so
+ * far is returned; it is then not necessarily a maximum clique. The search is
+ * seeded with a greedy clique, so that this is still a reasonable clique.
+ */
+class MaxCliqueSolverViaBranchAndBound final : public MaxCliqueSolverBase {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MaxCliqueSolverViaBranchAndBound);
+
+  /**
+   * @param parallelism The number of threads of the search.
+   * @param time_limit The time (in seconds) after which the search stops.
+   * @throws std::exception if time_limit is negative.
+   */
+  explicit MaxCliqueSolverViaBranchAndBound(
+      Parallelism parallelism = Parallelism::Max(),
+      double time_limit = std::numeric_limits<double>::infinity());
+
+  /** Sets the number of threads of the search. */
+  void SetParallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /** Gets the number of threads of the search. */
+  [[nodiscard]] Parallelism GetParallelism() const { return parallelism_; }
+
+  /** Sets the time (in seconds) after which the search stops.
+   * @throws std::exception if time_limit is negative. */
+  void SetTimeLimit(double time_limit);
+
+  /** Gets the time (in seconds) after which the search stops. */
+  [[nodiscard]] double GetTimeLimit() const { return time_limit_; }
+
+ private:
+  VectorX<bool> DoSolveMaxClique(
+      const Eigen::SparseMatrix<bool>& adjacency_matrix) const final;
+
+  Parallelism parallelism_;
+  double time_limit_{};
+};
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
@@ -23,6 +23,10 @@ namespace graph_algorithms {
  *
  * @note if min clique size > 1, then this class will not strictly compute a
  * clique cover since not all vertices will be covered.
+ *
+ * The cliques are found one after the other, since each depends on the
+ * vertices covered by the ones before it. To use multiple threads, provide a
+ * parallel max clique solver (e.g., MaxCliqueSolverViaBranchAndBound).
  */
 class MinCliqueCoverSolverViaGreedy final : public MinCliqueCoverSolverBase {
  public:
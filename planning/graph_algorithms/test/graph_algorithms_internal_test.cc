@@ -213,6 +213,42 @@ GTEST_TEST(ComplementGraph, FullyConnectedPlusBipartiteGraph) {
                       complement_graph_expected.toDense().cast<double>()));
 }
 
+GTEST_TEST(BitsetGraph, MatchesAdjacency) {
+  // Enough vertices to span two words, with self loops, which are dropped.
+  const int n = 70;
+  Eigen::SparseMatrix<bool> identity(n, n);
+  identity.setIdentity();
+  const Eigen::SparseMatrix<bool> graph =
+      (internal::MakeCompleteGraph(n) + identity).template cast<bool>();
+  const internal::BitsetGraph bitset_graph(graph);
+  EXPECT_EQ(bitset_graph.num_vertices(), n);
+  EXPECT_EQ(bitset_graph.num_words(), 2);
+  for (int i = 0; i < n; ++i) {
+    EXPECT_EQ(bitset_graph.Degree(i), n - 1);
+    EXPECT_FALSE(bitset_graph.IsAdjacent(i, i));
+  }
+
+  // The vertices of the butterfly, in reverse order.
+  const internal::BitsetGraph butterfly(internal::ButterflyGraph(),
+                                        {4, 3, 2, 1, 0});
+  const Eigen::MatrixXi expected =
+      internal::ButterflyGraph().toDense().cast<int>().reverse();
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      EXPECT_EQ(butterfly.IsAdjacent(i, j), expected(i, j) == 1);
+    }
+  }
+
+  // Vertex 2 (the center of the butterfly) and vertex 4 (vertex 0 of the
+  // butterfly) share the neighbor 3.
+  std::vector<internal::BitsetGraph::Word> common(butterfly.num_words());
+  EXPECT_EQ(internal::BitsetGraph::Intersect(
+                butterfly.neighbors(2), butterfly.neighbors(4),
+                butterfly.num_words(), common.data()),
+            1);
+  EXPECT_TRUE(internal::BitsetGraph::Test(common.data(), 3));
+}
+
 }  // namespace
 }  // namespace graph_algorithms
 }  // namespace planning
@@ -0,0 +1,249 @@
+#include "drake/planning/graph_algorithms/max_clique_solver_via_branch_and_bound.h"
+
+#include <bit>
+#include <exception>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/planning/graph_algorithms/test/common_graphs.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+namespace {
+
+using Eigen::Triplet;
+
+// Returns true iff the vertices marked in `clique` are pairwise adjacent.
+bool IsClique(const Eigen::SparseMatrix<bool>& adjacency_matrix,
+              const VectorX<bool>& clique) {
+  for (int i = 0; i < clique.size(); ++i) {
+    for (int j = i + 1; j < clique.size(); ++j) {
+      if (clique(i) && clique(j) && !adjacency_matrix.coeff(i, j)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Test maximum clique solved via branch and bound, both serially and in
+// parallel. Compare against the expected size of the solution and ensure that
+// the result is one of the true maximum cliques in the graph.
+void TestMaxCliqueViaBranchAndBound(
+    const Eigen::SparseMatrix<bool>& adjacency_matrix, const int expected_size,
+    const std::vector<VectorX<bool>>& possible_solutions) {
+  for (const Parallelism parallelism :
+       {Parallelism::None(), Parallelism(4)}) {
+    MaxCliqueSolverViaBranchAndBound solver(parallelism);
+    const VectorX<bool> max_clique_inds =
+        solver.SolveMaxClique(adjacency_matrix);
+    EXPECT_EQ(max_clique_inds.cast<int>().sum(), expected_size);
+    bool solution_match_found = false;
+    for (const auto& possible_solution : possible_solutions) {
+      if (max_clique_inds == possible_solution) {
+        solution_match_found = true;
+        break;
+      }
+    }
+    EXPECT_TRUE(solution_match_found);
+  }
+}
+
+// Returns a random graph with `n` vertices, where each edge is present with
+// probability `density`.
+Eigen::SparseMatrix<bool> MakeRandomGraph(int n, double density,
+                                          std::mt19937* generator) {
+  std::bernoulli_distribution has_edge(density);
+  std::vector<Triplet<bool>> triplets;
+  for (int i = 0; i < n; ++i) {
+    for (int j = i + 1; j < n; ++j) {
+      if (has_edge(*generator)) {
+        triplets.emplace_back(i, j, true);
+        triplets.emplace_back(j, i, true);
+      }
+    }
+  }
+  Eigen::SparseMatrix<bool> graph(n, n);
+  graph.setFromTriplets(triplets.begin(), triplets.end());
+  return graph;
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest,
+           TestConstructorSettersAndGetters) {
+  MaxCliqueSolverViaBranchAndBound solver{};
+  EXPECT_EQ(solver.GetParallelism().num_threads(),
+            Parallelism::Max().num_threads());
+  EXPECT_EQ(solver.GetTimeLimit(), std::numeric_limits<double>::infinity());
+
+  solver.SetParallelism(Parallelism(2));
+  EXPECT_EQ(solver.GetParallelism().num_threads(), 2);
+  solver.SetTimeLimit(1.5);
+  EXPECT_EQ(solver.GetTimeLimit(), 1.5);
+  EXPECT_THROW(solver.SetTimeLimit(-1), std::exception);
+  EXPECT_THROW(MaxCliqueSolverViaBranchAndBound(Parallelism::None(), -1),
+               std::exception);
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, EmptyGraph) {
+  MaxCliqueSolverViaBranchAndBound solver{};
+  EXPECT_EQ(solver.SolveMaxClique(Eigen::SparseMatrix<bool>(0, 0)).size(), 0);
+  // Without edges, a maximum clique is a single vertex.
+  EXPECT_EQ(
+      solver.SolveMaxClique(Eigen::SparseMatrix<bool>(4, 4)).cast<int>().sum(),
+      1);
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, CompleteGraph) {
+  for (const auto n : {3, 8, 70}) {
+    // The entire graph forms a clique.
+    std::vector<VectorX<bool>> possible_solutions{
+        VectorX<bool>::Constant(n, true)};
+    TestMaxCliqueViaBranchAndBound(internal::MakeCompleteGraph(n), n,
+                                   possible_solutions);
+  }
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, BullGraph) {
+  VectorX<bool> solution(5);
+  // The largest clique is (1,2,3).
+  solution << false, true, true, true, false;
+  TestMaxCliqueViaBranchAndBound(internal::BullGraph(), 3, {solution});
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, ButterflyWithSelfLoops) {
+  VectorX<bool> solution1(5);
+  VectorX<bool> solution2(5);
+  // The largest cliques are (0,1,2) and (2,3,4).
+  solution1 << true, true, true, false, false;
+  solution2 << false, false, true, true, true;
+  TestMaxCliqueViaBranchAndBound(internal::ButterflyGraph(), 3,
+                                 {solution1, solution2});
+
+  // The max clique should not change if we allow self loops in the adjacency.
+  Eigen::SparseMatrix<bool> identity(5, 5);
+  identity.setIdentity();
+  const Eigen::SparseMatrix<bool> graph =
+      (internal::ButterflyGraph() + identity).template cast<bool>();
+  TestMaxCliqueViaBranchAndBound(graph, 3, {solution1, solution2});
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, PetersenGraph) {
+  // The Petersen graph has a clique number of size 2, so all edges are possible
+  // solutions.
+  Eigen::SparseMatrix<bool> graph = internal::PetersenGraph();
+  std::vector<VectorX<bool>> possible_solutions;
+  for (int i = 0; i < graph.outerSize(); ++i) {
+    for (Eigen::SparseMatrix<bool>::InnerIterator it(graph, i); it; ++it) {
+      VectorX<bool> solution = VectorX<bool>::Constant(10, false);
+      solution(it.row()) = true;
+      solution(it.col()) = true;
+      possible_solutions.push_back(solution);
+    }
+  }
+  TestMaxCliqueViaBranchAndBound(graph, 2, possible_solutions);
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest,
+           FullyConnectedPlusFullBipartiteGraph) {
+  // The greedy solver does not find the maximum clique (0,1,2) of this graph.
+  VectorX<bool> solution(9);
+  solution << true, true, true, false, false, false, false, false, false;
+  TestMaxCliqueViaBranchAndBound(
+      internal::FullyConnectedPlusFullBipartiteGraph(), 3, {solution});
+}
+
+// Compares against an exhaustive search over all subsets of small random
+// graphs.
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, RandomGraphs) {
+  std::mt19937 generator(42);
+  const int n = 16;
+  for (const double density : {0.2, 0.5, 0.8}) {
+    for (int trial = 0; trial < 3; ++trial) {
+      const Eigen::SparseMatrix<bool> graph =
+          MakeRandomGraph(n, density, &generator);
+      // Bit j of neighbors[i] is set iff i and j are adjacent.
+      std::vector<unsigned> neighbors(n, 0);
+      for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+          if (graph.coeff(i, j)) {
+            neighbors[i] |= 1u << j;
+          }
+        }
+      }
+      int expected_size = 0;
+      for (unsigned subset = 1; subset < (1u << n); ++subset) {
+        const int size = std::popcount(subset);
+        if (size <= expected_size) {
+          continue;
+        }
+        bool is_clique = true;
+        for (int i = 0; i < n && is_clique; ++i) {
+          if ((subset >> i) & 1) {
+            const unsigned others = subset & ~(1u << i);
+            is_clique = (others & ~neighbors[i]) == 0;
+          }
+        }
+        if (is_clique) {
+          expected_size = size;
+        }
+      }
+      for (const Parallelism parallelism :
+           {Parallelism::None(), Parallelism(3)}) {
+        const VectorX<bool> clique =
+            MaxCliqueSolverViaBranchAndBound(parallelism).SolveMaxClique(graph);
+        EXPECT_EQ(clique.cast<int>().sum(), expected_size);
+        EXPECT_TRUE(IsClique(graph, clique));
+      }
+    }
+  }
+}
+
+// A clique planted in a larger random graph (spanning several words of the
+// bitsets) is found.
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, PlantedClique) {
+  std::mt19937 generator(7);
+  const int n = 200;
+  Eigen::SparseMatrix<bool> graph = MakeRandomGraph(n, 0.2, &generator);
+  std::vector<Triplet<bool>> triplets;
+  for (int i = 0; i < n; i += 10) {
+    for (int j = 0; j < n; j += 10) {
+      if (i != j) {
+        triplets.emplace_back(i, j, true);
+      }
+    }
+  }
+  Eigen::SparseMatrix<bool> planted(n, n);
+  planted.setFromTriplets(triplets.begin(), triplets.end());
+  graph = (graph + planted).template cast<bool>();
+
+  MaxCliqueSolverViaBranchAndBound solver(Parallelism(4));
+  const VectorX<bool> clique = solver.SolveMaxClique(graph);
+  EXPECT_GE(clique.cast<int>().sum(), 20);
+  EXPECT_TRUE(IsClique(graph, clique));
+
+  // With no time at all, the result is still a clique.
+  solver.SetTimeLimit(0);
+  const VectorX<bool> quick_clique = solver.SolveMaxClique(graph);
+  EXPECT_GE(quick_clique.cast<int>().sum(), 1);
+  EXPECT_TRUE(IsClique(graph, quick_clique));
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, AdjacencyNotSymmetric) {
+  std::vector<Triplet<bool>> triplets;
+  triplets.push_back(Triplet<bool>(0, 1, 1));
+  Eigen::SparseMatrix<bool> graph(3, 3);
+  graph.setFromTriplets(triplets.begin(), triplets.end());
+  MaxCliqueSolverViaBranchAndBound solver{};
+  // Cast to void since we expect it to throw, but SolveMaxClique is
+  // marked as nodiscard.
+  EXPECT_THROW((void)solver.SolveMaxClique(graph), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
@@ -9,6 +9,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/planning/graph_algorithms/max_clique_solver_via_branch_and_bound.h"
 #include "drake/planning/graph_algorithms/max_clique_solver_via_greedy.h"
 #include "drake/planning/graph_algorithms/max_clique_solver_via_mip.h"
 #include "drake/planning/graph_algorithms/test/common_graphs.h"
@@ -168,6 +169,28 @@ GTEST_TEST(MinCliqueCoverSolverViaGreedyTestTest, ButterflyGraph) {
   TestMinCliqueCover(graph, true, possible_solutions, &solver);
 }
 
+// The cover is parallelized by a parallel max clique solver.
+GTEST_TEST(MinCliqueCoverSolverViaGreedyTestTest, ParallelMaxCliqueSolver) {
+  Eigen::SparseMatrix<bool> graph = internal::ButterflyGraph();
+  MinCliqueCoverSolverViaGreedy solver{
+      std::make_unique<MaxCliqueSolverViaBranchAndBound>(Parallelism(2)), 1};
+
+  comparable_clique_solution_type solution;
+  solution.insert(std::initializer_list<int>{0, 1, 2});
+  solution.insert(std::initializer_list<int>{2, 3, 4});
+  TestMinCliqueCover(graph, false, {solution}, &solver);
+
+  solution.clear();
+  solution.insert(std::initializer_list<int>{0, 1, 2});
+  solution.insert(std::initializer_list<int>{3, 4});
+  std::vector<comparable_clique_solution_type> possible_solutions{solution};
+  solution.clear();
+  solution.insert(std::initializer_list<int>{2, 3, 4});
+  solution.insert(std::initializer_list<int>{0, 1});
+  possible_solutions.push_back(solution);
+  TestMinCliqueCover(graph, true, possible_solutions, &solver);
+}
+
 GTEST_TEST(MinCliqueCoverSolverViaGreedyTestTest, PetersenGraph) {
   Eigen::SparseMatrix<bool> graph = internal::PetersenGraph();
   MinCliqueCoverSolverViaGreedy solver{
@@ -1,5 +1,7 @@
 #include "drake/planning/iris/iris_common.h"
 
+#include <algorithm>
+
 #include <common_robotics_utilities/parallelism.hpp>
 
 #include "drake/geometry/optimization/hpolyhedron.h"
@@ -78,8 +80,7 @@ namespace internal {
 using common_robotics_utilities::parallelism::DegreeOfParallelism;
 using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
 using common_robotics_utilities::parallelism::ParallelForBackend;
-using common_robotics_utilities::parallelism::StaticParallelForRangeLoop;
-using common_robotics_utilities::parallelism::ThreadWorkRange;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 using geometry::optimization::Hyperellipsoid;
 using geometry::optimization::VPolytope;
 
@@ -298,25 +299,25 @@ void PopulateParticlesByUniformSampling(
     int mixing_steps, std::vector<RandomGenerator>* generators,
     std::vector<Eigen::VectorXd>* particles) {
   DRAKE_THROW_UNLESS(number_to_sample <= ssize(*particles));
-  const int num_threads = ssize(*generators);
-
-  const auto hit_and_run_sample_work =
-      [&P, &particles, &generators,
-       &mixing_steps](const ThreadWorkRange& work_range) {
-        const int64_t start_index = work_range.GetRangeStart();
-        const int64_t end_index = work_range.GetRangeEnd();
-        const int64_t thread_num = work_range.GetThreadNum();
-        RandomGenerator* generator = &(generators->at(thread_num));
-        (*particles)[start_index] = P.UniformSample(generator, mixing_steps);
-        for (int j = start_index + 1; j < end_index; ++j) {
-          (*particles)[j] =
-              P.UniformSample(generator, (*particles)[j - 1], mixing_steps);
-        }
-      };
-
-  StaticParallelForRangeLoop(DegreeOfParallelism(num_threads), 0,
-                             number_to_sample, hit_and_run_sample_work,
-                             ParallelForBackend::BEST_AVAILABLE);
+  DRAKE_THROW_UNLESS(!generators->empty());
+  if (number_to_sample <= 0) {
+    return;
+  }
+  // Advance one hit-and-run chain per generator, starting from the Chebyshev
+  // center. Chain k draws with generators->at(k) and fills every num_chains-th
+  // particle, starting from particle k.
+  const int num_chains = std::min<int>(ssize(*generators), number_to_sample);
+  const auto chain_work = [&](const int, const int64_t chain) {
+    RandomGenerator* generator = &(generators->at(chain));
+    Eigen::VectorXd sample = P.UniformSample(generator, mixing_steps);
+    (*particles)[chain] = sample;
+    for (int j = chain + num_chains; j < number_to_sample; j += num_chains) {
+      sample = P.UniformSample(generator, sample, mixing_steps);
+      (*particles)[j] = sample;
+    }
+  };
+  StaticParallelForIndexLoop(DegreeOfParallelism(num_chains), 0, num_chains,
+                             chain_work, ParallelForBackend::BEST_AVAILABLE);
 }
 
 }  // namespace internal
@@ -369,8 +369,9 @@ Eigen::VectorXd ComputeFaceTangentToDistCvxh(
     const solvers::SolverInterface& solver);
 
 // Populates particles with random samples, drawn across potentially multiple
-// threads. number_to_sample must be smaller than ssize(particles), and
-// ssize(generators) threads will be used to draw samples.
+// threads. number_to_sample must be smaller than ssize(particles). The samples
+// come from ssize(generators) hit-and-run chains, advanced on as many threads;
+// each chain draws from its own generator.
 // @param[out] particles is an output-only argument, which must be preallocated
 // to size at least number_to_sample. The first number_to_sample elements will
 // be overwritten, and remaining elements are undefined.
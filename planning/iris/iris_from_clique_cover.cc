@@ -10,14 +10,14 @@
 #include <string>
 #include <thread>
 #include <utility>
-
-#include <common_robotics_utilities/parallelism.hpp>
+#include <vector>
 
 #include "drake/common/fmt_eigen.h"
 #include "drake/common/overloaded.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/optimization/iris.h"
 #include "drake/planning/collision_checker.h"
+#include "drake/planning/iris/iris_from_clique_cover_internal.h"
 #include "drake/planning/scene_graph_collision_checker.h"
 #include "drake/planning/visibility_graph.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -26,9 +26,6 @@
 
 namespace drake {
 namespace planning {
-using common_robotics_utilities::parallelism::DegreeOfParallelism;
-using common_robotics_utilities::parallelism::ParallelForBackend;
-using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 using Eigen::SparseMatrix;
 using geometry::Meshcat;
 using geometry::Rgba;
@@ -300,61 +297,6 @@ int ComputeMaxNumberOfCliquesInGreedyCliqueCover(
                           (s * (s + 1)) / 2);
 }
 
-// Approximately compute the fraction of `domain` covered by `sets` by sampling
-// points uniformly at random in `domain` and checking whether the point lies in
-// one of the sets in `sets`.
-//
-// The `generator` is used as the source of randomness for drawing points from
-// domain.
-//
-// The sampled points are checked for inclusion in `sets` in parallel, with the
-// degree of parallelism determined by `parallelism`.
-//
-// The value of `last_polytope_sample` is used to initialize the distribution
-// over the domain. The value of the final sample is written to this vector so
-// that the MCMC sampling can continue. See @HPolyhedron for details.
-double ApproximatelyComputeCoverage(
-    const HPolyhedron& domain, const std::vector<HPolyhedron>& sets,
-    const CollisionChecker& checker, const int num_samples,
-    const double point_in_set_tol, const Parallelism& parallelism,
-    RandomGenerator* generator, Eigen::VectorXd* last_polytope_sample) {
-  double fraction_covered = 0.0;
-  if (sets.empty()) {
-    log()->info("Current Fraction of Domain Covered = 0");
-    // Fail fast if there is nothing to check.
-    return 0.0;
-  }
-  Eigen::MatrixXd sampled_points(domain.ambient_dimension(), num_samples);
-  for (int i = 0; i < sampled_points.cols(); ++i) {
-    do {
-      *last_polytope_sample =
-          domain.UniformSample(generator, *last_polytope_sample);
-    } while (!checker.CheckConfigCollisionFree(*last_polytope_sample));
-    sampled_points.col(i) = *last_polytope_sample;
-  }
-
-  std::atomic<int> num_in_sets{0};
-  const auto point_in_cover = [&sets, &num_in_sets, &sampled_points,
-                               &point_in_set_tol](const int thread_num,
-                                                  const int i) {
-    unused(thread_num);
-    for (const auto& set : sets) {
-      if (set.PointInSet(sampled_points.col(i), point_in_set_tol)) {
-        num_in_sets.fetch_add(1);
-        break;
-      }
-    }
-  };
-  StaticParallelForIndexLoop(DegreeOfParallelism(parallelism.num_threads()), 0,
-                             sampled_points.cols(), point_in_cover,
-                             ParallelForBackend::BEST_AVAILABLE);
-
-  fraction_covered = static_cast<double>(num_in_sets.load()) / num_samples;
-
-  log()->debug("Current Fraction of Domain Covered = {}", fraction_covered);
-  return fraction_covered;
-}
-
 std::unique_ptr<planning::graph_algorithms::MaxCliqueSolverBase>
 MakeDefaultMaxCliqueSolver() {
   return std::unique_ptr<planning::graph_algorithms::MaxCliqueSolverBase>(
@@ -457,8 +399,6 @@ void IrisInConfigurationSpaceFromCliqueCover(
 
   DRAKE_THROW_UNLESS(domain.ambient_dimension() ==
                      checker.plant().num_positions());
-  Eigen::VectorXd last_polytope_sample = domain.UniformSample(generator);
-
   // Override options which are set too aggressively.
   const int minimum_clique_size = std::max(options.minimum_clique_size,
                                            checker.plant().num_positions() + 1);
@@ -487,32 +427,37 @@ void IrisInConfigurationSpaceFromCliqueCover(
   const planning::graph_algorithms::MaxCliqueSolverBase* max_clique_solver =
       max_clique_solver_ptr == nullptr ? default_max_clique_solver.get()
                                        : max_clique_solver_ptr;
+  // All of the collision-free points are drawn from the same hit-and-run
+  // chains, a few per thread so that each batch of collision checks keeps the
+  // threads busy.
+  internal::CollisionFreeSampler sampler(
+      domain, checker, 4 * max_collision_checker_parallelism.num_threads(),
+      max_collision_checker_parallelism);
+  internal::IncrementalCoverageEstimator coverage_estimator(
+      options.num_points_per_coverage_check, options.point_in_set_tol);
   auto approximate_coverage = [&]() {
-    return ApproximatelyComputeCoverage(
-        domain, *sets, checker, options.num_points_per_coverage_check,
-        options.point_in_set_tol, options.parallelism, generator,
-        &last_polytope_sample);
+    return coverage_estimator.Update(*sets, options.parallelism, &sampler,
+                                     generator);
   };
+  // The points which are not covered by the sets built in an iteration are
+  // kept for the next one, together with their visibility edges, so that only
+  // the edges of the newly sampled points need to be checked.
+  IncrementalVisibilityGraph incremental_visibility_graph(checker);
   while (approximate_coverage() < options.coverage_termination_threshold &&
          num_iterations < options.iteration_limit) {
     log()->info("IrisFromCliqueCover Iteration {}/{}", num_iterations + 1,
                 options.iteration_limit);
-    Eigen::MatrixXd points(domain.ambient_dimension(),
-                           num_points_per_visibility_round);
-    for (int i = 0; i < points.cols(); ++i) {
-      do {
-        last_polytope_sample =
-            domain.UniformSample(generator, last_polytope_sample);
-      } while (
-          // While the last polytope sample is in collision.
-          !checker.CheckConfigCollisionFree(last_polytope_sample) ||
-          // While the last polytope sample is in any of the sets.
-          std::any_of(sets->begin(), sets->end(),
-                      [&last_polytope_sample](const HPolyhedron& set) -> bool {
-                        return set.PointInSet(last_polytope_sample);
-                      }));
-      points.col(i) = last_polytope_sample;
+    // Sample collision-free points which are not in any of the sets. They
+    // were checked while sampling, so only their edges are checked here.
+    const int num_points_to_sample =
+        num_points_per_visibility_round -
+        incremental_visibility_graph.num_points();
+    if (num_points_to_sample > 0) {
+      incremental_visibility_graph.AddCollisionFreePoints(
+          sampler.Sample(num_points_to_sample, generator, sets),
+          max_collision_checker_parallelism);
     }
+    const Eigen::MatrixXd points = incremental_visibility_graph.points();
 
     Meshcat* meshcat = GetMeshcatFromOptions(options.iris_options);
     // Show the samples used in build cliques. Debugging visualization.
@@ -529,7 +474,7 @@ void IrisInConfigurationSpaceFromCliqueCover(
     }
 
     Eigen::SparseMatrix<bool> visibility_graph =
-        VisibilityGraph(checker, points, max_collision_checker_parallelism);
+        incremental_visibility_graph.adjacency();
     // Reserve more space for the newly built sets. Typically, we won't get
     // this worst case number of new cliques, so we only reserve half of the
     // worst case.
@@ -605,6 +550,23 @@ void IrisInConfigurationSpaceFromCliqueCover(
         "= {}",
         num_new_sets, num_iterations, ssize(*sets));
 
+    // Drop the points covered by the new sets.
+    std::vector<uint8_t> covered(points.cols(), 0x00);
+    for (int k = ssize(*sets) - num_new_sets; k < ssize(*sets); ++k) {
+      const std::vector<bool> in_set =
+          (*sets)[k].PointsInSet(points, options.point_in_set_tol);
+      for (int i = 0; i < points.cols(); ++i) {
+        covered[i] |= static_cast<uint8_t>(in_set[i]);
+      }
+    }
+    std::vector<int> covered_indices;
+    for (int i = 0; i < points.cols(); ++i) {
+      if (covered[i] > 0) {
+        covered_indices.push_back(i);
+      }
+    }
+    incremental_visibility_graph.RemovePoints(covered_indices);
+
     if (num_new_sets == 0) {
       num_points_per_visibility_round *= 2;
     }
@@ -62,7 +62,9 @@ struct IrisFromCliqueCoverOptions {
   int iteration_limit{100};
 
   /**
-   * The number of points to sample when testing coverage.
+   * The number of points to sample when testing coverage. The points are
+   * sampled once, and each coverage check after the first one only tests the
+   * points which are not covered yet against the newly added sets.
    */
   int num_points_per_coverage_check{static_cast<int>(1e3)};
 
@@ -85,7 +87,9 @@ struct IrisFromCliqueCoverOptions {
    * is less than twice the minimum clique size, it will be overridden to be at
    * least twice the minimum clique size. If the algorithm ever fails to find a
    * single clique in a visibility round, then the number of points in a
-   * visibility round will be doubled.
+   * visibility round will be doubled. The points which are not covered by the
+   * sets built in a round are kept (together with their visibility edges) for
+   * the next round, and only the missing points are sampled.
    */
   int num_points_per_visibility_round{200};
 
@@ -130,11 +134,13 @@ struct IrisFromCliqueCoverOptions {
  * If nullptr is passed as the `max_clique_solver`, then max clique will be
  * solved using an instance of MaxCliqueSolverViaGreedy, which is a fast
  * heuristic. If higher quality cliques are desired, consider changing the
- * solver to an instance of MaxCliqueSolverViaMip. Currently, the padding in the
- * collision checker is not forwarded to the algorithm, and therefore the final
- * regions do not necessarily respect this padding. Effectively, this means that
- * the regions are generated as if the padding is set to 0. This behavior may be
- * adjusted in the future at the resolution of #18830.
+ * solver to an instance of MaxCliqueSolverViaBranchAndBound (which needs no
+ * external solver, and can be given a time limit) or MaxCliqueSolverViaMip.
+ * Currently, the padding in the collision checker is not forwarded to the
+ * algorithm, and therefore the final regions do not necessarily respect this
+ * padding. Effectively, this means that the regions are generated as if the
+ * padding is set to 0. This behavior may be adjusted in the future at the
+ * resolution of #18830.
  *
  * @note that MaxCliqueSolverViaMip requires the availability of a
  * Mixed-Integer Linear Programming solver (e.g. Gurobi and/or Mosek). We
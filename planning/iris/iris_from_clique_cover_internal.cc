@@ -0,0 +1,145 @@
+#include "drake/planning/iris/iris_from_clique_cover_internal.h"
+
+#include <optional>
+
+#include <common_robotics_utilities/parallelism.hpp>
+
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace planning {
+namespace internal {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForRangeLoop;
+using common_robotics_utilities::parallelism::ThreadWorkRange;
+using geometry::optimization::HPolyhedron;
+
+CollisionFreeSampler::CollisionFreeSampler(const HPolyhedron& domain,
+                                           const CollisionChecker& checker,
+                                           int num_chains,
+                                           Parallelism parallelism)
+    : domain_(domain),
+      checker_(checker),
+      num_chains_(num_chains),
+      parallelism_(parallelism) {
+  DRAKE_THROW_UNLESS(num_chains > 0);
+  DRAKE_THROW_UNLESS(domain.ambient_dimension() ==
+                     checker.plant().num_positions());
+}
+
+Eigen::MatrixXd CollisionFreeSampler::Sample(
+    int num_samples, RandomGenerator* generator,
+    const std::vector<HPolyhedron>* excluded_sets) {
+  DRAKE_THROW_UNLESS(num_samples >= 0);
+  DRAKE_THROW_UNLESS(generator != nullptr);
+  if (chains_.cols() == 0) {
+    chains_ = domain_.UniformSampleBatch(
+        generator, domain_.ChebyshevCenter().replicate(1, num_chains_),
+        kBurnInSteps, std::nullopt, 1e-8, parallelism_);
+  }
+
+  Eigen::MatrixXd samples(domain_.ambient_dimension(), num_samples);
+  int num_accepted = 0;
+  std::vector<Eigen::VectorXd> candidates(num_chains_);
+  while (num_accepted < num_samples) {
+    chains_ = domain_.UniformSampleBatch(generator, chains_, kMixingSteps,
+                                         std::nullopt, 1e-8, parallelism_);
+    for (int i = 0; i < num_chains_; ++i) {
+      candidates[i] = chains_.col(i);
+    }
+    std::vector<uint8_t> accepted =
+        checker_.CheckConfigsCollisionFree(candidates, parallelism_);
+    if (excluded_sets != nullptr) {
+      for (const HPolyhedron& set : *excluded_sets) {
+        const std::vector<bool> in_set = set.PointsInSet(chains_);
+        for (int i = 0; i < num_chains_; ++i) {
+          accepted[i] = accepted[i] && !in_set[i];
+        }
+      }
+    }
+    for (int i = 0; i < num_chains_ && num_accepted < num_samples; ++i) {
+      if (accepted[i]) {
+        samples.col(num_accepted++) = chains_.col(i);
+      }
+    }
+  }
+  return samples;
+}
+
+IncrementalCoverageEstimator::IncrementalCoverageEstimator(
+    int num_samples, double point_in_set_tol)
+    : num_samples_(num_samples), point_in_set_tol_(point_in_set_tol) {
+  DRAKE_THROW_UNLESS(num_samples >= 0);
+}
+
+double IncrementalCoverageEstimator::Update(
+    const std::vector<HPolyhedron>& sets, Parallelism parallelism,
+    CollisionFreeSampler* sampler, RandomGenerator* generator) {
+  DRAKE_DEMAND(ssize(sets) >= num_sets_checked_);
+  if (sets.empty()) {
+    log()->info("Current Fraction of Domain Covered = 0");
+    // Fail fast if there is nothing to check.
+    return 0.0;
+  }
+  if (samples_.cols() == 0 && num_samples_ > 0) {
+    samples_ = sampler->Sample(num_samples_, generator);
+    uncovered_.resize(num_samples_);
+    for (int i = 0; i < num_samples_; ++i) {
+      uncovered_[i] = i;
+    }
+  }
+
+  std::vector<uint8_t> covered(uncovered_.size(), 0);
+  const auto check_range = [&](const ThreadWorkRange& range) {
+    // The indices (into uncovered_) of the points of this range which are not
+    // in any of the new sets checked so far.
+    std::vector<int> remaining;
+    for (int64_t i = range.GetRangeStart(); i < range.GetRangeEnd(); ++i) {
+      remaining.push_back(i);
+    }
+    Eigen::MatrixXd points;
+    for (int k = num_sets_checked_; k < ssize(sets) && !remaining.empty();
+         ++k) {
+      points.resize(samples_.rows(), ssize(remaining));
+      for (int j = 0; j < ssize(remaining); ++j) {
+        points.col(j) = samples_.col(uncovered_[remaining[j]]);
+      }
+      const std::vector<bool> in_set =
+          sets[k].PointsInSet(points, point_in_set_tol_);
+      int num_remaining = 0;
+      for (int j = 0; j < ssize(remaining); ++j) {
+        if (in_set[j]) {
+          covered[remaining[j]] = 1;
+        } else {
+          remaining[num_remaining++] = remaining[j];
+        }
+      }
+      remaining.resize(num_remaining);
+    }
+  };
+  StaticParallelForRangeLoop(DegreeOfParallelism(parallelism.num_threads()), 0,
+                             ssize(uncovered_), check_range,
+                             ParallelForBackend::BEST_AVAILABLE);
+  num_sets_checked_ = ssize(sets);
+
+  int num_uncovered = 0;
+  for (int i = 0; i < ssize(uncovered_); ++i) {
+    if (!covered[i]) {
+      uncovered_[num_uncovered++] = uncovered_[i];
+    }
+  }
+  uncovered_.resize(num_uncovered);
+
+  const double fraction_covered =
+      num_samples_ > 0
+          ? static_cast<double>(num_samples_ - num_uncovered) / num_samples_
+          : 0.0;
+  log()->debug("Current Fraction of Domain Covered = {}", fraction_covered);
+  return fraction_covered;
+}
+
+}  // namespace internal
+}  // namespace planning
+}  // namespace drake
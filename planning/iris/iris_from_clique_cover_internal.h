@@ -0,0 +1,110 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/common/random.h"
+#include "drake/geometry/optimization/hpolyhedron.h"
+#include "drake/planning/collision_checker.h"
+
+namespace drake {
+namespace planning {
+namespace internal {
+
+// Draws collision-free samples uniformly at random from a domain, by running a
+// fixed number of hit-and-run chains which persist across calls to Sample().
+//
+// On the first call to Sample(), every chain is burned in from the Chebyshev
+// center of the domain with its own randomness, so that the chains start from
+// distinct, well-mixed points. Each call afterwards only advances the chains.
+// The chains are advanced together by HPolyhedron::UniformSampleBatch(), and
+// each batch of candidates (one per chain) is collision checked in parallel.
+class CollisionFreeSampler {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CollisionFreeSampler);
+
+  // The number of hit-and-run steps used to burn in the chains.
+  static constexpr int kBurnInSteps = 100;
+
+  // The number of hit-and-run steps between two candidates of a chain; this is
+  // the default of HPolyhedron::UniformSample().
+  static constexpr int kMixingSteps = 10;
+
+  // Constructs a sampler of `domain` with `num_chains` chains. Both the chains
+  // and the collision checks are run with the degree of parallelism determined
+  // by `parallelism`. The `domain` and `checker` are aliased, and must outlive
+  // this object.
+  // @pre num_chains > 0.
+  CollisionFreeSampler(const geometry::optimization::HPolyhedron& domain,
+                       const CollisionChecker& checker, int num_chains,
+                       Parallelism parallelism);
+
+  // Returns `num_samples` collision-free samples, one per column. Samples that
+  // lie in any of the `excluded_sets` (if given) are rejected as well. The
+  // `generator` is the source of randomness for the chains.
+  Eigen::MatrixXd Sample(
+      int num_samples, RandomGenerator* generator,
+      const std::vector<geometry::optimization::HPolyhedron>* excluded_sets =
+          nullptr);
+
+  int num_chains() const { return num_chains_; }
+
+  // Returns the current state of the chains, one per column. This is empty
+  // until the first call to Sample().
+  const Eigen::MatrixXd& chains() const { return chains_; }
+
+ private:
+  const geometry::optimization::HPolyhedron& domain_;
+  const CollisionChecker& checker_;
+  const int num_chains_;
+  const Parallelism parallelism_;
+  Eigen::MatrixXd chains_;
+};
+
+// Approximately computes the fraction of a domain covered by a growing list of
+// sets, by drawing collision-free points uniformly at random in the domain and
+// checking whether each point lies in one of the sets.
+//
+// The points are drawn once, by the first call to Update() with a non-empty
+// list of sets, and are reused afterwards. Each Update() then only checks the
+// points which are not covered yet against the sets added since the previous
+// call, so that the cost of an update does not grow with the number of sets
+// that were already checked.
+class IncrementalCoverageEstimator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IncrementalCoverageEstimator);
+
+  // Constructs an estimator which draws `num_samples` points, and checks them
+  // for inclusion in the sets with the tolerance `point_in_set_tol`.
+  IncrementalCoverageEstimator(int num_samples, double point_in_set_tol);
+
+  // Returns the estimated fraction of the domain of `sampler` covered by
+  // `sets`, which must extend the `sets` of the previous call. The `sampler`
+  // and `generator` are used to draw the points on the first call. The points
+  // are checked for inclusion in the new sets in parallel, with the degree of
+  // parallelism determined by `parallelism`.
+  double Update(const std::vector<geometry::optimization::HPolyhedron>& sets,
+                Parallelism parallelism, CollisionFreeSampler* sampler,
+                RandomGenerator* generator);
+
+  // Returns the sampled points, one per column. This is empty until the first
+  // call to Update() with a non-empty list of sets.
+  const Eigen::MatrixXd& samples() const { return samples_; }
+
+ private:
+  const int num_samples_;
+  const double point_in_set_tol_;
+  // The sampled points, one per column.
+  Eigen::MatrixXd samples_;
+  // The indices of the sampled points which are not in any checked set.
+  std::vector<int> uncovered_;
+  // The number of sets, from the start of the list, already checked.
+  int num_sets_checked_{0};
+};
+
+}  // namespace internal
+}  // namespace planning
+}  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/planning/iris/iris_zo.h"
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -10,6 +11,7 @@
 #include "drake/common/text_logging.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
 #include "drake/geometry/optimization/vpolytope.h"
+#include "drake/planning/iris/sphere_collision_prefilter.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/clarabel_solver.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -109,6 +111,12 @@ HPolyhedron IrisZo(const planning::CollisionChecker& checker,
   // TODO(cohnt): Allow users to set this parameter if it ever becomes needed.
   const double constraints_tol = 1e-6;
 
+  std::unique_ptr<internal::SphereCollisionPrefilter> sphere_prefilter;
+  if (options.use_sphere_prefilter) {
+    sphere_prefilter =
+        std::make_unique<internal::SphereCollisionPrefilter>(checker);
+  }
+
   const Eigen::VectorXd starting_ellipsoid_center_ambient =
       options.parameterization.get_parameterization_double()(
           starting_ellipsoid_center);
@@ -275,9 +283,14 @@ HPolyhedron IrisZo(const planning::CollisionChecker& checker,
       }
 
       // Find all particles in collision.
+      const Parallelism collision_parallelism =
+          options.sampled_iris_options.parallelism;
       std::vector<uint8_t> particle_col_free =
-          checker.CheckConfigsCollisionFree(
-              ambient_particles, options.sampled_iris_options.parallelism);
+          sphere_prefilter != nullptr
+              ? sphere_prefilter->CheckConfigsCollisionFree(
+                    ambient_particles, collision_parallelism)
+              : checker.CheckConfigsCollisionFree(ambient_particles,
+                                                  collision_parallelism);
       std::vector<uint8_t> particle_satisfies_additional_constraints =
           internal::CheckProgConstraintsParallel(
               options.sampled_iris_options.prog_with_additional_constraints,
@@ -30,6 +30,7 @@ class IrisZoOptions {
   void Serialize(Archive* a) {
     a->Visit(DRAKE_NVP(sampled_iris_options));
     a->Visit(DRAKE_NVP(bisection_steps));
+    a->Visit(DRAKE_NVP(use_sphere_prefilter));
   }
 
   IrisZoOptions() = default;
@@ -40,6 +41,16 @@ class IrisZoOptions {
   /** Maximum number of bisection steps. */
   int bisection_steps{10};
 
+  /** If true, the particles are first checked for collisions against bounding
+   * spheres of the collision geometries, and only the particles which the
+   * spheres do not certify as collision free are checked exactly. Since most
+   * particles are far from the obstacles, this is typically much faster. The
+   * result only differs from the exact check for particles that are in
+   * collision by less than 1e-5 (measured in the task space). This requires
+   * the checker to be a SceneGraphCollisionChecker; IrisZo throws otherwise.
+   */
+  bool use_sphere_prefilter{false};
+
   /** Parameterization of the subspace along which to grow the region. Default
    * is the identity parameterization, corresponding to growing regions in the
    * ordinary configuration space. */
@@ -0,0 +1,303 @@
+#include "drake/planning/iris/sphere_collision_prefilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+
+#include <common_robotics_utilities/parallelism.hpp>
+#include <fmt/format.h>
+
+#include "drake/common/nice_type_name.h"
+#include "drake/common/overloaded.h"
+#include "drake/geometry/proximity/polygon_surface_mesh.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/planning/scene_graph_collision_checker.h"
+
+namespace drake {
+namespace planning {
+namespace internal {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
+using Eigen::Vector3d;
+using geometry::Box;
+using geometry::Capsule;
+using geometry::Convex;
+using geometry::Cylinder;
+using geometry::Ellipsoid;
+using geometry::GeometryId;
+using geometry::HalfSpace;
+using geometry::Mesh;
+using geometry::MeshcatCone;
+using geometry::PolygonSurfaceMesh;
+using geometry::QueryObject;
+using geometry::Role;
+using geometry::SceneGraphInspector;
+using geometry::Shape;
+using geometry::SignedDistancePair;
+using geometry::SignedDistanceToPoint;
+using geometry::Sphere;
+using multibody::BodyIndex;
+using multibody::RigidBody;
+
+namespace {
+
+struct BoundingSphere {
+  Vector3d p_GS;
+  double radius{};
+};
+
+struct ShapeBound {
+  // The bounding sphere, or nullopt if the shape is unbounded.
+  std::optional<BoundingSphere> sphere;
+  // Whether the distance to a point reported by
+  // QueryObject::ComputeSignedDistanceToPoint() is accurate for the shape as
+  // the pairwise distance queries see it. This is not the case for an
+  // Ellipsoid (the point query is iterative and inexact) or a Mesh (the point
+  // query measures the mesh surface, the pairwise queries its convex hull).
+  bool exact_point_distance{true};
+};
+
+BoundingSphere BoundVertices(const PolygonSurfaceMesh<double>& mesh) {
+  Vector3d lower = mesh.vertex(0);
+  Vector3d upper = mesh.vertex(0);
+  for (int v = 1; v < mesh.num_vertices(); ++v) {
+    lower = lower.cwiseMin(mesh.vertex(v));
+    upper = upper.cwiseMax(mesh.vertex(v));
+  }
+  const Vector3d center = 0.5 * (lower + upper);
+  double radius = 0;
+  for (int v = 0; v < mesh.num_vertices(); ++v) {
+    radius = std::max(radius, (mesh.vertex(v) - center).norm());
+  }
+  return {center, radius};
+}
+
+ShapeBound CalcShapeBound(const Shape& shape) {
+  const Vector3d origin = Vector3d::Zero();
+  return shape.Visit<ShapeBound>(overloaded{
+      [&](const Box& box) {
+        return ShapeBound{BoundingSphere{origin, 0.5 * box.size().norm()}};
+      },
+      [&](const Capsule& capsule) {
+        return ShapeBound{BoundingSphere{
+            origin, capsule.radius() + 0.5 * capsule.length()}};
+      },
+      [](const Convex& convex) {
+        return ShapeBound{BoundVertices(convex.GetConvexHull())};
+      },
+      [&](const Cylinder& cylinder) {
+        return ShapeBound{BoundingSphere{
+            origin, std::hypot(cylinder.radius(), 0.5 * cylinder.length())}};
+      },
+      [&](const Ellipsoid& ellipsoid) {
+        return ShapeBound{
+            BoundingSphere{origin, std::max({ellipsoid.a(), ellipsoid.b(),
+                                             ellipsoid.c()})},
+            false};
+      },
+      [](const HalfSpace&) { return ShapeBound{}; },
+      [](const Mesh& mesh) {
+        return ShapeBound{BoundVertices(mesh.GetConvexHull()), false};
+      },
+      [](const MeshcatCone& cone) {
+        // The apex is at the origin, and the elliptical base at z = height.
+        const double half_height = 0.5 * cone.height();
+        const double base_radius = std::max(cone.a(), cone.b());
+        return ShapeBound{
+            BoundingSphere{Vector3d(0, 0, half_height),
+                           std::hypot(half_height, base_radius)},
+            false};
+      },
+      [&](const Sphere& sphere) {
+        return ShapeBound{BoundingSphere{origin, sphere.radius()}};
+      }});
+}
+
+}  // namespace
+
+SphereCollisionPrefilter::SphereCollisionPrefilter(
+    const CollisionChecker& checker)
+    : checker_(checker) {
+  if (dynamic_cast<const SceneGraphCollisionChecker*>(&checker) == nullptr) {
+    throw std::logic_error(fmt::format(
+        "SphereCollisionPrefilter requires a SceneGraphCollisionChecker, but "
+        "was given a {}.",
+        NiceTypeName::Get(checker)));
+  }
+  const SceneGraphInspector<double>& inspector =
+      checker.model().scene_graph().model_inspector();
+  std::vector<BoundedGeometry> environment_spheres;
+  for (const GeometryId id : inspector.GetAllGeometryIds(Role::kProximity)) {
+    const RigidBody<double>* body =
+        checker.plant().GetBodyFromFrameId(inspector.GetFrameId(id));
+    if (body == nullptr) {
+      // The exact check rejects geometries that do not belong to the plant.
+      enabled_ = false;
+      continue;
+    }
+    const ShapeBound bound = CalcShapeBound(inspector.GetShape(id));
+    if (checker.IsPartOfRobot(*body)) {
+      if (!bound.sphere.has_value()) {
+        enabled_ = false;
+        continue;
+      }
+      spheres_.push_back({id, body->index(), bound.sphere->p_GS,
+                          bound.sphere->radius});
+    } else if (bound.exact_point_distance) {
+      point_query_bodies_.emplace(id, body->index());
+    } else {
+      DRAKE_DEMAND(bound.sphere.has_value());
+      environment_spheres.push_back({id, body->index(), bound.sphere->p_GS,
+                                     bound.sphere->radius});
+    }
+  }
+  num_robot_spheres_ = ssize(spheres_);
+  spheres_.insert(spheres_.end(), environment_spheres.begin(),
+                  environment_spheres.end());
+
+  std::vector<int> pair_a;
+  std::vector<int> pair_b;
+  std::vector<double> pair_clearance;
+  for (int a = 0; a < num_robot_spheres_; ++a) {
+    for (int b = a + 1; b < ssize(spheres_); ++b) {
+      const BodyIndex body_a = spheres_[a].body;
+      const BodyIndex body_b = spheres_[b].body;
+      if (body_a == body_b ||
+          checker.IsCollisionFilteredBetween(body_a, body_b)) {
+        continue;
+      }
+      const double clearance =
+          std::max(0.0, spheres_[a].radius + spheres_[b].radius +
+                            checker.GetPaddingBetween(body_a, body_b) +
+                            kMargin);
+      pair_a.push_back(a);
+      pair_b.push_back(b);
+      pair_clearance.push_back(clearance * clearance);
+    }
+  }
+  pair_a_ = Eigen::Map<const Eigen::ArrayXi>(pair_a.data(), ssize(pair_a));
+  pair_b_ = Eigen::Map<const Eigen::ArrayXi>(pair_b.data(), ssize(pair_b));
+  pair_clearance_ = Eigen::Map<const Eigen::ArrayXd>(pair_clearance.data(),
+                                                     ssize(pair_clearance));
+}
+
+SphereCollisionPrefilter::~SphereCollisionPrefilter() = default;
+
+std::vector<uint8_t> SphereCollisionPrefilter::CheckConfigsCollisionFree(
+    const std::vector<Eigen::VectorXd>& configs,
+    const Parallelism parallelism) const {
+  // Note: vector<uint8_t> is used since vector<bool> is not thread safe.
+  std::vector<uint8_t> collision_checks(configs.size(), 0);
+
+  const int number_of_threads =
+      checker_.SupportsParallelChecking() && parallelism.num_threads() > 1
+          ? std::min(checker_.num_allocated_contexts(),
+                     parallelism.num_threads())
+          : 1;
+
+  // The positions are updated once, and shared by the sphere tests and (if
+  // they are inconclusive) the exact check.
+  const auto config_work = [&](const int thread_num, const int64_t index) {
+    checker_.UpdatePositions(configs.at(index), thread_num);
+    const QueryObject<double>& query_object =
+        checker_.model_context(thread_num).GetQueryObject();
+    collision_checks.at(index) =
+        CertifyPosedConfigCollisionFree(query_object) ||
+        CheckPosedConfigCollisionFree(query_object);
+  };
+
+  StaticParallelForIndexLoop(DegreeOfParallelism(number_of_threads), 0,
+                             configs.size(), config_work,
+                             ParallelForBackend::BEST_AVAILABLE);
+
+  return collision_checks;
+}
+
+bool SphereCollisionPrefilter::CertifyConfigCollisionFree(
+    const Eigen::VectorXd& q, const int context_number) const {
+  if (!enabled_) {
+    return false;
+  }
+  checker_.UpdatePositions(q, context_number);
+  return CertifyPosedConfigCollisionFree(
+      checker_.model_context(context_number).GetQueryObject());
+}
+
+bool SphereCollisionPrefilter::CertifyPosedConfigCollisionFree(
+    const QueryObject<double>& query_object) const {
+  if (!enabled_) {
+    return false;
+  }
+  Eigen::Matrix3Xd p_WS(3, ssize(spheres_));
+  for (int s = 0; s < ssize(spheres_); ++s) {
+    p_WS.col(s) =
+        query_object.GetPoseInWorld(spheres_[s].id) * spheres_[s].p_GS;
+  }
+
+  // Test all of the sphere pairs at once.
+  if (pair_a_.size() > 0) {
+    const Eigen::Matrix3Xd p_AB =
+        p_WS(eigen_all, pair_a_) - p_WS(eigen_all, pair_b_);
+    if (!(p_AB.colwise().squaredNorm().transpose().array() > pair_clearance_)
+             .all()) {
+      return false;
+    }
+  }
+
+  // Test the robot spheres against the rest of the environment. The distance
+  // from a sphere to a geometry is at least the distance from its center minus
+  // its radius.
+  const double largest_padding = checker_.GetLargestPadding();
+  for (int s = 0; s < num_robot_spheres_; ++s) {
+    const BoundedGeometry& sphere = spheres_[s];
+    const std::vector<SignedDistanceToPoint<double>> distances =
+        query_object.ComputeSignedDistanceToPoint(
+            p_WS.col(s), sphere.radius + largest_padding + kMargin);
+    for (const SignedDistanceToPoint<double>& distance : distances) {
+      const auto it = point_query_bodies_.find(distance.id_G);
+      if (it == point_query_bodies_.end()) {
+        // A robot geometry, or an environment geometry bounded by a sphere.
+        continue;
+      }
+      const BodyIndex body = it->second;
+      if (checker_.IsCollisionFilteredBetween(sphere.body, body)) {
+        continue;
+      }
+      if (distance.distance - sphere.radius <=
+          checker_.GetPaddingBetween(sphere.body, body) + kMargin) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SphereCollisionPrefilter::CheckPosedConfigCollisionFree(
+    const QueryObject<double>& query_object) const {
+  // This mirrors SceneGraphCollisionChecker::CheckConfigCollisionFree(),
+  // without updating the positions again.
+  const SceneGraphInspector<double>& inspector = query_object.inspector();
+  const std::vector<SignedDistancePair<double>> distance_pairs =
+      query_object.ComputeSignedDistancePairwiseClosestPoints(
+          checker_.GetLargestPadding());
+  for (const SignedDistancePair<double>& distance_pair : distance_pairs) {
+    const RigidBody<double>* body_A = checker_.plant().GetBodyFromFrameId(
+        inspector.GetFrameId(distance_pair.id_A));
+    const RigidBody<double>* body_B = checker_.plant().GetBodyFromFrameId(
+        inspector.GetFrameId(distance_pair.id_B));
+    DRAKE_THROW_UNLESS(body_A != nullptr);
+    DRAKE_THROW_UNLESS(body_B != nullptr);
+    const double padding = checker_.GetPaddingBetween(*body_A, *body_B);
+    if (distance_pair.distance <= padding) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/query_object.h"
+#include "drake/multibody/tree/multibody_tree_indexes.h"
+#include "drake/planning/collision_checker.h"
+
+namespace drake {
+namespace planning {
+namespace internal {
+
+/* Checks configurations for collisions in batches, answering most of the
+queries with cheap bounding sphere tests and deferring to the exact check of
+the collision checker for the rest.
+
+Every collision geometry of the robot is bounded by a sphere in its geometry
+frame. For a configuration q, the sphere centers are posed in the world and:
+
+ - each pair of spheres (on different robot bodies, not filtered) is tested
+   against the sum of their radii and the padding between their bodies, using
+   vectorized Eigen array operations over all pairs at once;
+ - each sphere center is tested against the environment with
+   QueryObject::ComputeSignedDistanceToPoint(), which prunes the distant
+   geometries with the broadphase of SceneGraph. Environment geometries whose
+   point distance is not a conservative bound on their distance to a robot
+   geometry (Ellipsoid and Mesh) are bounded by spheres as well.
+
+If all of the tests clear q by more than a small margin, q is reported as
+collision free. Otherwise, the exact check decides. Therefore the result only
+differs from checker.CheckConfigsCollisionFree() for configurations that are
+in collision by less than that margin (typically a fraction of the error of
+the exact distance queries).
+
+Each geometry is bounded by a single sphere. This is tight for spheres and
+reasonable for compact shapes, but loose for elongated ones (e.g., a long
+capsule or a thin box), whose configurations near obstacles then fall back to
+the exact check more often than a decomposition into several spheres would.
+
+This requires the checker to be a SceneGraphCollisionChecker, whose notion of
+collision (distance less than or equal to the padding) the tests mirror. */
+class SphereCollisionPrefilter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SphereCollisionPrefilter);
+
+  /* The margin by which the sphere tests must clear a configuration. */
+  static constexpr double kMargin = 1e-5;
+
+  /* Precomputes the bounding spheres of the geometries of `checker`. The
+  checker is aliased and must outlive this.
+  @throws std::exception if `checker` is not a SceneGraphCollisionChecker. */
+  explicit SphereCollisionPrefilter(const CollisionChecker& checker);
+
+  ~SphereCollisionPrefilter();
+
+  /* Returns 1 for the configurations that are collision free and 0 for the
+  others, with the same semantics (and threading) as
+  CollisionChecker::CheckConfigsCollisionFree(). */
+  std::vector<uint8_t> CheckConfigsCollisionFree(
+      const std::vector<Eigen::VectorXd>& configs,
+      Parallelism parallelism = Parallelism::Max()) const;
+
+  /* Returns true if the sphere tests alone certify that `q` is collision free,
+  using the implicit context `context_number` of the checker. A false result
+  is inconclusive. */
+  bool CertifyConfigCollisionFree(const Eigen::VectorXd& q,
+                                  int context_number) const;
+
+  /* Returns the number of robot geometries bounded by a sphere. */
+  int num_robot_spheres() const { return num_robot_spheres_; }
+
+  /* Returns the number of environment geometries bounded by a sphere. */
+  int num_environment_spheres() const {
+    return ssize(spheres_) - num_robot_spheres_;
+  }
+
+  /* Returns false if some robot geometry (e.g., a HalfSpace) has no bounding
+  sphere, in which case every configuration is checked exactly. */
+  bool enabled() const { return enabled_; }
+
+ private:
+  // The implementations of CertifyConfigCollisionFree() and of the exact check
+  // for a configuration whose positions have already been updated, i.e., whose
+  // geometry poses are reported by `query_object`.
+  bool CertifyPosedConfigCollisionFree(
+      const geometry::QueryObject<double>& query_object) const;
+  bool CheckPosedConfigCollisionFree(
+      const geometry::QueryObject<double>& query_object) const;
+
+  // A collision geometry bounded by the sphere of the given radius, centered
+  // at p_GS in the geometry frame G.
+  struct BoundedGeometry {
+    geometry::GeometryId id;
+    multibody::BodyIndex body;
+    Eigen::Vector3d p_GS;
+    double radius{};
+  };
+
+  const CollisionChecker& checker_;
+  bool enabled_{true};
+  // The robot spheres, followed by the environment spheres.
+  std::vector<BoundedGeometry> spheres_;
+  int num_robot_spheres_{};
+  // The bodies of the environment geometries that are not bounded by spheres,
+  // i.e., the geometries checked by point queries.
+  std::unordered_map<geometry::GeometryId, multibody::BodyIndex>
+      point_query_bodies_;
+  // The pairs of spheres (indices into spheres_) which can collide, i.e., the
+  // pairs of robot spheres on different bodies and the pairs of a robot sphere
+  // and an environment sphere, whose bodies are not filtered. They are clear
+  // when the squared distance between their centers exceeds pair_clearance_.
+  Eigen::ArrayXi pair_a_;
+  Eigen::ArrayXi pair_b_;
+  Eigen::ArrayXd pair_clearance_;
+};
+
+}  // namespace internal
+}  // namespace planning
+}  // namespace drake
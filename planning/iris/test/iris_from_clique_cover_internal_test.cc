@@ -0,0 +1,188 @@
+#include "drake/planning/iris/iris_from_clique_cover_internal.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/planning/robot_diagram_builder.h"
+#include "drake/planning/scene_graph_collision_checker.h"
+
+namespace drake {
+namespace planning {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+using geometry::optimization::HPolyhedron;
+
+/* A movable sphere in a box, around a fixed box obstacle at the origin.
+┌───────────────┐
+│               │
+│     ┌───┐     │
+│  o  │   │     │
+│     └───┘     │
+│               │
+└───────────────┘ */
+const char kBoxWithObstacle[] = R"""(
+<robot name="boxes">
+  <link name="obstacle">
+    <collision name="box">
+      <geometry><box size="1 1 1"/></geometry>
+    </collision>
+  </link>
+  <joint name="obstacle_weld" type="fixed">
+    <parent link="world"/>
+    <child link="obstacle"/>
+  </joint>
+  <link name="movable">
+    <collision name="sphere">
+      <geometry><sphere radius="0.1"/></geometry>
+    </collision>
+  </link>
+  <link name="for_joint"/>
+  <joint name="x" type="prismatic">
+    <axis xyz="1 0 0"/>
+    <limit lower="-2" upper="2"/>
+    <parent link="world"/>
+    <child link="for_joint"/>
+  </joint>
+  <joint name="y" type="prismatic">
+    <axis xyz="0 1 0"/>
+    <limit lower="-2" upper="2"/>
+    <parent link="for_joint"/>
+    <child link="movable"/>
+  </joint>
+</robot>
+)""";
+
+class IrisFromCliqueCoverInternalTest : public ::testing::Test {
+ protected:
+  IrisFromCliqueCoverInternalTest() {
+    CollisionCheckerParams params;
+    RobotDiagramBuilder<double> builder(0.0);
+    params.robot_model_instances =
+        builder.parser().AddModelsFromString(kBoxWithObstacle, "urdf");
+    params.model = builder.Build();
+    params.edge_step_size = 0.01;
+    checker_ = std::make_unique<SceneGraphCollisionChecker>(std::move(params));
+  }
+
+  const HPolyhedron domain_{
+      HPolyhedron::MakeBox(Vector2d(-2, -2), Vector2d(2, 2))};
+  // The halves of the domain, on either side of x = 0. By symmetry, each one
+  // holds half of the collision-free space.
+  const HPolyhedron left_{
+      HPolyhedron::MakeBox(Vector2d(-2, -2), Vector2d(0, 2))};
+  const HPolyhedron right_{
+      HPolyhedron::MakeBox(Vector2d(0, -2), Vector2d(2, 2))};
+  std::unique_ptr<SceneGraphCollisionChecker> checker_;
+};
+
+TEST_F(IrisFromCliqueCoverInternalTest, CollisionFreeSampler) {
+  CollisionFreeSampler dut(domain_, *checker_, 8, Parallelism(2));
+  EXPECT_EQ(dut.num_chains(), 8);
+  EXPECT_EQ(dut.chains().cols(), 0);
+
+  RandomGenerator generator(1234);
+  const int num_samples = 400;
+  const MatrixXd samples = dut.Sample(num_samples, &generator);
+  ASSERT_EQ(samples.rows(), 2);
+  ASSERT_EQ(samples.cols(), num_samples);
+  int num_left = 0;
+  int num_below = 0;
+  for (int i = 0; i < num_samples; ++i) {
+    EXPECT_TRUE(domain_.PointInSet(samples.col(i)));
+    EXPECT_TRUE(checker_->CheckConfigCollisionFree(samples.col(i)));
+    num_left += samples(0, i) < 0;
+    num_below += samples(1, i) < 0;
+  }
+  // The samples are spread over the whole domain, rather than clustered
+  // around the start of the chains.
+  EXPECT_NEAR(static_cast<double>(num_left) / num_samples, 0.5, 0.15);
+  EXPECT_NEAR(static_cast<double>(num_below) / num_samples, 0.5, 0.15);
+
+  // The chains were burned in to distinct points, and later calls continue
+  // them rather than restarting them from a common point.
+  for (int call = 0; call < 3; ++call) {
+    const MatrixXd previous_chains = dut.chains();
+    ASSERT_EQ(previous_chains.cols(), dut.num_chains());
+    dut.Sample(1, &generator);
+    for (int i = 0; i < dut.num_chains(); ++i) {
+      EXPECT_FALSE(
+          CompareMatrices(dut.chains().col(i), previous_chains.col(i), 1e-7));
+      for (int j = i + 1; j < dut.num_chains(); ++j) {
+        EXPECT_FALSE(
+            CompareMatrices(dut.chains().col(i), dut.chains().col(j), 1e-7));
+      }
+    }
+  }
+
+  // Samples in the excluded sets are rejected.
+  const std::vector<HPolyhedron> excluded{right_};
+  const MatrixXd left_samples = dut.Sample(50, &generator, &excluded);
+  for (int i = 0; i < left_samples.cols(); ++i) {
+    EXPECT_FALSE(right_.PointInSet(left_samples.col(i)));
+    EXPECT_TRUE(checker_->CheckConfigCollisionFree(left_samples.col(i)));
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      CollisionFreeSampler(domain_, *checker_, 0, Parallelism(2)),
+      ".*num_chains > 0.*");
+}
+
+TEST_F(IrisFromCliqueCoverInternalTest, IncrementalCoverageEstimator) {
+  CollisionFreeSampler sampler(domain_, *checker_, 8, Parallelism(2));
+  const int num_samples = 500;
+  IncrementalCoverageEstimator dut(num_samples, 1e-6);
+  RandomGenerator generator(1234);
+
+  // Without any sets, nothing is covered and nothing is sampled yet.
+  std::vector<HPolyhedron> sets;
+  EXPECT_EQ(dut.Update(sets, Parallelism(2), &sampler, &generator), 0.0);
+  EXPECT_EQ(dut.samples().cols(), 0);
+
+  // Returns the fraction of the samples in any of the sets.
+  auto count_covered = [&]() {
+    int num_covered = 0;
+    for (int i = 0; i < num_samples; ++i) {
+      for (const HPolyhedron& set : sets) {
+        if (set.PointInSet(dut.samples().col(i), 1e-6)) {
+          ++num_covered;
+          break;
+        }
+      }
+    }
+    return static_cast<double>(num_covered) / num_samples;
+  };
+
+  // Half of the collision-free space is covered by the left half of the
+  // domain.
+  sets.push_back(left_);
+  const double coverage =
+      dut.Update(sets, Parallelism(2), &sampler, &generator);
+  EXPECT_EQ(dut.samples().cols(), num_samples);
+  EXPECT_EQ(coverage, count_covered());
+  EXPECT_NEAR(coverage, 0.5, 0.1);
+
+  // The samples are kept, and only the new sets are checked.
+  const MatrixXd samples = dut.samples();
+  sets.push_back(HPolyhedron::MakeBox(Vector2d(0, 0), Vector2d(2, 2)));
+  const double more_coverage =
+      dut.Update(sets, Parallelism(2), &sampler, &generator);
+  EXPECT_TRUE(CompareMatrices(dut.samples(), samples));
+  EXPECT_EQ(more_coverage, count_covered());
+  EXPECT_NEAR(more_coverage, 0.75, 0.1);
+
+  sets.push_back(right_);
+  EXPECT_EQ(dut.Update(sets, Parallelism(2), &sampler, &generator), 1.0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace planning
+}  // namespace drake
@@ -9,6 +9,7 @@
 
 #include "drake/common/find_resource.h"
 #include "drake/common/symbolic/expression.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/maybe_pause_for_user.h"
 #include "drake/common/text_logging.h"
@@ -83,8 +84,10 @@ GTEST_TEST(IrisZoOptionsTest, Serialize) {
   EXPECT_EQ(deserialized.sampled_iris_options.sample_particles_in_parallel,
             options.sampled_iris_options.sample_particles_in_parallel);
 
-  // The non-built-in types are not serialized.
   EXPECT_EQ(deserialized.bisection_steps, options.bisection_steps);
+  EXPECT_EQ(deserialized.use_sphere_prefilter, options.use_sphere_prefilter);
+
+  // The non-built-in types are not serialized.
   EXPECT_EQ(deserialized.sampled_iris_options.meshcat, nullptr);
   EXPECT_EQ(deserialized.sampled_iris_options.prog_with_additional_constraints,
             nullptr);
@@ -218,6 +221,21 @@ TEST_F(DoublePendulum, IrisZoTest) {
   EXPECT_FALSE(region.A().isApprox(region2.A(), 1e-10));
 }
 
+// Checking the particles against bounding spheres first does not change the
+// region.
+TEST_F(DoublePendulum, SpherePrefilter) {
+  IrisZoOptions options;
+  const HPolyhedron region =
+      IrisZo(*checker_, starting_ellipsoid_, domain_, options);
+
+  options.use_sphere_prefilter = true;
+  const HPolyhedron prefiltered_region =
+      IrisZo(*checker_, starting_ellipsoid_, domain_, options);
+  CheckRegion(prefiltered_region);
+  EXPECT_TRUE(CompareMatrices(prefiltered_region.A(), region.A(), 1e-10));
+  EXPECT_TRUE(CompareMatrices(prefiltered_region.b(), region.b(), 1e-10));
+}
+
 TEST_F(DoublePendulum, PostprocessRemoveCollisions) {
   IrisZoOptions options;
 
@@ -0,0 +1,153 @@
+#include "drake/planning/iris/sphere_collision_prefilter.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/random.h"
+#include "drake/planning/robot_diagram_builder.h"
+#include "drake/planning/scene_graph_collision_checker.h"
+
+namespace drake {
+namespace planning {
+namespace internal {
+namespace {
+
+// A planar arm of three links with a mix of shapes, among obstacles of every
+// kind that the prefilter treats differently (boxes and capsules are checked
+// by point queries, ellipsoids by bounding spheres).
+const char kArmUrdf[] = R"(
+<robot name="arm">
+  <link name="obstacles">
+    <collision name="box">
+      <origin xyz="1.6 0 0.4"/>
+      <geometry><box size="0.4 0.4 0.4"/></geometry>
+    </collision>
+    <collision name="capsule">
+      <origin xyz="-1.2 0 1.2"/>
+      <geometry><drake:capsule radius="0.15" length="0.6"/></geometry>
+    </collision>
+    <collision name="ellipsoid">
+      <origin xyz="0.2 0 -1.7"/>
+      <geometry><drake:ellipsoid a="0.5" b="0.2" c="0.2"/></geometry>
+    </collision>
+    <collision name="sphere">
+      <origin xyz="-1.4 0 -0.9"/>
+      <geometry><sphere radius="0.25"/></geometry>
+    </collision>
+  </link>
+  <joint name="obstacles_weld" type="fixed">
+    <parent link="world"/>
+    <child link="obstacles"/>
+  </joint>
+  <link name="link1">
+    <collision name="body">
+      <origin xyz="0 0 0.4"/>
+      <geometry><box size="0.1 0.1 0.8"/></geometry>
+    </collision>
+  </link>
+  <joint name="joint1" type="revolute">
+    <axis xyz="0 1 0"/>
+    <limit lower="-3.14" upper="3.14"/>
+    <parent link="world"/>
+    <child link="link1"/>
+  </joint>
+  <link name="link2">
+    <collision name="body">
+      <origin xyz="0 0 0.4"/>
+      <geometry><drake:capsule radius="0.05" length="0.7"/></geometry>
+    </collision>
+  </link>
+  <joint name="joint2" type="revolute">
+    <origin xyz="0 0 0.8"/>
+    <axis xyz="0 1 0"/>
+    <limit lower="-3.14" upper="3.14"/>
+    <parent link="link1"/>
+    <child link="link2"/>
+  </joint>
+  <link name="link3">
+    <collision name="body">
+      <origin xyz="0 0 0.3"/>
+      <geometry><cylinder radius="0.05" length="0.6"/></geometry>
+    </collision>
+    <collision name="tip">
+      <origin xyz="0 0 0.6"/>
+      <geometry><sphere radius="0.1"/></geometry>
+    </collision>
+  </link>
+  <joint name="joint3" type="revolute">
+    <origin xyz="0 0 0.8"/>
+    <axis xyz="0 1 0"/>
+    <limit lower="-3.14" upper="3.14"/>
+    <parent link="link2"/>
+    <child link="link3"/>
+  </joint>
+</robot>
+)";
+
+std::unique_ptr<SceneGraphCollisionChecker> MakeChecker(double padding) {
+  CollisionCheckerParams params;
+  RobotDiagramBuilder<double> builder(0.0);
+  params.robot_model_instances =
+      builder.parser().AddModelsFromString(kArmUrdf, "urdf");
+  builder.plant().Finalize();
+  params.model = builder.Build();
+  params.edge_step_size = 0.01;
+  params.env_collision_padding = padding;
+  params.self_collision_padding = padding;
+  return std::make_unique<SceneGraphCollisionChecker>(std::move(params));
+}
+
+std::vector<Eigen::VectorXd> SampleConfigs(int num_configs) {
+  RandomGenerator generator(1234);
+  std::uniform_real_distribution<double> angle(-3.14, 3.14);
+  std::vector<Eigen::VectorXd> configs(num_configs);
+  for (Eigen::VectorXd& q : configs) {
+    q = Eigen::Vector3d(angle(generator), angle(generator), angle(generator));
+  }
+  return configs;
+}
+
+class SphereCollisionPrefilterTest : public ::testing::TestWithParam<double> {};
+
+TEST_P(SphereCollisionPrefilterTest, MatchesExactCheck) {
+  const auto checker = MakeChecker(GetParam());
+  const SphereCollisionPrefilter dut(*checker);
+  EXPECT_TRUE(dut.enabled());
+  // Four robot geometries, plus the ellipsoid.
+  EXPECT_EQ(dut.num_robot_spheres(), 4);
+  EXPECT_EQ(dut.num_environment_spheres(), 1);
+
+  const std::vector<Eigen::VectorXd> configs = SampleConfigs(400);
+  const std::vector<uint8_t> expected =
+      checker->CheckConfigsCollisionFree(configs, Parallelism::None());
+  EXPECT_EQ(dut.CheckConfigsCollisionFree(configs, Parallelism::None()),
+            expected);
+  EXPECT_EQ(dut.CheckConfigsCollisionFree(configs, Parallelism::Max()),
+            expected);
+
+  // The sphere tests answer a good share of the queries on their own, and
+  // never certify a configuration in collision.
+  int num_certified = 0;
+  int num_in_collision = 0;
+  for (int i = 0; i < ssize(configs); ++i) {
+    const bool certified = dut.CertifyConfigCollisionFree(configs[i], 0);
+    num_certified += certified;
+    num_in_collision += !expected[i];
+    if (certified) {
+      EXPECT_TRUE(expected[i]);
+    }
+  }
+  EXPECT_GT(num_certified, 0);
+  EXPECT_GT(num_in_collision, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(Padding, SphereCollisionPrefilterTest,
+                         ::testing::Values(0.0, 0.05));
+
+}  // namespace
+}  // namespace internal
+}  // namespace planning
+}  // namespace drake
@@ -3,10 +3,12 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/planning/robot_diagram_builder.h"
 #include "drake/planning/scene_graph_collision_checker.h"
 
@@ -154,6 +156,124 @@ GTEST_TEST(VisibilityGraphTest, BoxesInCorners) {
   }
 }
 
+class IncrementalVisibilityGraphTest : public ::testing::Test {
+ protected:
+  IncrementalVisibilityGraphTest() {
+    checker_ =
+        MakeSceneGraphCollisionCheckerFromString(boxes_in_corners, "urdf");
+    // The same points as in VisibilityGraphTest.BoxesInCorners.
+    points_.resize(2, 6);
+    // clang-format off
+    points_ << 0, 1.3,   0, -1.3,    0,  1.3,
+               0,   0, 1.3,    0, -1.3, -1.3;
+    // clang-format on
+    expected_ = VisibilityGraph(*checker_, points_).toDense().cast<double>();
+  }
+
+  std::unique_ptr<SceneGraphCollisionChecker> checker_;
+  MatrixXd points_;
+  // The adjacency matrix of all of the points.
+  MatrixXd expected_;
+};
+
+TEST_F(IncrementalVisibilityGraphTest, AddPoints) {
+  for (const bool parallelize : {false, true}) {
+    // Adding the points in two rounds gives the same graph, and checks every
+    // pair of collision-free points once.
+    IncrementalVisibilityGraph dut(*checker_);
+    EXPECT_EQ(dut.num_points(), 0);
+    EXPECT_EQ(dut.AddPoints(points_.leftCols(2), parallelize), 0);
+    EXPECT_EQ(dut.AddPoints(points_.rightCols(4), parallelize), 2);
+    EXPECT_EQ(dut.num_points(), 6);
+    EXPECT_TRUE(CompareMatrices(dut.points(), points_));
+    EXPECT_TRUE(CompareMatrices(dut.adjacency().toDense().cast<double>(),
+                                expected_));
+    EXPECT_EQ(dut.num_edge_checks(), 10);
+  }
+}
+
+TEST_F(IncrementalVisibilityGraphTest, RemovePoints) {
+  IncrementalVisibilityGraph dut(*checker_);
+  dut.AddPoints(points_);
+
+  // Removing points keeps the edges among the others.
+  dut.RemovePoints({0, 4});
+  EXPECT_EQ(dut.num_points(), 4);
+  const std::vector<int> kept{1, 2, 3, 5};
+  EXPECT_TRUE(CompareMatrices(dut.points(), points_(eigen_all, kept)));
+  EXPECT_TRUE(CompareMatrices(dut.adjacency().toDense().cast<double>(),
+                              expected_(kept, kept)));
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.RemovePoints({4}),
+                              ".*0 <= i && i < num_points\\(\\).*");
+}
+
+TEST_F(IncrementalVisibilityGraphTest, Resume) {
+  for (const bool parallelize : {false, true}) {
+    // A graph can be resumed from its points and adjacency matrix.
+    IncrementalVisibilityGraph dut(
+        *checker_, points_.leftCols(3),
+        VisibilityGraph(*checker_, points_.leftCols(3)));
+    EXPECT_EQ(dut.num_points(), 3);
+    EXPECT_EQ(dut.AddPoints(points_.rightCols(3), parallelize), 3);
+    EXPECT_TRUE(CompareMatrices(dut.adjacency().toDense().cast<double>(),
+                                expected_));
+    EXPECT_EQ(dut.num_edge_checks(), 7);
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      IncrementalVisibilityGraph(*checker_, points_.leftCols(3),
+                                 VisibilityGraph(*checker_, points_)),
+      ".*adjacency.rows\\(\\) == points.cols\\(\\).*");
+}
+
+TEST_F(IncrementalVisibilityGraphTest, MaxEdgeDistance) {
+  for (const bool parallelize : {false, true}) {
+    // Only the pairs of points within the distance bound are checked. Points 1
+    // and 3 (and 2 and 4) are 2.6 apart.
+    IncrementalVisibilityGraph dut(*checker_, 2.0);
+    EXPECT_EQ(dut.max_edge_distance(), 2.0);
+    dut.AddPoints(points_, parallelize);
+    MatrixXd expected_pruned = expected_;
+    expected_pruned(1, 3) = expected_pruned(3, 1) = 0;
+    expected_pruned(2, 4) = expected_pruned(4, 2) = 0;
+    EXPECT_TRUE(CompareMatrices(dut.adjacency().toDense().cast<double>(),
+                                expected_pruned));
+    EXPECT_EQ(dut.num_edge_checks(), 8);
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(IncrementalVisibilityGraph(*checker_, 0.0),
+                              ".*max_edge_distance > 0.*");
+}
+
+TEST_F(IncrementalVisibilityGraphTest, AddCollisionFreePoints) {
+  std::vector<int> free;
+  for (int i = 0; i < points_.cols(); ++i) {
+    if (expected_(i, i) > 0) {
+      free.push_back(i);
+    }
+  }
+  const int num_free = ssize(free);
+
+  for (const bool parallelize : {false, true}) {
+    // Points known to be collision free are trusted, and only their edges are
+    // checked.
+    IncrementalVisibilityGraph dut(*checker_);
+    EXPECT_EQ(dut.AddCollisionFreePoints(points_(eigen_all, free), parallelize),
+              0);
+    EXPECT_TRUE(CompareMatrices(dut.adjacency().toDense().cast<double>(),
+                                expected_(free, free)));
+    EXPECT_EQ(dut.num_edge_checks(), num_free * (num_free - 1) / 2);
+  }
+}
+
+TEST_F(IncrementalVisibilityGraphTest, WrongDimension) {
+  IncrementalVisibilityGraph dut(*checker_);
+  const std::string kWrongRows = ".*points.rows\\(\\) == points_.rows\\(\\).*";
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.AddPoints(MatrixXd::Zero(3, 2)), kWrongRows);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.AddCollisionFreePoints(MatrixXd::Zero(3, 2)),
+                              kWrongRows);
+}
+
 }  // namespace
 }  // namespace planning
 }  // namespace drake
@@ -1,7 +1,9 @@
 #include "drake/planning/visibility_graph.h"
 
 #include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <utility>
 #include <vector>
 
 #include <common_robotics_utilities/parallelism.hpp>
@@ -167,5 +169,177 @@ Eigen::SparseMatrix<bool> VisibilityGraph(
   return mat;
 }
 
+IncrementalVisibilityGraph::IncrementalVisibilityGraph(
+    const CollisionChecker& checker, const double max_edge_distance)
+    : checker_(checker),
+      max_edge_distance_(max_edge_distance),
+      points_(checker.plant().num_positions(), 0) {
+  DRAKE_THROW_UNLESS(max_edge_distance > 0);
+}
+
+IncrementalVisibilityGraph::IncrementalVisibilityGraph(
+    const CollisionChecker& checker,
+    const Eigen::Ref<const Eigen::MatrixXd>& points,
+    const Eigen::SparseMatrix<bool>& adjacency, const double max_edge_distance)
+    : IncrementalVisibilityGraph(checker, max_edge_distance) {
+  DRAKE_THROW_UNLESS(points.rows() == checker.plant().num_positions());
+  DRAKE_THROW_UNLESS(adjacency.rows() == points.cols());
+  DRAKE_THROW_UNLESS(adjacency.cols() == points.cols());
+  points_ = points;
+  points_free_.resize(points.cols(), 0x00);
+  edges_.resize(points.cols());
+  // Visiting the columns in order lists the edges of each point in increasing
+  // order.
+  for (int j = 0; j < adjacency.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<bool>::InnerIterator it(adjacency, j); it; ++it) {
+      const int i = it.index();
+      if (i <= j && it.value()) {
+        edges_[i].push_back(j);
+        if (i == j) {
+          points_free_[i] = 0x01;
+        }
+      }
+    }
+  }
+}
+
+IncrementalVisibilityGraph::~IncrementalVisibilityGraph() = default;
+
+int IncrementalVisibilityGraph::AddPoints(
+    const Eigen::Ref<const Eigen::MatrixXd>& points,
+    const Parallelism parallelize) {
+  return DoAddPoints(points, false, parallelize);
+}
+
+int IncrementalVisibilityGraph::AddCollisionFreePoints(
+    const Eigen::Ref<const Eigen::MatrixXd>& points,
+    const Parallelism parallelize) {
+  return DoAddPoints(points, true, parallelize);
+}
+
+int IncrementalVisibilityGraph::DoAddPoints(
+    const Eigen::Ref<const Eigen::MatrixXd>& points,
+    const bool points_are_collision_free, const Parallelism parallelize) {
+  DRAKE_THROW_UNLESS(points.rows() == points_.rows());
+
+  const int first_new = num_points();
+  const int num_new = points.cols();
+  const int num_total = first_new + num_new;
+  points_.conservativeResize(Eigen::NoChange, num_total);
+  points_.rightCols(num_new) = points;
+  points_free_.resize(num_total, points_are_collision_free ? 0x01 : 0x00);
+  edges_.resize(num_total);
+
+  const int num_threads_to_use =
+      checker_.SupportsParallelChecking() ? parallelize.num_threads() : 1;
+  while (ssize(contexts_) < num_threads_to_use) {
+    contexts_.push_back(checker_.MakeStandaloneModelContext());
+  }
+  drake::log()->debug(
+      "Adding {} points to an IncrementalVisibilityGraph of {} points using {} "
+      "threads",
+      num_new, first_new, num_threads_to_use);
+
+  const auto point_check_work = [&](const int thread_num, const int64_t k) {
+    const int i = first_new + static_cast<int>(k);
+    points_free_[i] =
+        static_cast<uint8_t>(checker_.CheckContextConfigCollisionFree(
+            contexts_[thread_num].get(), points_.col(i)));
+  };
+
+  if (!points_are_collision_free) {
+    StaticParallelForIndexLoop(DegreeOfParallelism(num_threads_to_use), 0,
+                               num_new, point_check_work,
+                               ParallelForBackend::BEST_AVAILABLE);
+  }
+
+  // For each new point j, the points i < j visible from it.
+  std::vector<std::vector<int>> new_edges(num_new);
+  std::vector<int64_t> num_checks(num_new, 0);
+  const bool prune_by_distance = std::isfinite(max_edge_distance_);
+
+  const auto edge_check_work = [&](const int thread_num, const int64_t k) {
+    const int j = first_new + static_cast<int>(k);
+    if (points_free_[j] == 0) {
+      return;
+    }
+    const Eigen::VectorXd q_j = points_.col(j);
+    for (int i = 0; i < j; ++i) {
+      if (points_free_[i] == 0) {
+        continue;
+      }
+      const Eigen::VectorXd q_i = points_.col(i);
+      if (prune_by_distance &&
+          checker_.ComputeConfigurationDistance(q_i, q_j) >
+              max_edge_distance_) {
+        continue;
+      }
+      ++num_checks[k];
+      if (checker_.CheckContextEdgeCollisionFree(contexts_[thread_num].get(),
+                                                 q_i, q_j)) {
+        new_edges[k].push_back(i);
+      }
+    }
+  };
+
+  DynamicParallelForIndexLoop(DegreeOfParallelism(num_threads_to_use), 0,
+                              num_new, edge_check_work,
+                              ParallelForBackend::BEST_AVAILABLE);
+
+  // Visiting the new points in order keeps the edge lists sorted.
+  for (int k = 0; k < num_new; ++k) {
+    const int j = first_new + k;
+    if (points_free_[j] > 0) {
+      edges_[j].push_back(j);
+    }
+    for (const int i : new_edges[k]) {
+      edges_[i].push_back(j);
+    }
+    num_edge_checks_ += num_checks[k];
+  }
+  return first_new;
+}
+
+void IncrementalVisibilityGraph::RemovePoints(const std::vector<int>& indices) {
+  std::vector<int> new_index(num_points(), 0);
+  for (const int i : indices) {
+    DRAKE_THROW_UNLESS(0 <= i && i < num_points());
+    new_index[i] = -1;
+  }
+  int num_kept = 0;
+  for (int i = 0; i < num_points(); ++i) {
+    if (new_index[i] >= 0) {
+      new_index[i] = num_kept++;
+    }
+  }
+
+  Eigen::MatrixXd points(points_.rows(), num_kept);
+  std::vector<uint8_t> points_free(num_kept);
+  std::vector<std::vector<int>> edges(num_kept);
+  for (int i = 0; i < num_points(); ++i) {
+    const int new_i = new_index[i];
+    if (new_i < 0) {
+      continue;
+    }
+    points.col(new_i) = points_.col(i);
+    points_free[new_i] = points_free_[i];
+    for (const int j : edges_[i]) {
+      if (new_index[j] >= 0) {
+        edges[new_i].push_back(new_index[j]);
+      }
+    }
+  }
+  points_ = std::move(points);
+  points_free_ = std::move(points_free);
+  edges_ = std::move(edges);
+}
+
+Eigen::SparseMatrix<bool> IncrementalVisibilityGraph::adjacency() const {
+  Eigen::SparseMatrix<bool> mat(num_points(), num_points());
+  EdgesIterator edges_iterator(edges_);
+  mat.setFromTriplets(edges_iterator.begin(), edges_iterator.end());
+  return mat;
+}
+
 }  // namespace planning
 }  // namespace drake
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
 #include <Eigen/Sparse>
 
+#include "drake/common/drake_copyable.h"
 #include "drake/common/parallelism.h"
 #include "drake/planning/collision_checker.h"
 
@@ -36,5 +42,113 @@ Eigen::SparseMatrix<bool> VisibilityGraph(
     const Eigen::Ref<const Eigen::MatrixXd>& points,
     Parallelism parallelize = Parallelism::Max());
 
+/** Builds the visibility graph (see VisibilityGraph()) of a growing collection
+of points incrementally: each call to AddPoints() only checks the new points and
+the edges incident to them, and keeps the results for the points added before.
+This is useful when the points are sampled in rounds, e.g., to grow a graph
+until it is dense enough, or to refill a graph after some of its points were
+removed by RemovePoints().
+
+Optionally, pairs of points farther apart than `max_edge_distance` (measured by
+CollisionChecker::ComputeConfigurationDistance()) are not checked at all, and
+are never connected. Long edges are the most expensive to check and the most
+likely to be in collision, so this bound can save most of the edge checks when
+the points are dense.
+
+The checks are distributed over threads using standalone contexts (see
+@ref ccb_explicit_contexts "Explicit Context Parallelism"), which are made the
+first time they are needed and are reused by later calls. The assumptions of
+VisibilityGraph() on the symmetry of the edge checks and (when parallelized) on
+the CollisionCheckerParams::distance_and_interpolation_provider apply here too.
+
+A graph computed earlier (e.g., stored to disk between runs) can be resumed by
+constructing this object from its points and adjacency matrix. */
+class IncrementalVisibilityGraph {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IncrementalVisibilityGraph);
+
+  /** Constructs an empty graph. The `checker` is aliased and must outlive this
+  object.
+  @throws std::exception if `max_edge_distance` is not positive. */
+  explicit IncrementalVisibilityGraph(
+      const CollisionChecker& checker,
+      double max_edge_distance = std::numeric_limits<double>::infinity());
+
+  /** Constructs a graph from `points` and their `adjacency` matrix (as returned
+  by VisibilityGraph() or adjacency()), without checking them again. The
+  diagonal of `adjacency` tells which points are collision free, and only its
+  upper triangle is read.
+  @throws std::exception if `points` does not have as many rows as the
+  checker's plant has positions, if `adjacency` is not square with one row per
+  point, or if `max_edge_distance` is not positive. */
+  IncrementalVisibilityGraph(
+      const CollisionChecker& checker,
+      const Eigen::Ref<const Eigen::MatrixXd>& points,
+      const Eigen::SparseMatrix<bool>& adjacency,
+      double max_edge_distance = std::numeric_limits<double>::infinity());
+
+  ~IncrementalVisibilityGraph();
+
+  /** Appends `points` (one per column) to the graph. Each new point is checked
+  for collisions, and each new point which is collision free is checked for
+  visibility from every collision-free point of the graph (old and new) within
+  max_edge_distance().
+  @returns the index of the first new point.
+  @throws std::exception if points.rows() is not the number of positions of the
+  checker's plant. */
+  int AddPoints(const Eigen::Ref<const Eigen::MatrixXd>& points,
+                Parallelism parallelize = Parallelism::Max());
+
+  /** Like AddPoints(), but for `points` already known to be collision free
+  (e.g., sampled by rejecting the configurations in collision), which are not
+  checked again. Only the edges incident to them are checked.
+  @returns the index of the first new point.
+  @throws std::exception if points.rows() is not the number of positions of the
+  checker's plant. */
+  int AddCollisionFreePoints(const Eigen::Ref<const Eigen::MatrixXd>& points,
+                             Parallelism parallelize = Parallelism::Max());
+
+  /** Removes the points with the given `indices` (and their edges) from the
+  graph. The remaining points keep their order and their edges.
+  @throws std::exception if any index is not in [0, num_points()). */
+  void RemovePoints(const std::vector<int>& indices);
+
+  /** Returns the number of points in the graph. */
+  int num_points() const { return points_.cols(); }
+
+  /** Returns the points of the graph (one per column). */
+  const Eigen::MatrixXd& points() const { return points_; }
+
+  /** Returns the adjacency matrix of the graph, with the same convention as
+  VisibilityGraph(). */
+  Eigen::SparseMatrix<bool> adjacency() const;
+
+  /** Returns the number of edge collision checks done by this object so far,
+  excluding the pairs pruned by max_edge_distance(). */
+  int64_t num_edge_checks() const { return num_edge_checks_; }
+
+  /** Returns the largest distance between two points of the graph for which
+  their edge is checked; points farther apart are never connected. */
+  double max_edge_distance() const { return max_edge_distance_; }
+
+ private:
+  // The implementation of AddPoints() and AddCollisionFreePoints(), which
+  // skips the point checks when `points_are_collision_free`.
+  int DoAddPoints(const Eigen::Ref<const Eigen::MatrixXd>& points,
+                  bool points_are_collision_free, Parallelism parallelize);
+
+  const CollisionChecker& checker_;
+  double max_edge_distance_{};
+  Eigen::MatrixXd points_;
+  // Choose std::vector<uint8_t> as a thread-safe data structure for the
+  // parallel evaluations.
+  std::vector<uint8_t> points_free_;
+  // edges_[i] lists (in increasing order) the points j ≥ i visible from i. A
+  // collision-free point lists itself.
+  std::vector<std::vector<int>> edges_;
+  std::vector<std::shared_ptr<CollisionCheckerContext>> contexts_;
+  int64_t num_edge_checks_{0};
+};
+
 }  // namespace planning
 }  // namespace drake
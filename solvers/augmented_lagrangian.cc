@@ -1,8 +1,14 @@
 #include "drake/solvers/augmented_lagrangian.h"
 
+#include <algorithm>
+#include <utility>
+
+#include <Eigen/SparseCore>
 #include <fmt/format.h>
 
 #include "drake/common/default_scalars.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/solvers/aggregate_costs_constraints.h"
 #include "drake/solvers/mathematical_program.h"
 
@@ -126,31 +132,131 @@ AugmentedLagrangianNonsmooth::AugmentedLagrangianNonsmooth(
 }
 
 namespace {
-template <typename AL, typename T>
-T EvalAugmentedLagrangian(const AL& al, const Eigen::Ref<const VectorX<T>>& x,
-                          const Eigen::Ref<const VectorX<T>>& s,
-                          const Eigen::VectorXd& lambda_val, double mu,
-                          VectorX<T>* constraint_residue, T* cost) {
-  DRAKE_DEMAND(x.rows() == al.prog().num_vars());
-  if constexpr (std::is_same_v<AL, AugmentedLagrangianSmooth>) {
-    DRAKE_DEMAND(al.s_size() == s.rows());
+// Evaluates `binding` at the value of all decision variables `x`. When
+// `gradient` is not null, it also computes the gradient of the binding output
+// w.r.t the binding variables, whose indices in `x` are returned in
+// `var_indices`. The AutoDiffXd used here is seeded with only the binding
+// variables, so the derivative width is binding.GetNumElements() instead of
+// prog.num_vars().
+template <typename C>
+void EvalBindingWithSparseGradient(const MathematicalProgram& prog,
+                                   const Binding<C>& binding,
+                                   const Eigen::Ref<const Eigen::VectorXd>& x,
+                                   Eigen::VectorXd* y,
+                                   std::vector<int>* var_indices,
+                                   Eigen::MatrixXd* gradient) {
+  if (gradient == nullptr) {
+    *y = prog.EvalBinding(binding, x);
+    return;
   }
-  DRAKE_DEMAND(lambda_val.rows() == al.lagrangian_size());
-  DRAKE_DEMAND(mu > 0);
-  DRAKE_DEMAND(constraint_residue != nullptr);
-  DRAKE_DEMAND(cost != nullptr);
-  *cost = T{0};
-  constraint_residue->resize(lambda_val.rows());
+  *var_indices = prog.FindDecisionVariableIndices(binding.variables());
+  Eigen::VectorXd binding_x(var_indices->size());
+  for (int i = 0; i < binding_x.rows(); ++i) {
+    binding_x(i) = x((*var_indices)[i]);
+  }
+  const AutoDiffVecXd binding_x_ad = math::InitializeAutoDiff(binding_x);
+  AutoDiffVecXd binding_y_ad;
+  binding.evaluator()->Eval(binding_x_ad, &binding_y_ad);
+  *y = math::ExtractValue(binding_y_ad);
+  *gradient = math::ExtractGradient(binding_y_ad, binding_x.rows());
+}
+
+// The augmented Lagrangian, the cost and the constraint residue evaluated in
+// double, together with their gradients w.r.t x and s (if requested). Each
+// constraint residue only depends on the variables of its own binding, so we
+// store the gradient of the residues as sparse triplets. The column index of a
+// triplet is the index of x, or num_vars + the index of s.
+struct AugmentedLagrangianEvaluation {
+  double al{0};
+  double cost{0};
+  Eigen::VectorXd constraint_residue;
+  bool compute_gradient{false};
+  Eigen::VectorXd al_gradient_x;
+  Eigen::VectorXd al_gradient_s;
+  Eigen::VectorXd cost_gradient_x;
+  std::vector<Eigen::Triplet<double>> constraint_residue_gradient;
+};
+
+template <typename AL>
+void EvalAugmentedLagrangianDouble(const AL& al,
+                                   const Eigen::Ref<const Eigen::VectorXd>& x,
+                                   const Eigen::Ref<const Eigen::VectorXd>& s,
+                                   const Eigen::VectorXd& lambda_val, double mu,
+                                   AugmentedLagrangianEvaluation* result) {
+  constexpr bool is_smooth = std::is_same_v<AL, AugmentedLagrangianSmooth>;
+  const int num_vars = al.prog().num_vars();
+  const bool compute_gradient = result->compute_gradient;
+  result->cost = 0;
+  result->constraint_residue.resize(lambda_val.rows());
+  if (compute_gradient) {
+    result->al_gradient_x = Eigen::VectorXd::Zero(num_vars);
+    result->al_gradient_s = Eigen::VectorXd::Zero(s.rows());
+    result->cost_gradient_x = Eigen::VectorXd::Zero(num_vars);
+    result->constraint_residue_gradient.clear();
+  }
+  Eigen::VectorXd y;
+  std::vector<int> var_indices;
+  Eigen::MatrixXd y_gradient;
+  Eigen::MatrixXd* y_gradient_ptr = compute_gradient ? &y_gradient : nullptr;
   for (const auto& cost_binding : al.prog().GetAllCosts()) {
-    *cost += al.prog().EvalBinding(cost_binding, x)(0);
+    EvalBindingWithSparseGradient(al.prog(), cost_binding, x, &y, &var_indices,
+                                  y_gradient_ptr);
+    result->cost += y(0);
+    if (compute_gradient) {
+      for (int j = 0; j < static_cast<int>(var_indices.size()); ++j) {
+        result->cost_gradient_x(var_indices[j]) += y_gradient(0, j);
+      }
+    }
+  }
+  result->al = result->cost;
+  if (compute_gradient) {
+    result->al_gradient_x = result->cost_gradient_x;
   }
-  T al_val = *cost;
   int lagrangian_count = 0;
   int s_count = 0;
+  // Adds the term for one constraint residue r to the augmented Lagrangian.
+  // `use_psi` is true if r >= 0 is an inequality constraint in the nonsmooth
+  // augmented Lagrangian, otherwise we treat r = 0 as an equality constraint.
+  // `r_gradient` is the gradient of r w.r.t the variables `r_var_indices`, and
+  // `r_s_index` is the index of the slack variable in r (-1 if none).
+  auto add_residue = [&](double r, bool use_psi,
+                         const std::vector<int>& r_var_indices,
+                         const Eigen::Ref<const Eigen::RowVectorXd>& r_gradient,
+                         int r_s_index) {
+    const double lambda = lambda_val(lagrangian_count);
+    result->constraint_residue(lagrangian_count) = r;
+    // dal_dr is ∂L/∂r.
+    double dal_dr{};
+    if (use_psi) {
+      result->al += psi(r, lambda, mu);
+      dal_dr = (r - lambda / mu < 0) ? -lambda + mu * r : 0;
+    } else {
+      result->al += al_for_equality(r, lambda, mu);
+      dal_dr = -lambda + mu * r;
+    }
+    if (compute_gradient) {
+      for (int j = 0; j < static_cast<int>(r_var_indices.size()); ++j) {
+        if (r_gradient(j) != 0) {
+          result->al_gradient_x(r_var_indices[j]) += dal_dr * r_gradient(j);
+          result->constraint_residue_gradient.emplace_back(
+              lagrangian_count, r_var_indices[j], r_gradient(j));
+        }
+      }
+      if (r_s_index >= 0) {
+        result->al_gradient_s(r_s_index) -= dal_dr;
+        result->constraint_residue_gradient.emplace_back(
+            lagrangian_count, num_vars + r_s_index, -1);
+      }
+    }
+    lagrangian_count++;
+  };
+  const Eigen::RowVectorXd empty_gradient(0);
+  const std::vector<int> empty_indices;
   // First evaluate all generic nonlinear constraints
   for (const auto& constraint : al.prog().GetAllConstraints()) {
     if (!dynamic_cast<BoundingBoxConstraint*>(constraint.evaluator().get())) {
-      const VectorX<T> constraint_val = al.prog().EvalBinding(constraint, x);
+      EvalBindingWithSparseGradient(al.prog(), constraint, x, &y, &var_indices,
+                                    y_gradient_ptr);
       // Now check if each row of the constraint is equality or inequality.
       for (int i = 0; i < constraint.evaluator()->num_constraints(); ++i) {
         const double& lb = constraint.evaluator()->lower_bound()(i);
@@ -159,88 +265,145 @@ T EvalAugmentedLagrangian(const AL& al, const Eigen::Ref<const VectorX<T>>& x,
           throw std::invalid_argument(fmt::format(
               "constraint lower bound is {}, upper bound is {}", lb, ub));
         }
+        const std::vector<int>& row_indices =
+            compute_gradient ? var_indices : empty_indices;
+        const Eigen::RowVectorXd row_gradient =
+            compute_gradient ? Eigen::RowVectorXd(y_gradient.row(i))
+                             : empty_gradient;
         if (lb == ub) {
           // We have one Lagrangian multiplier for the equality constraint. Add
           // −λ*h(x) + μ/2*h(x)² to the augmented Lagrangian.
-          al_val += al_for_equality(constraint_val(i) - lb,
-                                    lambda_val(lagrangian_count), mu);
-          (*constraint_residue)(lagrangian_count) = constraint_val(i) - lb;
-          lagrangian_count++;
+          add_residue(y(i) - lb, false, row_indices, row_gradient, -1);
         } else {
           if (!std::isinf(lb)) {
             // The constraint is constraint_val - lb >= 0.
-            if constexpr (std::is_same_v<AL, AugmentedLagrangianNonsmooth>) {
-              al_val +=
-                  psi(constraint_val(i) - lb, lambda_val(lagrangian_count), mu);
-              (*constraint_residue)(lagrangian_count) = constraint_val(i) - lb;
-            } else {
-              al_val += al_for_equality(constraint_val(i) - s(s_count) - lb,
-                                        lambda_val(lagrangian_count), mu);
-              (*constraint_residue)(lagrangian_count) =
-                  constraint_val(i) - s(s_count) - lb;
+            if constexpr (is_smooth) {
+              add_residue(y(i) - s(s_count) - lb, false, row_indices,
+                          row_gradient, s_count);
               s_count++;
+            } else {
+              add_residue(y(i) - lb, true, row_indices, row_gradient, -1);
             }
-            lagrangian_count++;
           }
           if (!std::isinf(ub)) {
             // The constraint is ub - constraint_val >= 0.
-            if constexpr (std::is_same_v<AL, AugmentedLagrangianNonsmooth>) {
-              al_val +=
-                  psi(ub - constraint_val(i), lambda_val(lagrangian_count), mu);
-              (*constraint_residue)(lagrangian_count) = ub - constraint_val(i);
-            } else {
-              al_val += al_for_equality(ub - constraint_val(i) - s(s_count),
-                                        lambda_val(lagrangian_count), mu);
-              (*constraint_residue)(lagrangian_count) =
-                  ub - constraint_val(i) - s(s_count);
+            if constexpr (is_smooth) {
+              add_residue(ub - y(i) - s(s_count), false, row_indices,
+                          -row_gradient, s_count);
               s_count++;
+            } else {
+              add_residue(ub - y(i), true, row_indices, -row_gradient, -1);
             }
-            lagrangian_count++;
           }
         }
       }
     }
   }
   if (al.include_x_bounds()) {
-    for (int i = 0; i < al.prog().num_vars(); ++i) {
+    std::vector<int> bound_indices(1);
+    const Eigen::RowVectorXd bound_gradient = Eigen::RowVectorXd::Ones(1);
+    for (int i = 0; i < num_vars; ++i) {
+      bound_indices[0] = i;
       if (al.x_lo()(i) == al.x_up()(i)) {
-        al_val += al_for_equality(x(i) - al.x_lo()(i),
-                                  lambda_val(lagrangian_count), mu);
-        (*constraint_residue)(lagrangian_count) = x(i) - al.x_lo()(i);
-        lagrangian_count++;
+        add_residue(x(i) - al.x_lo()(i), false, bound_indices, bound_gradient,
+                    -1);
       } else {
         if (!std::isinf(al.x_lo()(i))) {
-          if constexpr (std::is_same_v<AL, AugmentedLagrangianNonsmooth>) {
-            al_val +=
-                psi(x(i) - al.x_lo()(i), lambda_val(lagrangian_count), mu);
-            (*constraint_residue)(lagrangian_count) = x(i) - al.x_lo()(i);
+          if constexpr (is_smooth) {
+            add_residue(x(i) - al.x_lo()(i) - s(s_count), false, bound_indices,
+                        bound_gradient, s_count);
           } else {
-            al_val += al_for_equality(x(i) - al.x_lo()(i) - s(s_count),
-                                      lambda_val(lagrangian_count), mu);
-            (*constraint_residue)(lagrangian_count) =
-                x(i) - al.x_lo()(i) - s(s_count);
+            add_residue(x(i) - al.x_lo()(i), true, bound_indices,
+                        bound_gradient, -1);
           }
           s_count++;
-          lagrangian_count++;
         }
         if (!std::isinf(al.x_up()(i))) {
-          if constexpr (std::is_same_v<AL, AugmentedLagrangianNonsmooth>) {
-            al_val +=
-                psi(al.x_up()(i) - x(i), lambda_val(lagrangian_count), mu);
-            (*constraint_residue)(lagrangian_count) = al.x_up()(i) - x(i);
-          } else {
-            al_val += al_for_equality(al.x_up()(i) - x(i) - s(s_count),
-                                      lambda_val(lagrangian_count), mu);
-            (*constraint_residue)(lagrangian_count) =
-                al.x_up()(i) - x(i) - s(s_count);
+          if constexpr (is_smooth) {
+            add_residue(al.x_up()(i) - x(i) - s(s_count), false, bound_indices,
+                        -bound_gradient, s_count);
             s_count++;
+          } else {
+            add_residue(al.x_up()(i) - x(i), true, bound_indices,
+                        -bound_gradient, -1);
           }
-          lagrangian_count++;
         }
       }
     }
   }
-  return al_val;
+}
+
+template <typename AL, typename T>
+T EvalAugmentedLagrangian(const AL& al, const Eigen::Ref<const VectorX<T>>& x,
+                          const Eigen::Ref<const VectorX<T>>& s,
+                          const Eigen::VectorXd& lambda_val, double mu,
+                          VectorX<T>* constraint_residue, T* cost) {
+  DRAKE_DEMAND(x.rows() == al.prog().num_vars());
+  if constexpr (std::is_same_v<AL, AugmentedLagrangianSmooth>) {
+    DRAKE_DEMAND(al.s_size() == s.rows());
+  }
+  DRAKE_DEMAND(lambda_val.rows() == al.lagrangian_size());
+  DRAKE_DEMAND(mu > 0);
+  DRAKE_DEMAND(constraint_residue != nullptr);
+  DRAKE_DEMAND(cost != nullptr);
+  AugmentedLagrangianEvaluation result;
+  if constexpr (std::is_same_v<T, double>) {
+    EvalAugmentedLagrangianDouble(al, x, s, lambda_val, mu, &result);
+    *constraint_residue = std::move(result.constraint_residue);
+    *cost = result.cost;
+    return result.al;
+  } else {
+    // We evaluate the augmented Lagrangian in double with the sparse gradient
+    // w.r.t (x, s), and then apply the chain rule with the gradient of (x, s)
+    // only once, instead of carrying the full derivatives of x through every
+    // constraint evaluation.
+    result.compute_gradient = true;
+    EvalAugmentedLagrangianDouble(al, math::ExtractValue(x),
+                                  math::ExtractValue(s), lambda_val, mu,
+                                  &result);
+    Eigen::MatrixXd x_gradient = math::ExtractGradient(x);
+    Eigen::MatrixXd s_gradient = math::ExtractGradient(s);
+    const int num_derivatives =
+        std::max(x_gradient.cols(), s_gradient.cols());
+    if (x_gradient.cols() == 0) {
+      x_gradient = Eigen::MatrixXd::Zero(x.rows(), num_derivatives);
+    }
+    if (s_gradient.cols() == 0) {
+      s_gradient = Eigen::MatrixXd::Zero(s.rows(), num_derivatives);
+    }
+    if (x_gradient.cols() != s_gradient.cols()) {
+      throw std::logic_error(fmt::format(
+          "x has {} derivatives, but s has {} derivatives.", x_gradient.cols(),
+          s_gradient.cols()));
+    }
+    const int num_vars = x.rows();
+    Eigen::SparseMatrix<double> residue_gradient(lambda_val.rows(),
+                                                 num_vars + s.rows());
+    residue_gradient.setFromTriplets(result.constraint_residue_gradient.begin(),
+                                     result.constraint_residue_gradient.end());
+    const Eigen::MatrixXd residue_derivatives =
+        residue_gradient.leftCols(num_vars) * x_gradient +
+        residue_gradient.rightCols(s.rows()) * s_gradient;
+    constraint_residue->resize(lambda_val.rows());
+    for (int i = 0; i < lambda_val.rows(); ++i) {
+      (*constraint_residue)(i) = AutoDiffXd(
+          result.constraint_residue(i), residue_derivatives.row(i).transpose());
+    }
+    // Consistent with evaluating the cost and the augmented Lagrangian as a
+    // sum of AutoDiffXd terms, a sum without any term has empty derivatives.
+    if (al.prog().GetAllCosts().empty()) {
+      *cost = AutoDiffXd(result.cost);
+    } else {
+      *cost = AutoDiffXd(result.cost,
+                         x_gradient.transpose() * result.cost_gradient_x);
+    }
+    if (al.prog().GetAllCosts().empty() && lambda_val.rows() == 0) {
+      return AutoDiffXd(result.al);
+    }
+    return AutoDiffXd(result.al,
+                      x_gradient.transpose() * result.al_gradient_x +
+                          s_gradient.transpose() * result.al_gradient_s);
+  }
 }
 }  // namespace
 
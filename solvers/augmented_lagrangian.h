@@ -74,6 +74,11 @@ class AugmentedLagrangianNonsmooth {
    * at the end.
    * @param[out] cost The value of the cost function f(x).
    * @return The evaluated Augmented Lagrangian (AL) L(x, λ, μ).
+   * @note When T=AutoDiffXd, each cost and constraint is differentiated only
+   * w.r.t the variables in its binding, and the gradient of x is applied once
+   * at the end through the chain rule. Hence the evaluation cost scales with
+   * the number of non-zero entries in the constraint Jacobian, instead of with
+   * the number of constraints times prog().num_vars().
    */
   template <typename T>
   T Eval(const Eigen::Ref<const VectorX<T>>& x,
@@ -194,6 +199,9 @@ class AugmentedLagrangianSmooth {
    * @return The evaluated Augmented Lagrangian (AL) L(x, s, λ, μ).
    * @note This Eval function differs from AugmentedLagrangianNonsmooth::Eval()
    * function as `s` is an input argument.
+   * @note When T=AutoDiffXd, each cost and constraint is differentiated only
+   * w.r.t the variables in its binding, see
+   * AugmentedLagrangianNonsmooth::Eval() for more details.
    */
   template <typename T>
   T Eval(const Eigen::Ref<const VectorX<T>>& x,
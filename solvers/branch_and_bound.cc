@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -10,6 +12,7 @@
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/scs_solver.h"
+#include "drake/solvers/solve.h"
 
 namespace drake {
 namespace solvers {
@@ -297,7 +300,7 @@ void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
   fixed_binary_value_ = binary_value;
 }
 
-void MixedIntegerBranchAndBoundNode::Branch(
+void MixedIntegerBranchAndBoundNode::CreateChildren(
     const symbolic::Variable& binary_variable) {
   left_child_.reset(new MixedIntegerBranchAndBoundNode(
       *prog_, remaining_binary_variables_, solver_id_));
@@ -307,17 +310,25 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
-  left_child_->solution_result_ =
-      SolveProgramWithSolver(*left_child_->prog_, left_child_->solver_id_,
-                             left_child_->prog_result_.get());
-  right_child_->solution_result_ =
-      SolveProgramWithSolver(*right_child_->prog_, right_child_->solver_id_,
-                             right_child_->prog_result_.get());
-  if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    left_child_->CheckOptimalSolutionIsIntegral();
+}
+
+void MixedIntegerBranchAndBoundNode::SetSolveResult(
+    MathematicalProgramResult result) {
+  *prog_result_ = std::move(result);
+  solution_result_ = prog_result_->get_solution_result();
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    CheckOptimalSolutionIsIntegral();
   }
-  if (right_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    right_child_->CheckOptimalSolutionIsIntegral();
+}
+
+void MixedIntegerBranchAndBoundNode::Branch(
+    const symbolic::Variable& binary_variable) {
+  CreateChildren(binary_variable);
+  for (MixedIntegerBranchAndBoundNode* child :
+       {left_child_.get(), right_child_.get()}) {
+    MathematicalProgramResult result;
+    SolveProgramWithSolver(*child->prog_, child->solver_id_, &result);
+    child->SetSolveResult(std::move(result));
   }
 }
 
@@ -368,28 +379,39 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Each branch will create two new nodes. So if the current number of nodes
-    // + 2 is larger than options_.max_explored_nodes, we don't branch
-    // any more.
-    if (options_.max_explored_nodes >= 1 &&
-        root_->NumExploredNodesInSubtree() + 2 > options_.max_explored_nodes) {
-      return SolutionResult::kIterationLimit;
-    } else {
-      // Found a branching node, branch on this node. If no branching node is
-      // found, then every leaf node is fathomed, the branch-and-bound process
-      // should terminate.
-      // TODO(hongkai.dai) We might need to have a function that picks the
-      // branching node together with the branching variable simultaneously.
-      const symbolic::Variable* branching_variable =
-          PickBranchingVariable(*branching_node);
-      BranchAndUpdate(branching_node, *branching_variable);
-      if (HasConverged()) {
-        return SolutionResult::kSolutionFound;
+  std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+      PickBranchingNodes();
+  while (!branching_nodes.empty()) {
+    // Each branch will create two new nodes. So we only branch on as many
+    // nodes as options_.max_explored_nodes allows, and don't branch any more
+    // if the current number of nodes + 2 is larger than
+    // options_.max_explored_nodes.
+    if (options_.max_explored_nodes >= 1) {
+      const int max_num_branches =
+          (options_.max_explored_nodes - root_->NumExploredNodesInSubtree()) /
+          2;
+      if (max_num_branches < 1) {
+        return SolutionResult::kIterationLimit;
+      }
+      if (static_cast<int>(branching_nodes.size()) > max_num_branches) {
+        branching_nodes.resize(max_num_branches);
       }
-      branching_node = PickBranchingNode();
     }
+    // Found branching nodes, branch on these nodes. If no branching node is
+    // found, then every leaf node is fathomed, the branch-and-bound process
+    // should terminate.
+    // TODO(hongkai.dai) We might need to have a function that picks the
+    // branching node together with the branching variable simultaneously.
+    std::vector<const symbolic::Variable*> branching_variables;
+    branching_variables.reserve(branching_nodes.size());
+    for (const MixedIntegerBranchAndBoundNode* node : branching_nodes) {
+      branching_variables.push_back(PickBranchingVariable(*node));
+    }
+    BranchAndUpdate(branching_nodes, branching_variables);
+    if (HasConverged()) {
+      return SolutionResult::kSolutionFound;
+    }
+    branching_nodes = PickBranchingNodes();
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -495,6 +517,25 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickBranchingNode()
 }
 
 namespace {
+// Appends the non-fathomed leaf nodes in the subtree to `nodes`, from the left
+// to the right.
+void CollectNonFathomedLeafNodesInSubTree(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* nodes) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      nodes->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+  } else {
+    CollectNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.left_child()),
+                                         nodes);
+    CollectNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.right_child()),
+                                         nodes);
+  }
+}
+
 // Pick the non-fathomed leaf node in the tree with the smallest optimal cost.
 MixedIntegerBranchAndBoundNode* PickMinLowerBoundNodeInSubTree(
     const MixedIntegerBranchAndBound& bnb,
@@ -627,6 +668,46 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickDepthFirstNode()
   return PickDepthFirstNodeInSubTree(*this, *root_);
 }
 
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes() const {
+  if (options_.max_nodes_per_batch <= 1 ||
+      node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    MixedIntegerBranchAndBoundNode* node = PickBranchingNode();
+    if (node == nullptr) {
+      return {};
+    }
+    return {node};
+  }
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes;
+  CollectNonFathomedLeafNodesInSubTree(*this, *root_, &nodes);
+  // Order the nodes by the node selection method. The sort is stable, and ties
+  // are broken the same way as PickBranchingNode() breaks them: among nodes
+  // with the same cost the rightmost comes first, and among nodes with the
+  // same depth the leftmost comes first.
+  if (node_selection_method_ == NodeSelectionMethod::kMinLowerBound) {
+    std::reverse(nodes.begin(), nodes.end());
+    std::stable_sort(nodes.begin(), nodes.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->prog_result()->get_optimal_cost() <
+                              b->prog_result()->get_optimal_cost();
+                     });
+  } else {
+    DRAKE_DEMAND(node_selection_method_ == NodeSelectionMethod::kDepthFirst);
+    // The deepest node has the largest number of fixed binary variables.
+    std::stable_sort(nodes.begin(), nodes.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->remaining_binary_variables().size() <
+                              b->remaining_binary_variables().size();
+                     });
+  }
+  if (static_cast<int>(nodes.size()) > options_.max_nodes_per_batch) {
+    nodes.resize(options_.max_nodes_per_batch);
+  }
+  return nodes;
+}
+
 const symbolic::Variable* MixedIntegerBranchAndBound::PickBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node) const {
   switch (variable_selection_method_) {
@@ -670,7 +751,37 @@ bool MixedIntegerBranchAndBound::IsLeafNodeFathomed(
 void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
-  node->Branch(branching_variable);
+  BranchAndUpdate(std::vector<MixedIntegerBranchAndBoundNode*>{node},
+                  std::vector<const symbolic::Variable*>{&branching_variable});
+}
+
+void MixedIntegerBranchAndBound::BranchAndUpdate(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+    const std::vector<const symbolic::Variable*>& branching_variables) {
+  DRAKE_DEMAND(nodes.size() == branching_variables.size());
+  // Create all the child nodes first, and then solve their programs
+  // concurrently.
+  std::vector<MixedIntegerBranchAndBoundNode*> children;
+  children.reserve(2 * nodes.size());
+  for (int i = 0; i < static_cast<int>(nodes.size()); ++i) {
+    nodes[i]->CreateChildren(*branching_variables[i]);
+    children.push_back(nodes[i]->mutable_left_child());
+    children.push_back(nodes[i]->mutable_right_child());
+  }
+  std::vector<const MathematicalProgram*> progs;
+  std::vector<std::optional<SolverId>> solver_ids;
+  progs.reserve(children.size());
+  solver_ids.reserve(children.size());
+  for (const MixedIntegerBranchAndBoundNode* child : children) {
+    progs.push_back(child->prog());
+    solver_ids.push_back(child->solver_id());
+  }
+  std::vector<MathematicalProgramResult> results =
+      SolveInParallel(progs, nullptr, nullptr, &solver_ids,
+                      options_.parallelism, true /* dynamic_schedule */);
+  for (int i = 0; i < static_cast<int>(children.size()); ++i) {
+    children[i]->SetSolveResult(std::move(results[i]));
+  }
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -678,7 +789,7 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
+  for (auto& child : children) {
     if (child->solution_result() == SolutionResult::kSolutionFound &&
         child->optimal_solution_is_integral()) {
       const double child_node_optimal_cost =
@@ -5,13 +5,17 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/name_value.h"
+#include "drake/common/parallelism.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
 
 namespace drake {
 namespace solvers {
+class MixedIntegerBranchAndBound;
+
 /**
  * A node in the branch-and-bound (bnb) tree.
  * The whole branch-and-bound tree solves the mixed-integer problem
@@ -174,6 +178,8 @@ class MixedIntegerBranchAndBoundNode {
   [[nodiscard]] int NumExploredNodesInSubtree() const;
 
  private:
+  friend class MixedIntegerBranchAndBound;
+
   // If the solution to a binary variable is either less than integral_tol or
   // larger than 1 - integral_tol, then we regard the solution to be binary.
   // This method set this tolerance.
@@ -199,6 +205,14 @@ class MixedIntegerBranchAndBoundNode {
   void FixBinaryVariable(const symbolic::Variable& binary_variable,
                          bool binary_value);
 
+  // Creates the two child nodes as in Branch(), but does not solve the
+  // optimization programs in the child nodes.
+  void CreateChildren(const symbolic::Variable& binary_variable);
+
+  // Stores the result of solving the optimization program in this node, and
+  // checks if the optimal solution satisfies the integral constraints.
+  void SetSolveResult(MathematicalProgramResult result);
+
   // Check if the optimal solution to the program in this node satisfies all
   // integral constraints.
   // Only call this function AFTER the program is solved.
@@ -289,6 +303,7 @@ class MixedIntegerBranchAndBound {
     template <typename Archive>
     void Serialize(Archive* a) {
       a->Visit(DRAKE_NVP(max_explored_nodes));
+      a->Visit(DRAKE_NVP(max_nodes_per_batch));
     }
 
     /** The maximal number of explored nodes in the tree. The branch and bound
@@ -296,6 +311,23 @@ class MixedIntegerBranchAndBound {
      * max_explored_nodes <= 0 means that we don't put an upper bound on the
      * number of explored nodes. */
     int max_explored_nodes{-1};
+
+    /** The maximal number of nodes branched on in each iteration of the
+     * branch and bound process. The nodes are picked with the node selection
+     * method (in the order of that method), and the optimization programs in
+     * all of their child nodes are solved concurrently, using up to
+     * `parallelism` threads. The incumbent solution and the bounds are updated
+     * after all the child nodes are solved, in the order of the picked nodes.
+     * Hence the explored tree and the solutions depend on max_nodes_per_batch,
+     * but not on `parallelism`.
+     * @note With NodeSelectionMethod::kUserDefined, only one node is branched
+     * on in each iteration. */
+    int max_nodes_per_batch{1};
+
+    /** The parallelism used to solve the optimization programs in the child
+     * nodes. The programs that are not thread safe are solved sequentially.
+     * This option is not serialized. */
+    Parallelism parallelism{Parallelism::None()};
   };
 
   /**
@@ -598,6 +630,12 @@ class MixedIntegerBranchAndBound {
    */
   [[nodiscard]] MixedIntegerBranchAndBoundNode* PickBranchingNode() const;
 
+  /**
+   * Pick at most options_.max_nodes_per_batch distinct nodes to branch.
+   */
+  [[nodiscard]] std::vector<MixedIntegerBranchAndBoundNode*>
+  PickBranchingNodes() const;
+
   /**
    * Pick the node with the minimal lower bound.
    */
@@ -623,6 +661,15 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on each nodes[i] with branching_variables[i], solves the
+   * optimization programs in all the child nodes concurrently, and then
+   * update the best lower and upper bounds.
+   */
+  void BranchAndUpdate(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+      const std::vector<const symbolic::Variable*>& branching_variables);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
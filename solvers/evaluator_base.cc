@@ -1,10 +1,13 @@
 #include "drake/solvers/evaluator_base.h"
 
+#include <algorithm>
 #include <set>
+#include <utility>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/nice_type_name.h"
 #include "drake/common/symbolic/latex.h"
+#include "drake/math/autodiff_gradient.h"
 
 using Eigen::MatrixXd;
 using Eigen::VectorXd;
@@ -117,6 +120,107 @@ void EvaluatorBase::SetGradientSparsityPattern(
                                  num_vars());
   }
   gradient_sparsity_pattern_.emplace(gradient_sparsity_pattern);
+
+  // Greedily color the columns of the gradient, such that two columns with a
+  // non-zero entry in the same row get different colors.
+  int num_rows = 0;
+  int num_cols = 0;
+  for (const auto& [row, col] : gradient_sparsity_pattern) {
+    num_rows = std::max(num_rows, row + 1);
+    num_cols = std::max(num_cols, col + 1);
+  }
+  std::vector<std::vector<int>> row_to_cols(num_rows);
+  std::vector<std::vector<int>> col_to_rows(num_cols);
+  for (const auto& [row, col] : gradient_sparsity_pattern) {
+    row_to_cols[row].push_back(col);
+    col_to_rows[col].push_back(row);
+  }
+  gradient_column_colors_.assign(num_cols, -1);
+  num_gradient_colors_ = 0;
+  // forbidden_by[c] == j means color c is already taken by a column that
+  // shares a row with column j.
+  std::vector<int> forbidden_by;
+  for (int j = 0; j < num_cols; ++j) {
+    if (col_to_rows[j].empty()) {
+      continue;
+    }
+    for (int row : col_to_rows[j]) {
+      for (int neighbor : row_to_cols[row]) {
+        const int color = gradient_column_colors_[neighbor];
+        if (color >= 0) {
+          forbidden_by[color] = j;
+        }
+      }
+    }
+    int color = 0;
+    while (color < num_gradient_colors_ && forbidden_by[color] == j) {
+      ++color;
+    }
+    if (color == num_gradient_colors_) {
+      ++num_gradient_colors_;
+      forbidden_by.push_back(-1);
+    }
+    gradient_column_colors_[j] = color;
+  }
+}
+
+void EvaluatorBase::EvalWithGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    Eigen::VectorXd* gradient_values) const {
+  DRAKE_THROW_UNLESS(y != nullptr);
+  DRAKE_THROW_UNLESS(gradient_values != nullptr);
+  const int num_x = x.rows();
+  AutoDiffVecXd y_ad;
+  if (!gradient_sparsity_pattern_.has_value()) {
+    Eval(math::InitializeAutoDiff(x), &y_ad);
+    *y = math::ExtractValue(y_ad);
+    gradient_values->resize(y_ad.rows() * num_x);
+    for (int i = 0; i < y_ad.rows(); ++i) {
+      const Eigen::VectorXd& derivatives = y_ad(i).derivatives();
+      for (int j = 0; j < num_x; ++j) {
+        (*gradient_values)(i * num_x + j) =
+            derivatives.size() > 0 ? derivatives(j) : 0.0;
+      }
+    }
+    return;
+  }
+
+  // Sharing derivative directions is only correct if the pattern covers every
+  // true non-zero entry. Use kDrakeAssertIsArmed to skip the dense evaluation
+  // in release builds.
+  if (kDrakeAssertIsArmed) {
+    AutoDiffVecXd y_dense;
+    Eval(math::InitializeAutoDiff(x), &y_dense);
+    Eigen::MatrixXd unexpected = math::ExtractGradient(y_dense, num_x);
+    for (const auto& [row, col] : *gradient_sparsity_pattern_) {
+      unexpected(row, col) = 0;
+    }
+    DRAKE_ASSERT((unexpected.array() == 0).all());
+  }
+
+  // Seed the variables of the same color with the same derivative direction.
+  AutoDiffVecXd x_ad(num_x);
+  const int num_colored = std::min<int>(num_x, gradient_column_colors_.size());
+  for (int j = 0; j < num_x; ++j) {
+    Eigen::VectorXd derivatives = Eigen::VectorXd::Zero(num_gradient_colors_);
+    if (j < num_colored && gradient_column_colors_[j] >= 0) {
+      derivatives(gradient_column_colors_[j]) = 1;
+    }
+    x_ad(j) = AutoDiffXd(x(j), std::move(derivatives));
+  }
+  Eval(x_ad, &y_ad);
+  *y = math::ExtractValue(y_ad);
+  // Since no other column of the same color has a non-zero entry in the row,
+  // the derivative along the color direction is the entry of the gradient.
+  const std::vector<std::pair<int, int>>& pattern = *gradient_sparsity_pattern_;
+  gradient_values->resize(pattern.size());
+  for (int k = 0; k < static_cast<int>(pattern.size()); ++k) {
+    const auto& [row, col] = pattern[k];
+    const Eigen::VectorXd& derivatives = y_ad(row).derivatives();
+    (*gradient_values)(k) = derivatives.size() > 0
+                                ? derivatives(gradient_column_colors_[col])
+                                : 0.0;
+  }
 }
 
 std::string to_string(const EvaluatorBase& e) {
@@ -128,6 +128,12 @@ class EvaluatorBase {
    * y value in Eval, w.r.t x in Eval) . gradient_sparsity_pattern contains
    * *all* the pairs of (row_index, col_index) for which the corresponding
    * entries could have non-zero value in the gradient matrix ∂y/∂x.
+   *
+   * The pattern must be a superset of the true non-zero entries. In
+   * particular, EvalWithGradient() shares one derivative direction among
+   * columns that the pattern says never overlap, so an omitted non-zero entry
+   * silently corrupts the entries of every column sharing its color. (Builds
+   * with DRAKE_ASSERT armed check this during EvalWithGradient().)
    */
   void SetGradientSparsityPattern(
       const std::vector<std::pair<int, int>>& gradient_sparsity_pattern);
@@ -145,6 +151,33 @@ class EvaluatorBase {
     return gradient_sparsity_pattern_;
   }
 
+  /**
+   * Evaluates the expression and the gradient ∂y/∂x with forward-mode
+   * automatic differentiation.
+   *
+   * When gradient_sparsity_pattern() is set, the columns of ∂y/∂x that never
+   * have non-zero entries in the same row share a single derivative direction
+   * (a greedy column coloring of the sparsity pattern, computed once in
+   * SetGradientSparsityPattern()). The derivative width of the AutoDiffXd
+   * evaluation is then the number of colors, which for a banded or block
+   * sparse gradient is much smaller than the number of variables. Otherwise
+   * every variable gets its own derivative direction.
+   *
+   * @pre When gradient_sparsity_pattern() is set, it contains every non-zero
+   * entry of ∂y/∂x at `x` (checked only when DRAKE_ASSERT is armed, at the
+   * cost of an additional dense evaluation).
+   *
+   * @param[in] x A `num_vars` x 1 input vector.
+   * @param[out] y A `num_outputs` x 1 output vector.
+   * @param[out] gradient_values The entries of ∂y/∂x. If
+   * gradient_sparsity_pattern() is set, then gradient_values(k) is the entry
+   * at gradient_sparsity_pattern()[k]; otherwise gradient_values stores all
+   * the entries of ∂y/∂x in row-major order.
+   */
+  void EvalWithGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                        Eigen::VectorXd* y,
+                        Eigen::VectorXd* gradient_values) const;
+
   /**
    * Returns whether it is safe to call Eval in parallel.
    */
@@ -236,6 +269,12 @@ class EvaluatorBase {
   // false, the gradient matrix is regarded as non-sparse, i.e., every entry of
   // the gradient matrix can be non-zero.
   std::optional<std::vector<std::pair<int, int>>> gradient_sparsity_pattern_;
+  // When gradient_sparsity_pattern_ is set, gradient_column_colors_[j] is the
+  // derivative direction used for x(j) in EvalWithGradient(), or -1 if the
+  // column j of the gradient is structurally zero. Two columns with a non-zero
+  // entry in the same row never share a color.
+  std::vector<int> gradient_column_colors_;
+  int num_gradient_colors_{0};
   bool is_thread_safe_{};
 };
 
@@ -279,6 +279,19 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
       }
     }
     return grad_idx;
+  } else if (c->gradient_sparsity_pattern().has_value()) {
+    // Use the column-compressed auto-diff evaluation, whose gradient entries
+    // are ordered as the sparsity pattern in GetGradientMatrix.
+    Eigen::VectorXd ty;
+    Eigen::VectorXd gradient_values;
+    c->EvalWithGradient(this_x, &ty, &gradient_values);
+    for (int i = 0; i < c->num_constraints(); i++) {
+      result[i] = ty(i);
+    }
+    for (int i = 0; i < gradient_values.rows(); ++i) {
+      grad[i] = gradient_values(i);
+    }
+    return static_cast<size_t>(gradient_values.rows());
   } else {
     // Otherwise, use auto-diff.
     AutoDiffVecXd ty(c->num_constraints());
@@ -295,26 +308,14 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
     size_t grad_idx = 0;
 
     DRAKE_ASSERT(ty.rows() == c->num_constraints());
-    const std::optional<std::vector<std::pair<int, int>>>& sparsity_pattern =
-        binding.evaluator()->gradient_sparsity_pattern();
-    if (sparsity_pattern.has_value()) {
-      for (const auto& [row, col] : sparsity_pattern.value()) {
-        if (ty(row).derivatives().size() > 0) {
-          grad[grad_idx++] = ty(row).derivatives()(col);
-        } else {
-          grad[grad_idx++] = 0;
+    for (int i = 0; i < ty.rows(); i++) {
+      if (ty(i).derivatives().size() > 0) {
+        for (int j = 0; j < binding.variables().rows(); j++) {
+          grad[grad_idx++] = ty(i).derivatives()(j);
         }
-      }
-    } else {
-      for (int i = 0; i < ty.rows(); i++) {
-        if (ty(i).derivatives().size() > 0) {
-          for (int j = 0; j < binding.variables().rows(); j++) {
-            grad[grad_idx++] = ty(i).derivatives()(j);
-          }
-        } else {
-          for (int j = 0; j < binding.variables().rows(); j++) {
-            grad[grad_idx++] = 0;
-          }
+      } else {
+        for (int j = 0; j < binding.variables().rows(); j++) {
+          grad[grad_idx++] = 0;
         }
       }
     }
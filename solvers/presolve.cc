@@ -0,0 +1,510 @@
+#include "drake/solvers/presolve.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include <Eigen/SparseCore>
+#include <Eigen/SparseQR>
+
+#include "drake/solvers/aggregate_costs_constraints.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+const double kInf = std::numeric_limits<double>::infinity();
+
+// One row of a linear constraint lb <= aᵀx <= ub.
+struct LinearRow {
+  // The pairs of (variable index, coefficient) with distinct variable indices
+  // and non-zero coefficients.
+  std::vector<std::pair<int, double>> coeffs;
+  double lb{};
+  double ub{};
+  // The index of the linear constraint binding that this row comes from.
+  int binding_index{};
+  bool removed{false};
+};
+
+std::vector<LinearRow> ParseLinearRows(
+    const MathematicalProgram& prog,
+    const std::vector<Binding<LinearConstraint>>& bindings) {
+  std::vector<LinearRow> rows;
+  for (int k = 0; k < static_cast<int>(bindings.size()); ++k) {
+    const LinearConstraint& evaluator = *bindings[k].evaluator();
+    const Eigen::SparseMatrix<double>& A = evaluator.get_sparse_A();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(bindings[k].variables());
+    const int row_start = rows.size();
+    for (int i = 0; i < evaluator.num_constraints(); ++i) {
+      LinearRow row;
+      row.lb = evaluator.lower_bound()(i);
+      row.ub = evaluator.upper_bound()(i);
+      row.binding_index = k;
+      rows.push_back(std::move(row));
+    }
+    for (int j = 0; j < A.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+        rows[row_start + it.row()].coeffs.emplace_back(var_indices[j],
+                                                       it.value());
+      }
+    }
+    // Merge the duplicated variables within each row.
+    for (int i = row_start; i < static_cast<int>(rows.size()); ++i) {
+      auto& coeffs = rows[i].coeffs;
+      std::sort(coeffs.begin(), coeffs.end());
+      std::vector<std::pair<int, double>> merged;
+      for (const auto& [var_index, coeff] : coeffs) {
+        if (!merged.empty() && merged.back().first == var_index) {
+          merged.back().second += coeff;
+        } else {
+          merged.emplace_back(var_index, coeff);
+        }
+      }
+      merged.erase(std::remove_if(merged.begin(), merged.end(),
+                                  [](const std::pair<int, double>& entry) {
+                                    return entry.second == 0;
+                                  }),
+                   merged.end());
+      coeffs = std::move(merged);
+    }
+  }
+  return rows;
+}
+
+// Returns the range of aᵀx for x within the bounds [lo, up].
+std::pair<double, double> RowActivity(const LinearRow& row,
+                                      const Eigen::VectorXd& lo,
+                                      const Eigen::VectorXd& up) {
+  double min_activity = 0;
+  double max_activity = 0;
+  for (const auto& [var_index, coeff] : row.coeffs) {
+    if (coeff > 0) {
+      min_activity += coeff * lo(var_index);
+      max_activity += coeff * up(var_index);
+    } else {
+      min_activity += coeff * up(var_index);
+      max_activity += coeff * lo(var_index);
+    }
+  }
+  return {min_activity, max_activity};
+}
+
+// Finds the equality rows which are linear combinations of the other equality
+// rows. Returns false if such a row is inconsistent with the other rows, namely
+// the program is infeasible.
+bool RemoveDependentEqualityRows(int num_vars, double tol,
+                                 std::vector<LinearRow>* rows,
+                                 int* num_removed_rows) {
+  std::vector<int> eq_rows;
+  for (int i = 0; i < static_cast<int>(rows->size()); ++i) {
+    const LinearRow& row = (*rows)[i];
+    if (!row.removed && row.lb == row.ub) {
+      eq_rows.push_back(i);
+    }
+  }
+  if (eq_rows.size() < 2) {
+    return true;
+  }
+  // Each column of A_eqᵀ is an equality row.
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int k = 0; k < static_cast<int>(eq_rows.size()); ++k) {
+    for (const auto& [var_index, coeff] : (*rows)[eq_rows[k]].coeffs) {
+      triplets.emplace_back(var_index, k, coeff);
+    }
+  }
+  Eigen::SparseMatrix<double> A_eq_transpose(num_vars, eq_rows.size());
+  A_eq_transpose.setFromTriplets(triplets.begin(), triplets.end());
+  A_eq_transpose.makeCompressed();
+  Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr;
+  qr.setPivotThreshold(tol);
+  qr.compute(A_eq_transpose);
+  if (qr.info() != Eigen::Success ||
+      qr.rank() == static_cast<int>(eq_rows.size())) {
+    return true;
+  }
+  // The first rank() columns of A_eqᵀ * P are linearly independent, where the
+  // k'th column of A_eqᵀ * P is the column permutation(k) of A_eqᵀ.
+  const Eigen::VectorXi permutation = qr.colsPermutation().indices();
+  const int rank = qr.rank();
+  triplets.clear();
+  Eigen::VectorXd b_independent(rank);
+  for (int k = 0; k < rank; ++k) {
+    const LinearRow& row = (*rows)[eq_rows[permutation(k)]];
+    for (const auto& [var_index, coeff] : row.coeffs) {
+      triplets.emplace_back(var_index, k, coeff);
+    }
+    b_independent(k) = row.lb;
+  }
+  Eigen::SparseMatrix<double> A_independent_transpose(num_vars, rank);
+  A_independent_transpose.setFromTriplets(triplets.begin(), triplets.end());
+  A_independent_transpose.makeCompressed();
+  qr.compute(A_independent_transpose);
+  if (qr.info() != Eigen::Success) {
+    return true;
+  }
+  for (int k = rank; k < static_cast<int>(eq_rows.size()); ++k) {
+    LinearRow& row = (*rows)[eq_rows[permutation(k)]];
+    Eigen::VectorXd a = Eigen::VectorXd::Zero(num_vars);
+    for (const auto& [var_index, coeff] : row.coeffs) {
+      a(var_index) = coeff;
+    }
+    // Solve A_independentᵀ * c = a, such that a = ∑ᵢ cᵢ * independent row i.
+    const Eigen::VectorXd c = qr.solve(a);
+    if ((A_independent_transpose * c - a).norm() > tol * (1 + a.norm())) {
+      // The QR factorization mislabeled this row as dependent, keep it.
+      continue;
+    }
+    if (std::abs(b_independent.dot(c) - row.lb) >
+        tol * (1 + std::abs(row.lb))) {
+      return false;
+    }
+    row.removed = true;
+    ++(*num_removed_rows);
+  }
+  return true;
+}
+
+// Splits the positions of `var_indices` into those with fixed variables and
+// those with the remaining variables.
+void SplitFixedPositions(const std::vector<int>& var_indices,
+                         const std::vector<bool>& is_fixed,
+                         std::vector<int>* fixed_positions,
+                         std::vector<int>* free_positions) {
+  fixed_positions->clear();
+  free_positions->clear();
+  for (int i = 0; i < static_cast<int>(var_indices.size()); ++i) {
+    if (is_fixed[var_indices[i]]) {
+      fixed_positions->push_back(i);
+    } else {
+      free_positions->push_back(i);
+    }
+  }
+}
+}  // namespace
+
+PresolvedProgram::PresolvedProgram(const MathematicalProgram* prog,
+                                   const PresolveOptions& options)
+    : original_prog_{prog} {
+  DRAKE_THROW_UNLESS(prog != nullptr);
+  DRAKE_THROW_UNLESS(options.tol >= 0);
+  const int num_vars = prog->num_vars();
+  const double tol = options.tol;
+  Eigen::VectorXd lo;
+  Eigen::VectorXd up;
+  AggregateBoundingBoxConstraints(*prog, &lo, &up);
+
+  // The variables bound by the costs and constraints that are not rewritten
+  // by the presolve. These variables have to stay in the presolved program.
+  std::vector<bool> is_protected(num_vars, false);
+  auto protect = [prog, &is_protected](const auto& bindings) {
+    for (const auto& binding : bindings) {
+      for (int i = 0; i < binding.variables().rows(); ++i) {
+        is_protected[prog->FindDecisionVariableIndex(binding.variables()(i))] =
+            true;
+      }
+    }
+  };
+  protect(prog->generic_costs());
+  protect(prog->l2norm_costs());
+  protect(prog->generic_constraints());
+  protect(prog->quadratic_constraints());
+  protect(prog->lorentz_cone_constraints());
+  protect(prog->rotated_lorentz_cone_constraints());
+  protect(prog->positive_semidefinite_constraints());
+  protect(prog->linear_matrix_inequality_constraints());
+  protect(prog->linear_complementarity_constraints());
+  protect(prog->exponential_cone_constraints());
+
+  const std::vector<Binding<LinearConstraint>> linear_bindings =
+      prog->GetAllLinearConstraints();
+  std::vector<LinearRow> rows = ParseLinearRows(*prog, linear_bindings);
+
+  std::vector<bool> is_fixed(num_vars, false);
+  fixed_values_ = Eigen::VectorXd::Constant(
+      num_vars, std::numeric_limits<double>::quiet_NaN());
+  bool changed = true;
+  while (changed && !is_infeasible_) {
+    changed = false;
+    for (int i = 0; i < num_vars; ++i) {
+      if (is_fixed[i]) {
+        continue;
+      }
+      if (options.tighten_bounds) {
+        const symbolic::Variable::Type type =
+            prog->decision_variable(i).get_type();
+        if (type == symbolic::Variable::Type::BINARY) {
+          lo(i) = std::max(lo(i), 0.0);
+          up(i) = std::min(up(i), 1.0);
+        }
+        if (type == symbolic::Variable::Type::BINARY ||
+            type == symbolic::Variable::Type::INTEGER) {
+          lo(i) = std::ceil(lo(i) - tol);
+          up(i) = std::floor(up(i) + tol);
+        }
+      }
+      if (lo(i) > up(i) + tol) {
+        is_infeasible_ = true;
+        break;
+      }
+      if (options.remove_fixed_variables && up(i) - lo(i) <= tol) {
+        is_fixed[i] = true;
+        fixed_values_(i) = lo(i) == up(i) ? lo(i) : 0.5 * (lo(i) + up(i));
+        lo(i) = fixed_values_(i);
+        up(i) = fixed_values_(i);
+        changed = true;
+      }
+    }
+    for (LinearRow& row : rows) {
+      if (row.removed || is_infeasible_) {
+        continue;
+      }
+      // Substitute the fixed variables.
+      auto& coeffs = row.coeffs;
+      for (const auto& [var_index, coeff] : coeffs) {
+        if (is_fixed[var_index]) {
+          row.lb -= coeff * fixed_values_(var_index);
+          row.ub -= coeff * fixed_values_(var_index);
+        }
+      }
+      coeffs.erase(std::remove_if(coeffs.begin(), coeffs.end(),
+                                  [&is_fixed](const std::pair<int, double>& e) {
+                                    return is_fixed[e.first];
+                                  }),
+                   coeffs.end());
+      if (coeffs.empty()) {
+        // The row is lb <= 0 <= ub.
+        if (row.lb > tol || row.ub < -tol) {
+          is_infeasible_ = true;
+          break;
+        }
+        row.removed = true;
+      } else if (coeffs.size() == 1 && options.tighten_bounds) {
+        // The row is lb <= a * x <= ub.
+        const auto [var_index, a] = coeffs[0];
+        const double new_lo = a > 0 ? row.lb / a : row.ub / a;
+        const double new_up = a > 0 ? row.ub / a : row.lb / a;
+        lo(var_index) = std::max(lo(var_index), new_lo);
+        up(var_index) = std::min(up(var_index), new_up);
+        row.removed = true;
+      } else if (options.remove_redundant_constraints) {
+        const auto [min_activity, max_activity] = RowActivity(row, lo, up);
+        if (min_activity > row.ub + tol || max_activity < row.lb - tol) {
+          is_infeasible_ = true;
+          break;
+        }
+        if (min_activity >= row.lb - tol && max_activity <= row.ub + tol) {
+          row.removed = true;
+        }
+      }
+      if (row.removed) {
+        ++num_removed_linear_constraint_rows_;
+        changed = true;
+      }
+    }
+  }
+  if (!is_infeasible_ && options.remove_redundant_constraints) {
+    is_infeasible_ = !RemoveDependentEqualityRows(
+        num_vars, tol, &rows, &num_removed_linear_constraint_rows_);
+  }
+  if (is_infeasible_) {
+    prog_ = prog->Clone();
+    is_removed_ = std::vector<bool>(num_vars, false);
+    num_removed_variables_ = 0;
+    num_removed_linear_constraint_rows_ = 0;
+    return;
+  }
+
+  // Now construct the presolved program.
+  prog_ = std::make_unique<MathematicalProgram>();
+  is_removed_.resize(num_vars);
+  std::vector<symbolic::Variable> kept_vars;
+  for (int i = 0; i < num_vars; ++i) {
+    is_removed_[i] = is_fixed[i] && !is_protected[i];
+    if (is_removed_[i]) {
+      ++num_removed_variables_;
+    } else {
+      kept_vars.push_back(prog->decision_variable(i));
+    }
+  }
+  prog_->AddDecisionVariables(
+      Eigen::Map<const VectorXDecisionVariable>(kept_vars.data(),
+                                                kept_vars.size()));
+  if (prog->num_indeterminates() > 0) {
+    prog_->AddIndeterminates(prog->indeterminates());
+  }
+  for (const auto& var : kept_vars) {
+    prog_->SetInitialGuess(var, prog->GetInitialGuess(var));
+  }
+  prog_->SetSolverOptions(prog->solver_options());
+
+  // Bounding box constraints on the remaining variables.
+  std::vector<symbolic::Variable> bounded_vars;
+  std::vector<double> bounded_lo;
+  std::vector<double> bounded_up;
+  for (int i = 0; i < num_vars; ++i) {
+    if (!is_removed_[i] && (lo(i) > -kInf || up(i) < kInf)) {
+      bounded_vars.push_back(prog->decision_variable(i));
+      bounded_lo.push_back(lo(i));
+      bounded_up.push_back(up(i));
+    }
+  }
+  if (!bounded_vars.empty()) {
+    prog_->AddBoundingBoxConstraint(
+        Eigen::Map<const Eigen::VectorXd>(bounded_lo.data(), bounded_lo.size()),
+        Eigen::Map<const Eigen::VectorXd>(bounded_up.data(), bounded_up.size()),
+        Eigen::Map<const VectorXDecisionVariable>(bounded_vars.data(),
+                                                  bounded_vars.size()));
+  }
+
+  // The remaining linear constraint rows, grouped by their original binding.
+  std::vector<std::vector<int>> binding_rows(linear_bindings.size());
+  for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+    if (!rows[i].removed) {
+      binding_rows[rows[i].binding_index].push_back(i);
+    }
+  }
+  for (int k = 0; k < static_cast<int>(linear_bindings.size()); ++k) {
+    if (binding_rows[k].empty()) {
+      continue;
+    }
+    // Map the variable indices in the original program to the columns of the
+    // new constraint.
+    std::vector<int> var_indices;
+    for (int i : binding_rows[k]) {
+      for (const auto& [var_index, coeff] : rows[i].coeffs) {
+        var_indices.push_back(var_index);
+      }
+    }
+    std::sort(var_indices.begin(), var_indices.end());
+    var_indices.erase(std::unique(var_indices.begin(), var_indices.end()),
+                      var_indices.end());
+    VectorXDecisionVariable vars(var_indices.size());
+    for (int j = 0; j < vars.rows(); ++j) {
+      vars(j) = prog->decision_variable(var_indices[j]);
+    }
+    const int num_rows = binding_rows[k].size();
+    std::vector<Eigen::Triplet<double>> triplets;
+    Eigen::VectorXd row_lb(num_rows);
+    Eigen::VectorXd row_ub(num_rows);
+    for (int r = 0; r < num_rows; ++r) {
+      const LinearRow& row = rows[binding_rows[k][r]];
+      for (const auto& [var_index, coeff] : row.coeffs) {
+        const int col = std::lower_bound(var_indices.begin(),
+                                         var_indices.end(), var_index) -
+                        var_indices.begin();
+        triplets.emplace_back(r, col, coeff);
+      }
+      row_lb(r) = row.lb;
+      row_ub(r) = row.ub;
+    }
+    Eigen::SparseMatrix<double> A(num_rows, var_indices.size());
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    if (dynamic_cast<const LinearEqualityConstraint*>(
+            linear_bindings[k].evaluator().get())) {
+      prog_->AddLinearEqualityConstraint(A, row_lb, vars);
+    } else {
+      prog_->AddLinearConstraint(A, row_lb, row_ub, vars);
+    }
+  }
+
+  // Substitute the fixed variables into the linear and quadratic costs.
+  std::vector<int> fixed_positions;
+  std::vector<int> free_positions;
+  for (const auto& binding : prog->linear_costs()) {
+    const std::vector<int> var_indices =
+        prog->FindDecisionVariableIndices(binding.variables());
+    SplitFixedPositions(var_indices, is_fixed, &fixed_positions,
+                        &free_positions);
+    const Eigen::VectorXd& a = binding.evaluator()->a();
+    double b = binding.evaluator()->b();
+    for (int i : fixed_positions) {
+      b += a(i) * fixed_values_(var_indices[i]);
+    }
+    if (free_positions.empty()) {
+      cost_offset_ += b;
+    } else {
+      prog_->AddLinearCost(a(free_positions), b,
+                           binding.variables()(free_positions));
+    }
+  }
+  for (const auto& binding : prog->quadratic_costs()) {
+    const std::vector<int> var_indices =
+        prog->FindDecisionVariableIndices(binding.variables());
+    SplitFixedPositions(var_indices, is_fixed, &fixed_positions,
+                        &free_positions);
+    const Eigen::MatrixXd& Q = binding.evaluator()->Q();
+    const Eigen::VectorXd& b = binding.evaluator()->b();
+    Eigen::VectorXd x_fixed(fixed_positions.size());
+    for (int i = 0; i < x_fixed.rows(); ++i) {
+      x_fixed(i) = fixed_values_(var_indices[fixed_positions[i]]);
+    }
+    // Write x = (y, z) where y are the free variables and z are the fixed
+    // variables, then the cost 0.5xᵀQx + bᵀx + c is
+    // 0.5yᵀQ_yy y + (b_y + Q_yz z)ᵀy + c + b_zᵀz + 0.5zᵀQ_zz z.
+    const double c =
+        binding.evaluator()->c() + b(fixed_positions).dot(x_fixed) +
+        0.5 * x_fixed.dot(Q(fixed_positions, fixed_positions) * x_fixed);
+    if (free_positions.empty()) {
+      cost_offset_ += c;
+    } else {
+      // A principal submatrix of a positive semidefinite matrix is also
+      // positive semidefinite.
+      const std::optional<bool> is_convex =
+          binding.evaluator()->is_convex() ? std::optional<bool>(true)
+                                           : std::nullopt;
+      prog_->AddQuadraticCost(
+          Q(free_positions, free_positions),
+          b(free_positions) + Q(free_positions, fixed_positions) * x_fixed, c,
+          binding.variables()(free_positions), is_convex);
+    }
+  }
+
+  // The costs and constraints that are not rewritten by the presolve.
+  for (const auto& binding : prog->generic_costs()) {
+    prog_->AddCost(binding);
+  }
+  for (const auto& binding : prog->l2norm_costs()) {
+    prog_->AddCost(binding);
+  }
+  auto add_constraints = [this](const auto& bindings) {
+    for (const auto& binding : bindings) {
+      prog_->AddConstraint(binding);
+    }
+  };
+  add_constraints(prog->generic_constraints());
+  add_constraints(prog->quadratic_constraints());
+  add_constraints(prog->lorentz_cone_constraints());
+  add_constraints(prog->rotated_lorentz_cone_constraints());
+  add_constraints(prog->positive_semidefinite_constraints());
+  add_constraints(prog->linear_matrix_inequality_constraints());
+  add_constraints(prog->linear_complementarity_constraints());
+  add_constraints(prog->exponential_cone_constraints());
+}
+
+PresolvedProgram::~PresolvedProgram() = default;
+
+MathematicalProgramResult PresolvedProgram::Postsolve(
+    const MathematicalProgramResult& result) const {
+  DRAKE_THROW_UNLESS(result.get_decision_variable_index().has_value());
+  DRAKE_THROW_UNLESS(static_cast<int>(result.get_x_val().rows()) ==
+                     prog_->num_vars());
+  MathematicalProgramResult original_result;
+  original_result.set_decision_variable_index(
+      original_prog_->decision_variable_index());
+  Eigen::VectorXd x_val(original_prog_->num_vars());
+  for (int i = 0; i < original_prog_->num_vars(); ++i) {
+    x_val(i) = is_removed_[i]
+                   ? fixed_values_(i)
+                   : result.GetSolution(original_prog_->decision_variable(i));
+  }
+  original_result.set_x_val(x_val);
+  original_result.set_solution_result(result.get_solution_result());
+  original_result.set_optimal_cost(result.get_optimal_cost() + cost_offset_);
+  original_result.set_solver_id(result.get_solver_id());
+  return original_result;
+}
+}  // namespace solvers
+}  // namespace drake
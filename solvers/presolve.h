@@ -0,0 +1,125 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/mathematical_program_result.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * Options for PresolvedProgram.
+ */
+struct PresolveOptions {
+  /** Removes the decision variables whose lower and upper bounds coincide, by
+   * substituting their values into the linear constraints and the linear or
+   * quadratic costs. */
+  bool remove_fixed_variables{true};
+
+  /** Removes the linear constraint rows which are implied by the bounds of
+   * the variables, and the linear equality constraint rows which are linearly
+   * dependent on the other equality rows (detected through a sparse QR
+   * factorization). */
+  bool remove_redundant_constraints{true};
+
+  /** Converts the linear constraint rows with a single variable into bounds
+   * on that variable, restricts the binary variables to [0, 1], and rounds the
+   * bounds of the binary and integer variables. */
+  bool tighten_bounds{true};
+
+  /** The tolerance used to decide whether two bounds coincide, and whether a
+   * constraint is redundant or infeasible. */
+  double tol{1E-10};
+};
+
+/**
+ * Presolves a MathematicalProgram before dispatching it to a solver. The
+ * presolved program prog() is generally smaller than the original program,
+ * and the solution of the presolved program can be mapped back to the
+ * original program through Postsolve().
+ *
+ * The presolve only rewrites the linear constraints, the bounding box
+ * constraints, and the linear and quadratic costs. The decision variables
+ * bound by any other cost or constraint are never removed from the program,
+ * and those costs and constraints are added to prog() unchanged.
+ *
+ * Example
+ * @code{.cc}
+ * const PresolvedProgram presolved(&prog);
+ * if (!presolved.is_infeasible()) {
+ *   const MathematicalProgramResult result =
+ *       presolved.Postsolve(Solve(presolved.prog()));
+ * }
+ * @endcode
+ *
+ * @note The visualization callbacks of the original program are not added to
+ * prog().
+ */
+class PresolvedProgram {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PresolvedProgram);
+
+  /**
+   * @param prog The program to be presolved. `prog` should remain alive (and
+   * unchanged) during the lifetime of this object.
+   * @param options The options of the presolve.
+   */
+  explicit PresolvedProgram(const MathematicalProgram* prog,
+                            const PresolveOptions& options = {});
+
+  ~PresolvedProgram();
+
+  /** Returns the original program. */
+  [[nodiscard]] const MathematicalProgram& original_prog() const {
+    return *original_prog_;
+  }
+
+  /** Returns the presolved program. If is_infeasible() is true, then this is
+   * a copy of the original program. */
+  [[nodiscard]] const MathematicalProgram& prog() const { return *prog_; }
+
+  /** Returns true if the presolve proves that the original program is
+   * infeasible. */
+  [[nodiscard]] bool is_infeasible() const { return is_infeasible_; }
+
+  /** Returns the number of decision variables removed from the original
+   * program. */
+  [[nodiscard]] int num_removed_variables() const {
+    return num_removed_variables_;
+  }
+
+  /** Returns the number of linear constraint rows removed from the original
+   * program (excluding the bounding box constraints). */
+  [[nodiscard]] int num_removed_linear_constraint_rows() const {
+    return num_removed_linear_constraint_rows_;
+  }
+
+  /**
+   * Maps the result of solving prog() back to the original program.
+   * The returned result has the solution of all the decision variables in
+   * original_prog(), together with the solution result, the optimal cost and
+   * the solver id of `result`.
+   * @note The dual solutions and the solver details are not mapped back.
+   * @throws std::exception if `result` is not obtained from solving prog().
+   */
+  [[nodiscard]] MathematicalProgramResult Postsolve(
+      const MathematicalProgramResult& result) const;
+
+ private:
+  const MathematicalProgram* original_prog_;
+  std::unique_ptr<MathematicalProgram> prog_;
+  bool is_infeasible_{false};
+  int num_removed_variables_{0};
+  int num_removed_linear_constraint_rows_{0};
+  // is_removed_[i] is true if original_prog_->decision_variable(i) is not a
+  // decision variable of prog_, and its value is fixed to fixed_values_(i).
+  std::vector<bool> is_removed_;
+  Eigen::VectorXd fixed_values_;
+  // The constant cost of the removed variables that is not included in
+  // prog_.
+  double cost_offset_{0};
+};
+}  // namespace solvers
+}  // namespace drake
@@ -12,6 +12,7 @@
 #include <memory>
 #include <optional>
 #include <set>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -428,6 +429,36 @@ void EvaluateNonlinearConstraints(
       this_x(i) = xvec(binding_var_indices[i]);
     }
 
+    const std::optional<std::vector<std::pair<int, int>>>&
+        gradient_sparsity_pattern =
+            binding.evaluator()->gradient_sparsity_pattern();
+    if constexpr (!std::is_same_v<C, LinearComplementarityConstraint>) {
+      if (gradient_sparsity_pattern.has_value()) {
+        // Evaluate with the column-compressed auto-diff at the scaled x, and
+        // apply the chain rule for the scaling to each gradient entry.
+        Eigen::VectorXd x_scale = Eigen::VectorXd::Ones(num_variables);
+        for (int i = 0; i < num_variables; i++) {
+          auto it = scale_map.find(binding_var_indices[i]);
+          if (it != scale_map.end()) {
+            x_scale(i) = it->second;
+          }
+        }
+        Eigen::VectorXd y;
+        Eigen::VectorXd gradient_values;
+        c->EvalWithGradient(this_x.cwiseProduct(x_scale), &y,
+                            &gradient_values);
+        for (int i = 0; i < num_constraints; i++) {
+          F[(*constraint_index)++] = y(i);
+        }
+        for (int k = 0; k < gradient_values.rows(); ++k) {
+          (*G_w_duplicate)[(*grad_index)++] =
+              gradient_values(k) *
+              x_scale(gradient_sparsity_pattern.value()[k].second);
+        }
+        continue;
+      }
+    }
+
     // Scale this_x
     auto this_x_scaled = math::InitializeAutoDiff(this_x);
     for (int i = 0; i < num_variables; i++) {
@@ -445,9 +476,6 @@ void EvaluateNonlinearConstraints(
       F[(*constraint_index)++] = ty(i).value();
     }
 
-    const std::optional<std::vector<std::pair<int, int>>>&
-        gradient_sparsity_pattern =
-            binding.evaluator()->gradient_sparsity_pattern();
     if (gradient_sparsity_pattern.has_value()) {
       for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
         (*G_w_duplicate)[(*grad_index)++] =
@@ -500,6 +500,120 @@ GTEST_TEST(EvalAugmentedLagrangian, BoundingBoxConstraint) {
   const AugmentedLagrangianSmooth dut_smooth(&prog, false);
   CheckBoundingBoxConstraintEmpty(dut_smooth);
 }
+
+// The augmented Lagrangian with AutoDiffXd evaluates each binding with the
+// gradient w.r.t the binding variables only, and then applies the chain rule
+// with the gradient of x. Check the result when the gradient of x is not the
+// identity matrix.
+template <typename AL>
+void CheckChainRule(const AL& dut) {
+  const Eigen::VectorXd x_val =
+      (Eigen::VectorXd(5) << 0.5, 1.5, -0.3, 2, 1.2).finished();
+  Eigen::MatrixXd x_grad(5, 2);
+  // clang-format off
+  x_grad << 1, 2,
+            0, -1,
+            3, 0.5,
+            -2, 1,
+            0.4, 0;
+  // clang-format on
+  int s_size = 0;
+  if constexpr (std::is_same_v<AL, AugmentedLagrangianSmooth>) {
+    s_size = dut.s_size();
+  }
+  const Eigen::VectorXd s_val = Eigen::VectorXd::LinSpaced(s_size, 1, 2);
+  Eigen::MatrixXd s_grad(s_size, 2);
+  for (int i = 0; i < s_size; ++i) {
+    s_grad.row(i) << 0.1 * i, -0.2 * i + 1;
+  }
+  const Eigen::VectorXd lambda_val =
+      Eigen::VectorXd::LinSpaced(dut.lagrangian_size(), -1, 2);
+  const double mu = 0.4;
+  const double tol = 1E-10;
+
+  // Evaluate with x (and s) seeded with the identity gradient, and then apply
+  // the chain rule explicitly.
+  VectorX<AutoDiffXd> residue_id;
+  AutoDiffXd cost_id;
+  AutoDiffXd al_id;
+  VectorX<AutoDiffXd> residue;
+  AutoDiffXd cost;
+  AutoDiffXd al;
+  Eigen::MatrixXd al_grad_expected;
+  if constexpr (std::is_same_v<AL, AugmentedLagrangianNonsmooth>) {
+    al_id = dut.template Eval<AutoDiffXd>(math::InitializeAutoDiff(x_val),
+                                          lambda_val, mu, &residue_id,
+                                          &cost_id);
+    al = dut.template Eval<AutoDiffXd>(
+        math::InitializeAutoDiff(x_val, x_grad), lambda_val, mu, &residue,
+        &cost);
+    al_grad_expected = x_grad.transpose() * al_id.derivatives();
+    EXPECT_TRUE(CompareMatrices(math::ExtractGradient(residue),
+                                math::ExtractGradient(residue_id) * x_grad,
+                                tol));
+  } else {
+    Eigen::VectorXd xs_val(5 + s_size);
+    xs_val << x_val, s_val;
+    const AutoDiffVecXd xs_id = math::InitializeAutoDiff(xs_val);
+    al_id = dut.template Eval<AutoDiffXd>(xs_id.head(5), xs_id.tail(s_size),
+                                          lambda_val, mu, &residue_id,
+                                          &cost_id);
+    al = dut.template Eval<AutoDiffXd>(
+        math::InitializeAutoDiff(x_val, x_grad),
+        math::InitializeAutoDiff(s_val, s_grad), lambda_val, mu, &residue,
+        &cost);
+    Eigen::MatrixXd xs_grad(5 + s_size, 2);
+    xs_grad << x_grad, s_grad;
+    al_grad_expected = xs_grad.transpose() * al_id.derivatives();
+    EXPECT_TRUE(CompareMatrices(math::ExtractGradient(residue),
+                                math::ExtractGradient(residue_id) * xs_grad,
+                                tol));
+  }
+  EXPECT_NEAR(al.value(), al_id.value(), tol);
+  EXPECT_TRUE(CompareMatrices(al.derivatives(), al_grad_expected, tol));
+  EXPECT_TRUE(CompareMatrices(math::ExtractValue(residue),
+                              math::ExtractValue(residue_id), tol));
+  EXPECT_NEAR(cost.value(), cost_id.value(), tol);
+  EXPECT_TRUE(CompareMatrices(
+      cost.derivatives(),
+      x_grad.transpose() * cost_id.derivatives().head(5), tol));
+
+  // The double evaluation should match the value of the AutoDiffXd evaluation.
+  Eigen::VectorXd residue_double;
+  double cost_double;
+  double al_double;
+  if constexpr (std::is_same_v<AL, AugmentedLagrangianNonsmooth>) {
+    al_double = dut.template Eval<double>(x_val, lambda_val, mu,
+                                          &residue_double, &cost_double);
+  } else {
+    al_double = dut.template Eval<double>(x_val, s_val, lambda_val, mu,
+                                          &residue_double, &cost_double);
+  }
+  EXPECT_NEAR(al_double, al.value(), tol);
+  EXPECT_NEAR(cost_double, cost.value(), tol);
+  EXPECT_TRUE(
+      CompareMatrices(residue_double, math::ExtractValue(residue), tol));
+}
+
+GTEST_TEST(AugmentedLagrangian, ChainRule) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<5>();
+  auto constraint_evaluator = std::make_shared<DummyConstraint>();
+  constraint_evaluator->set_bounds(Eigen::Vector4d(1, -1, -kInf, 2),
+                                   Eigen::Vector4d(1, 2, 3, kInf));
+  prog.AddConstraint(constraint_evaluator,
+                     Vector2<symbolic::Variable>(x(3), x(1)));
+  prog.AddLinearConstraint(x(0) + 2 * x(4) + x(0) <= 3);
+  prog.AddQuadraticCost(x(0) * x(4) + x(2) * x(2) + 1);
+  prog.AddBoundingBoxConstraint(-1, 1, x(2));
+  prog.AddBoundingBoxConstraint(0, 0, x(4));
+  for (bool include_x_bounds : {false, true}) {
+    const AugmentedLagrangianNonsmooth dut_nonsmooth(&prog, include_x_bounds);
+    CheckChainRule(dut_nonsmooth);
+    const AugmentedLagrangianSmooth dut_smooth(&prog, include_x_bounds);
+    CheckChainRule(dut_smooth);
+  }
+}
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
@@ -37,6 +37,10 @@ class MixedIntegerBranchAndBoundTester {
     return bnb_->PickBranchingNode();
   }
 
+  std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes() const {
+    return bnb_->PickBranchingNodes();
+  }
+
   const symbolic::Variable* PickBranchingVariable(
       const MixedIntegerBranchAndBoundNode& node) const {
     return bnb_->PickBranchingVariable(node);
@@ -1363,6 +1367,72 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, MaxNodesInTree) {
   EXPECT_FALSE(dut2.HasConverged());
   EXPECT_EQ(dut2_solution_result, SolutionResult::kIterationLimit);
 }
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestPickBranchingNodes) {
+  // The first node in a batch is the node that PickBranchingNode() picks,
+  // including how ties are broken.
+  auto prog = ConstructMathematicalProgram2();
+  for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+    MixedIntegerBranchAndBound::Options options{};
+    options.max_nodes_per_batch = 4;
+    MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id(), options);
+    VectorDecisionVariable<5> x =
+        dut.bnb()->root()->prog()->decision_variables();
+    dut.bnb()->SetNodeSelectionMethod(pick_node);
+    dut.mutable_root()->Branch(x(2));
+    dut.mutable_root()->Branch(x(4));
+    const std::vector<MixedIntegerBranchAndBoundNode*> nodes =
+        dut.PickBranchingNodes();
+    ASSERT_FALSE(nodes.empty());
+    EXPECT_EQ(nodes.front(), dut.PickBranchingNode());
+  }
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, BatchedSolve) {
+  // Branch on several nodes in each iteration, and solve the child nodes
+  // concurrently.
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+  Eigen::Matrix<double, 5, 1> x_expected;
+  x_expected << 1, 1.0 / 3.0, 1, 1, 0;
+  const double tol{1E-3};
+  for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+    for (int max_nodes_per_batch : {2, 4}) {
+      int num_explored_nodes{-1};
+      for (int num_threads : {1, 2, 4}) {
+        MixedIntegerBranchAndBound::Options options{};
+        options.max_nodes_per_batch = max_nodes_per_batch;
+        options.parallelism = Parallelism(num_threads);
+        MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id(),
+                                             options);
+        dut.bnb()->SetNodeSelectionMethod(pick_node);
+        EXPECT_EQ(dut.bnb()->Solve(), SolutionResult::kSolutionFound);
+        EXPECT_NEAR(dut.bnb()->GetOptimalCost(), -13.0 / 3, tol);
+        EXPECT_TRUE(CompareMatrices(dut.bnb()->GetSolution(x, 0), x_expected,
+                                    tol, MatrixCompareType::absolute));
+        // The explored tree does not depend on the number of threads.
+        const int num_explored =
+            dut.bnb()->root()->NumExploredNodesInSubtree();
+        if (num_explored_nodes >= 0) {
+          EXPECT_EQ(num_explored, num_explored_nodes);
+        }
+        num_explored_nodes = num_explored;
+      }
+    }
+  }
+
+  // The limit on the number of explored nodes is respected when branching on
+  // several nodes in each iteration. The root relaxation is not integral, and
+  // a limit of two nodes leaves no room to branch on it.
+  MixedIntegerBranchAndBound::Options options{};
+  options.max_explored_nodes = 2;
+  options.max_nodes_per_batch = 4;
+  options.parallelism = Parallelism(2);
+  MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id(), options);
+  EXPECT_EQ(dut.bnb()->Solve(), SolutionResult::kIterationLimit);
+  EXPECT_EQ(dut.bnb()->root()->NumExploredNodesInSubtree(), 1);
+  EXPECT_FALSE(dut.HasConverged());
+}
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
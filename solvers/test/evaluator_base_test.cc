@@ -9,6 +9,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/is_dynamic_castable.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
@@ -248,6 +249,92 @@ GTEST_TEST(EvaluatorBaseTest, IsThreadSafe) {
   EXPECT_TRUE(evaluator2.is_thread_safe());
 }
 
+// y(i) = x(i)² * x(i + 1) for i = 0, ..., n - 2, whose gradient is banded.
+// Records the derivative width of the last AutoDiffXd evaluation.
+class BandedEvaluator : public EvaluatorBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BandedEvaluator);
+
+  explicit BandedEvaluator(int n) : EvaluatorBase(n - 1, n) {}
+
+  int last_derivative_width() const { return last_derivative_width_; }
+
+ private:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override {
+    last_derivative_width_ = x(0).derivatives().size();
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
+              VectorX<symbolic::Expression>* y) const override {
+    DoEvalGeneric(x.cast<symbolic::Expression>().eval(), y);
+  }
+
+  template <typename DerivedX, typename ScalarY>
+  void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
+                     VectorX<ScalarY>* y) const {
+    y->resize(num_outputs());
+    for (int i = 0; i < num_outputs(); ++i) {
+      (*y)(i) = x(i) * x(i) * x(i + 1);
+    }
+  }
+
+  mutable int last_derivative_width_{0};
+};
+
+GTEST_TEST(EvaluatorBaseTest, EvalWithGradient) {
+  const int n = 20;
+  BandedEvaluator evaluator(n);
+  const VectorXd x = VectorXd::LinSpaced(n, -1, 2);
+  const AutoDiffVecXd x_ad = math::InitializeAutoDiff(x);
+  AutoDiffVecXd y_ad;
+  evaluator.Eval(x_ad, &y_ad);
+  const MatrixXd y_grad = math::ExtractGradient(y_ad);
+
+  // Without the sparsity pattern, every variable has its own derivative.
+  VectorXd y;
+  VectorXd gradient_values;
+  evaluator.EvalWithGradient(x, &y, &gradient_values);
+  EXPECT_EQ(evaluator.last_derivative_width(), n);
+  EXPECT_TRUE(CompareMatrices(y, math::ExtractValue(y_ad)));
+  ASSERT_EQ(gradient_values.rows(), (n - 1) * n);
+  for (int i = 0; i < n - 1; ++i) {
+    EXPECT_TRUE(CompareMatrices(gradient_values.segment(i * n, n),
+                                y_grad.row(i).transpose()));
+  }
+
+  // With the sparsity pattern, the columns are compressed to two colors.
+  std::vector<std::pair<int, int>> pattern;
+  for (int i = 0; i < n - 1; ++i) {
+    pattern.emplace_back(i, i);
+    pattern.emplace_back(i, i + 1);
+  }
+  evaluator.SetGradientSparsityPattern(pattern);
+  evaluator.EvalWithGradient(x, &y, &gradient_values);
+  EXPECT_EQ(evaluator.last_derivative_width(), 2);
+  EXPECT_TRUE(CompareMatrices(y, math::ExtractValue(y_ad)));
+  ASSERT_EQ(gradient_values.rows(), pattern.size());
+  for (int k = 0; k < static_cast<int>(pattern.size()); ++k) {
+    EXPECT_EQ(gradient_values(k), y_grad(pattern[k].first, pattern[k].second));
+  }
+
+  // A pattern that omits a true non-zero entry is caught when assertions are
+  // armed.
+  std::vector<std::pair<int, int>> diagonal;
+  for (int i = 0; i < n - 1; ++i) {
+    diagonal.emplace_back(i, i);
+  }
+  evaluator.SetGradientSparsityPattern(diagonal);
+  DRAKE_EXPECT_THROWS_MESSAGE_IF_ARMED(
+      evaluator.EvalWithGradient(x, &y, &gradient_values), ".*");
+}
+
 /**
  * An evaluator with dynamic sized input.
  */
@@ -0,0 +1,221 @@
+#include "drake/solvers/presolve.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/aggregate_costs_constraints.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+const double kInf = std::numeric_limits<double>::infinity();
+
+// Returns a result of solving `prog` with the given solution.
+MathematicalProgramResult MakeResult(const MathematicalProgram& prog,
+                                     const Eigen::VectorXd& x_val) {
+  MathematicalProgramResult result;
+  result.set_decision_variable_index(prog.decision_variable_index());
+  result.set_x_val(x_val);
+  result.set_solution_result(SolutionResult::kSolutionFound);
+  double cost = 0;
+  for (const auto& binding : prog.GetAllCosts()) {
+    cost += prog.EvalBinding(binding, x_val)(0);
+  }
+  result.set_optimal_cost(cost);
+  return result;
+}
+
+GTEST_TEST(PresolveTest, FixedVariables) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<4>();
+  prog.AddBoundingBoxConstraint(2, 2, x(0));
+  prog.AddBoundingBoxConstraint(-1, 1, x(1));
+  prog.AddBoundingBoxConstraint(-0.5, -0.5, x(3));
+  prog.AddLinearConstraint(x(0) + x(1) + 3 * x(2) <= 3);
+  prog.AddLinearEqualityConstraint(x(0) + 2 * x(1) - x(2) + x(3) == 1);
+  prog.AddQuadraticCost(x(0) * x(0) + x(0) * x(1) + x(2) * x(2) + 2 * x(3) + 1);
+  prog.AddLinearCost(3 * x(0) + x(3) + 2);
+
+  const PresolvedProgram dut(&prog);
+  EXPECT_FALSE(dut.is_infeasible());
+  EXPECT_EQ(&dut.original_prog(), &prog);
+  EXPECT_EQ(dut.num_removed_variables(), 2);
+  EXPECT_EQ(dut.num_removed_linear_constraint_rows(), 0);
+  const MathematicalProgram& presolved = dut.prog();
+  EXPECT_EQ(presolved.num_vars(), 2);
+  EXPECT_EQ(presolved.linear_constraints().size(), 1);
+  EXPECT_EQ(presolved.linear_equality_constraints().size(), 1);
+  EXPECT_EQ(presolved.quadratic_costs().size(), 1);
+  // The linear cost only involves fixed variables.
+  EXPECT_EQ(presolved.linear_costs().size(), 0);
+
+  // The presolved program is equivalent to the original program with x(0) = 2
+  // and x(3) = -0.5.
+  const Eigen::Vector2d x_presolved(-0.5, -0.5);
+  const MathematicalProgramResult result =
+      dut.Postsolve(MakeResult(presolved, x_presolved));
+  const Eigen::Vector4d x_expected(2, -0.5, -0.5, -0.5);
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x), x_expected));
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kSolutionFound);
+  double cost_expected = 0;
+  for (const auto& binding : prog.GetAllCosts()) {
+    cost_expected += prog.EvalBinding(binding, x_expected)(0);
+  }
+  EXPECT_NEAR(result.get_optimal_cost(), cost_expected, 1E-12);
+  for (const auto& binding : prog.GetAllConstraints()) {
+    EXPECT_TRUE(prog.CheckSatisfied(binding, x_expected));
+  }
+  for (const auto& binding : presolved.GetAllLinearConstraints()) {
+    EXPECT_TRUE(presolved.CheckSatisfied(binding, x_presolved));
+  }
+  // A solution violating the presolved constraint also violates the original
+  // constraint.
+  const Eigen::Vector2d x_presolved_violated(-0.5, 0);
+  EXPECT_FALSE(presolved.CheckSatisfied(
+      presolved.linear_equality_constraints()[0], x_presolved_violated));
+  EXPECT_FALSE(prog.CheckSatisfied(
+      prog.linear_equality_constraints()[0],
+      dut.Postsolve(MakeResult(presolved, x_presolved_violated))
+          .get_x_val()));
+}
+
+GTEST_TEST(PresolveTest, SingletonRowsAndRedundantRows) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  prog.AddBoundingBoxConstraint(0, 1, x.head<2>());
+  // The singleton rows -2 * x(2) >= -8 and 2 * x(2) >= 4 become the bound
+  // 2 <= x(2) <= 4.
+  prog.AddLinearConstraint(Eigen::RowVectorXd::Constant(1, -2), -8, kInf,
+                           x.segment<1>(2));
+  prog.AddLinearConstraint(Eigen::RowVectorXd::Constant(1, 2), 4, kInf,
+                           x.segment<1>(2));
+  // x(0) + x(1) <= 10 is implied by the bounds.
+  prog.AddLinearConstraint(x(0) + x(1) <= 10);
+  // x(0) + x(2) >= 1 is implied by the tightened bounds.
+  prog.AddLinearConstraint(x(0) + x(2) >= 1);
+  prog.AddLinearConstraint(x(0) - x(1) >= 0.5);
+
+  const PresolvedProgram dut(&prog);
+  EXPECT_FALSE(dut.is_infeasible());
+  EXPECT_EQ(dut.num_removed_variables(), 0);
+  EXPECT_EQ(dut.num_removed_linear_constraint_rows(), 4);
+  const MathematicalProgram& presolved = dut.prog();
+  EXPECT_EQ(presolved.num_vars(), 3);
+  ASSERT_EQ(presolved.GetAllLinearConstraints().size(), 1);
+  ASSERT_EQ(presolved.bounding_box_constraints().size(), 1);
+  Eigen::VectorXd lo;
+  Eigen::VectorXd up;
+  AggregateBoundingBoxConstraints(presolved, &lo, &up);
+  EXPECT_TRUE(CompareMatrices(lo, Eigen::Vector3d(0, 0, 2)));
+  EXPECT_TRUE(CompareMatrices(up, Eigen::Vector3d(1, 1, 4)));
+
+  // Without removing the redundant constraints, only the singleton rows are
+  // removed.
+  PresolveOptions options;
+  options.remove_redundant_constraints = false;
+  const PresolvedProgram dut_no_redundancy(&prog, options);
+  EXPECT_EQ(dut_no_redundancy.num_removed_linear_constraint_rows(), 2);
+  EXPECT_EQ(dut_no_redundancy.prog().GetAllLinearConstraints().size(), 3);
+}
+
+GTEST_TEST(PresolveTest, DependentEqualityRows) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  Eigen::Matrix<double, 3, 3> A;
+  // clang-format off
+  A << 1, 1, 0,
+       0, 1, 1,
+       2, 3, 1;
+  // clang-format on
+  prog.AddLinearEqualityConstraint(A, Eigen::Vector3d(1, 3, 5), x);
+  prog.AddLinearCost(Eigen::Vector3d::Ones(), x);
+
+  const PresolvedProgram dut(&prog);
+  EXPECT_FALSE(dut.is_infeasible());
+  EXPECT_EQ(dut.num_removed_linear_constraint_rows(), 1);
+  ASSERT_EQ(dut.prog().linear_equality_constraints().size(), 1);
+  EXPECT_EQ(dut.prog().linear_equality_constraints()[0].evaluator()
+                ->num_constraints(),
+            2);
+
+  // Now make the dependent row inconsistent.
+  MathematicalProgram prog_infeasible;
+  auto y = prog_infeasible.NewContinuousVariables<3>();
+  prog_infeasible.AddLinearEqualityConstraint(A, Eigen::Vector3d(1, 3, 6), y);
+  const PresolvedProgram dut_infeasible(&prog_infeasible);
+  EXPECT_TRUE(dut_infeasible.is_infeasible());
+  // When the program is infeasible, the presolved program is the original
+  // program.
+  EXPECT_EQ(dut_infeasible.num_removed_linear_constraint_rows(), 0);
+  EXPECT_EQ(dut_infeasible.prog().num_vars(), 3);
+  EXPECT_EQ(dut_infeasible.prog().linear_equality_constraints().size(), 1);
+}
+
+GTEST_TEST(PresolveTest, InfeasibleBounds) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddBoundingBoxConstraint(0, 1, x);
+  // x(0) + x(1) >= 3 is infeasible with the bounds.
+  prog.AddLinearConstraint(x(0) + x(1) >= 3);
+  EXPECT_TRUE(PresolvedProgram(&prog).is_infeasible());
+
+  MathematicalProgram prog2;
+  auto y = prog2.NewContinuousVariables<2>();
+  prog2.AddBoundingBoxConstraint(0, 1, y);
+  // 2 * y(0) >= 3 is infeasible with the bounds.
+  prog2.AddLinearConstraint(Eigen::RowVectorXd::Constant(1, 2), 3, kInf,
+                            y.head<1>());
+  EXPECT_TRUE(PresolvedProgram(&prog2).is_infeasible());
+}
+
+GTEST_TEST(PresolveTest, IntegerVariables) {
+  MathematicalProgram prog;
+  auto b = prog.NewBinaryVariables<2>();
+  auto n = prog.NewContinuousVariables<1>();
+  // 2 * b(0) >= 0.5 fixes the binary variable b(0) to 1.
+  prog.AddLinearConstraint(Eigen::RowVectorXd::Constant(1, 2), 0.5, kInf,
+                           b.head<1>());
+  prog.AddLinearConstraint(b(0) + b(1) + n(0) <= 3);
+  prog.AddLinearCost(b(0) + b(1) + n(0));
+
+  const PresolvedProgram dut(&prog);
+  EXPECT_FALSE(dut.is_infeasible());
+  EXPECT_EQ(dut.num_removed_variables(), 1);
+  EXPECT_EQ(dut.prog().num_vars(), 2);
+  const MathematicalProgramResult result =
+      dut.Postsolve(MakeResult(dut.prog(), Eigen::Vector2d(0, 1)));
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(b), Eigen::Vector2d(1, 0)));
+  EXPECT_EQ(result.GetSolution(n(0)), 1);
+  EXPECT_EQ(result.get_optimal_cost(), 2);
+}
+
+GTEST_TEST(PresolveTest, ProtectedVariables) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  prog.AddBoundingBoxConstraint(1, 1, x(0));
+  prog.AddBoundingBoxConstraint(-kInf, 2, x(1));
+  // x(0) is bound by the Lorentz cone constraint, so it cannot be removed.
+  prog.AddLorentzConeConstraint(x);
+  prog.AddLinearConstraint(x(0) + x(1) + x(2) <= 4);
+  prog.SetInitialGuess(x(1), 0.5);
+
+  const PresolvedProgram dut(&prog);
+  EXPECT_FALSE(dut.is_infeasible());
+  EXPECT_EQ(dut.num_removed_variables(), 0);
+  const MathematicalProgram& presolved = dut.prog();
+  EXPECT_EQ(presolved.num_vars(), 3);
+  EXPECT_EQ(presolved.lorentz_cone_constraints().size(), 1);
+  EXPECT_EQ(presolved.lorentz_cone_constraints()[0],
+            prog.lorentz_cone_constraints()[0]);
+  // The fixed variable x(0) is substituted in the linear constraint.
+  ASSERT_EQ(presolved.linear_constraints().size(), 1);
+  EXPECT_EQ(presolved.linear_constraints()[0].variables().rows(), 2);
+  EXPECT_EQ(presolved.linear_constraints()[0].evaluator()->upper_bound()(0),
+            3);
+  EXPECT_EQ(presolved.GetInitialGuess(x(1)), 0.5);
+}
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
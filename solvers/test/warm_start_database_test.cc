@@ -0,0 +1,161 @@
+#include "drake/solvers/warm_start_database.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/unused.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+// A solver that records the initial guess it is given, and returns the
+// minimizer of the quadratic cost of PopulateProgram() as the solution.
+class RecordingSolver final : public SolverInterface {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RecordingSolver);
+
+  RecordingSolver() = default;
+
+  bool available() const final { return true; }
+  bool enabled() const final { return true; }
+
+  void Solve(const MathematicalProgram& prog,
+             const std::optional<Eigen::VectorXd>& initial_guess,
+             const std::optional<SolverOptions>&,
+             MathematicalProgramResult* result) const final {
+    last_initial_guess_ = initial_guess;
+    result->set_decision_variable_index(prog.decision_variable_index());
+    result->set_solution_result(succeed_ ? SolutionResult::kSolutionFound
+                                         : SolutionResult::kIterationLimit);
+    // The cost is |x - b|², so the solution is b.
+    result->set_x_val(-0.5 * prog.quadratic_costs()[0].evaluator()->b());
+    result->set_solver_id(solver_id());
+  }
+
+  SolverId solver_id() const final {
+    static const never_destroyed<SolverId> result{"recording"};
+    return result.access();
+  }
+
+  bool AreProgramAttributesSatisfied(const MathematicalProgram&) const final {
+    return true;
+  }
+
+  std::string ExplainUnsatisfiedProgramAttributes(
+      const MathematicalProgram&) const final {
+    return "";
+  }
+
+  const std::optional<Eigen::VectorXd>& last_initial_guess() const {
+    return last_initial_guess_;
+  }
+
+  // Sets whether the following solves report success.
+  void set_succeed(bool succeed) { succeed_ = succeed; }
+
+ private:
+  bool succeed_{true};
+  mutable std::optional<Eigen::VectorXd> last_initial_guess_;
+};
+
+// Populates the empty `prog` with min |x - target|², whose structure does not
+// depend on the target.
+void PopulateProgram(const Eigen::Vector2d& target, MathematicalProgram* prog) {
+  auto x = prog->NewContinuousVariables<2>();
+  prog->AddQuadraticErrorCost(Eigen::Matrix2d::Identity(), target, x);
+  prog->AddBoundingBoxConstraint(-10, 10, x);
+}
+
+GTEST_TEST(WarmStartDatabaseTest, StructureHash) {
+  MathematicalProgram prog1;
+  PopulateProgram(Eigen::Vector2d(1, 2), &prog1);
+  MathematicalProgram prog2;
+  PopulateProgram(Eigen::Vector2d(3, 4), &prog2);
+  EXPECT_EQ(WarmStartDatabase::ComputeStructureHash(prog1),
+            WarmStartDatabase::ComputeStructureHash(prog2));
+
+  // An additional constraint changes the structure.
+  MathematicalProgram prog3;
+  PopulateProgram(Eigen::Vector2d(1, 2), &prog3);
+  prog3.AddLinearConstraint(
+      prog3.decision_variable(0) + prog3.decision_variable(1) <= 1);
+  EXPECT_NE(WarmStartDatabase::ComputeStructureHash(prog1),
+            WarmStartDatabase::ComputeStructureHash(prog3));
+
+  // Binding the same cost to the variables in a different order changes the
+  // structure.
+  MathematicalProgram prog4;
+  auto y = prog4.NewContinuousVariables<2>();
+  prog4.AddQuadraticErrorCost(Eigen::Matrix2d::Identity(),
+                              Eigen::Vector2d(1, 2),
+                              Vector2<symbolic::Variable>(y(1), y(0)));
+  prog4.AddBoundingBoxConstraint(-10, 10, y);
+  EXPECT_NE(WarmStartDatabase::ComputeStructureHash(prog1),
+            WarmStartDatabase::ComputeStructureHash(prog4));
+}
+
+GTEST_TEST(WarmStartDatabaseTest, Solve) {
+  WarmStartDatabase dut(2);
+  RecordingSolver solver;
+
+  // The database is empty, so the solve is not seeded.
+  const Eigen::Vector2d target1(1, 2);
+  MathematicalProgram prog;
+  PopulateProgram(target1, &prog);
+  EXPECT_FALSE(dut.FindInitialGuess(prog, target1).has_value());
+  MathematicalProgramResult result = dut.Solve(solver, prog, target1);
+  EXPECT_TRUE(result.is_success());
+  EXPECT_FALSE(solver.last_initial_guess().has_value());
+  EXPECT_EQ(dut.num_entries(), 1);
+
+  // The solution of the nearest target seeds the solve.
+  const Eigen::Vector2d target2(5, 5);
+  MathematicalProgram prog2;
+  PopulateProgram(target2, &prog2);
+  dut.Solve(solver, prog2, target2);
+  const Eigen::Vector2d target3(4, 4);
+  MathematicalProgram prog3;
+  PopulateProgram(target3, &prog3);
+  dut.Solve(solver, prog3, target3);
+  ASSERT_TRUE(solver.last_initial_guess().has_value());
+  EXPECT_TRUE(CompareMatrices(solver.last_initial_guess().value(), target2));
+
+  // The oldest entry is discarded when the capacity is exceeded.
+  EXPECT_EQ(dut.num_entries(), 2);
+  const std::optional<Eigen::VectorXd> guess =
+      dut.FindInitialGuess(prog, target1);
+  ASSERT_TRUE(guess.has_value());
+  EXPECT_TRUE(CompareMatrices(guess.value(), target3));
+
+  // A failed solve is not stored.
+  solver.set_succeed(false);
+  const Eigen::Vector2d target4(0, 0);
+  MathematicalProgram prog4;
+  PopulateProgram(target4, &prog4);
+  result = dut.Solve(solver, prog4, target4);
+  EXPECT_FALSE(result.is_success());
+  EXPECT_EQ(dut.num_entries(), 2);
+
+  // A program with a different structure is not seeded.
+  MathematicalProgram other_prog;
+  PopulateProgram(target1, &other_prog);
+  other_prog.NewContinuousVariables<1>();
+  EXPECT_FALSE(dut.FindInitialGuess(other_prog, target1).has_value());
+
+  // The parameters must have a consistent size.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      unused(dut.FindInitialGuess(prog, Eigen::Vector3d::Zero())),
+      ".*FindInitialGuess.*parameters have size 3.*have size 2.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.Add(prog, Eigen::Vector3d::Zero(), target1),
+                              ".*Add.*parameters have size 3.*have size 2.*");
+
+  dut.Clear();
+  EXPECT_EQ(dut.num_entries(), 0);
+}
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
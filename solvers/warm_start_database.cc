@@ -0,0 +1,126 @@
+#include "drake/solvers/warm_start_database.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/hash.h"
+#include "drake/common/nice_type_name.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+template <typename C>
+void HashAppendBindings(const MathematicalProgram& prog,
+                        const std::vector<Binding<C>>& bindings,
+                        drake::internal::FNV1aHasher* hasher) {
+  for (const auto& binding : bindings) {
+    const EvaluatorBase& evaluator = *binding.evaluator();
+    hash_append(*hasher, NiceTypeName::Get(evaluator));
+    hash_append(*hasher, evaluator.num_outputs());
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    hash_append_range(*hasher, var_indices.begin(), var_indices.end());
+  }
+  hash_append(*hasher, bindings.size());
+}
+}  // namespace
+
+WarmStartDatabase::WarmStartDatabase(int max_entries_per_structure)
+    : max_entries_per_structure_{max_entries_per_structure} {
+  DRAKE_THROW_UNLESS(max_entries_per_structure > 0);
+}
+
+WarmStartDatabase::~WarmStartDatabase() = default;
+
+size_t WarmStartDatabase::ComputeStructureHash(
+    const MathematicalProgram& prog) {
+  drake::internal::FNV1aHasher hasher;
+  hash_append(hasher, prog.num_vars());
+  for (int i = 0; i < prog.num_vars(); ++i) {
+    hash_append(hasher, prog.decision_variable(i).get_type());
+  }
+  HashAppendBindings(prog, prog.GetAllCosts(), &hasher);
+  HashAppendBindings(prog, prog.GetAllConstraints(), &hasher);
+  return size_t{hasher};
+}
+
+void WarmStartDatabase::Add(const MathematicalProgram& prog,
+                            const Eigen::Ref<const Eigen::VectorXd>& parameters,
+                            const Eigen::Ref<const Eigen::VectorXd>& x) {
+  DRAKE_THROW_UNLESS(x.rows() == prog.num_vars());
+  std::deque<Entry>& entries = entries_[ComputeStructureHash(prog)];
+  if (!entries.empty() &&
+      entries.front().parameters.rows() != parameters.rows()) {
+    throw std::invalid_argument(fmt::format(
+        "WarmStartDatabase::Add(): the parameters have size {}, but the "
+        "parameters stored for the same program structure have size {}.",
+        parameters.rows(), entries.front().parameters.rows()));
+  }
+  entries.push_back(Entry{parameters, x});
+  if (static_cast<int>(entries.size()) > max_entries_per_structure_) {
+    entries.pop_front();
+  }
+}
+
+std::optional<Eigen::VectorXd> WarmStartDatabase::FindInitialGuess(
+    const MathematicalProgram& prog,
+    const Eigen::Ref<const Eigen::VectorXd>& parameters) const {
+  const auto it = entries_.find(ComputeStructureHash(prog));
+  if (it == entries_.end() || it->second.empty()) {
+    return std::nullopt;
+  }
+  const std::deque<Entry>& entries = it->second;
+  if (entries.front().parameters.rows() != parameters.rows()) {
+    throw std::invalid_argument(fmt::format(
+        "WarmStartDatabase::FindInitialGuess(): the parameters have size {}, "
+        "but the parameters stored for the same program structure have size "
+        "{}.",
+        parameters.rows(), entries.front().parameters.rows()));
+  }
+  // Search backwards, so that among the entries with the same distance the
+  // newest one is used.
+  const Entry* nearest = nullptr;
+  double nearest_distance = std::numeric_limits<double>::infinity();
+  for (auto entry = entries.rbegin(); entry != entries.rend(); ++entry) {
+    // Guard against a hash collision with a program of a different size.
+    if (entry->x.rows() != prog.num_vars()) {
+      continue;
+    }
+    const double distance = (entry->parameters - parameters).squaredNorm();
+    if (nearest == nullptr || distance < nearest_distance) {
+      nearest = &(*entry);
+      nearest_distance = distance;
+    }
+  }
+  if (nearest == nullptr) {
+    return std::nullopt;
+  }
+  return nearest->x;
+}
+
+MathematicalProgramResult WarmStartDatabase::Solve(
+    const SolverInterface& solver, const MathematicalProgram& prog,
+    const Eigen::Ref<const Eigen::VectorXd>& parameters,
+    const std::optional<SolverOptions>& solver_options) {
+  MathematicalProgramResult result;
+  solver.Solve(prog, FindInitialGuess(prog, parameters), solver_options,
+               &result);
+  if (result.is_success()) {
+    Add(prog, parameters, result.get_x_val());
+  }
+  return result;
+}
+
+int WarmStartDatabase::num_entries() const {
+  int num_entries = 0;
+  for (const auto& [_, entries] : entries_) {
+    num_entries += static_cast<int>(entries.size());
+  }
+  return num_entries;
+}
+}  // namespace solvers
+}  // namespace drake
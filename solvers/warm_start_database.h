@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/mathematical_program_result.h"
+#include "drake/solvers/solver_interface.h"
+#include "drake/solvers/solver_options.h"
+
+namespace drake {
+namespace solvers {
+/**
+ * Stores the solutions of previously solved programs, and uses them to seed
+ * the solves of new programs with the same structure. This is useful when
+ * solving a sequence of nonlinear programs that only differ in some
+ * parameters (for example, the target pose of an inverse kinematics problem),
+ * for which a solution to a program with nearby parameters is a good initial
+ * guess for local solvers such as IpoptSolver or SnoptSolver.
+ *
+ * The solutions are grouped by the structure of their programs (see
+ * ComputeStructureHash()), and within each group the initial guess is the
+ * solution whose parameters are the nearest (in the Euclidean distance) to
+ * the parameters of the new solve. The meaning of the parameters is up to the
+ * caller; they must have the same size for all the programs with the same
+ * structure.
+ *
+ * Example
+ * @code{.cc}
+ * WarmStartDatabase database;
+ * const IpoptSolver solver;
+ * for (const Eigen::Vector3d& target : targets) {
+ *   InverseKinematics ik(plant);
+ *   ik.AddPositionConstraint(..., target, target);
+ *   const MathematicalProgramResult result =
+ *       database.Solve(solver, ik.prog(), target);
+ * }
+ * @endcode
+ *
+ * @note Only the primal solution is stored, since the solvers only accept a
+ * primal initial guess.
+ */
+class WarmStartDatabase {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(WarmStartDatabase);
+
+  /**
+   * @param max_entries_per_structure The maximal number of solutions stored
+   * for each program structure. When it is exceeded, the oldest solution of
+   * that structure is discarded.
+   * @throws std::exception if max_entries_per_structure is not positive.
+   */
+  explicit WarmStartDatabase(int max_entries_per_structure = 100);
+
+  ~WarmStartDatabase();
+
+  /**
+   * Returns a hash of the structure of `prog`, namely the number and the
+   * types of the decision variables, and for every cost and constraint its
+   * evaluator type, its number of outputs and the indices of its bound
+   * variables. The data of the evaluators (for example the bounds of the
+   * constraints) are not part of the structure.
+   */
+  static size_t ComputeStructureHash(const MathematicalProgram& prog);
+
+  /**
+   * Stores the solution `x` of `prog` solved with `parameters`.
+   * @throws std::exception if the size of `x` is not prog.num_vars(), or if
+   * `parameters` has a different size from the parameters stored for the same
+   * program structure.
+   */
+  void Add(const MathematicalProgram& prog,
+           const Eigen::Ref<const Eigen::VectorXd>& parameters,
+           const Eigen::Ref<const Eigen::VectorXd>& x);
+
+  /**
+   * Returns the stored solution of a program with the same structure as
+   * `prog` whose parameters are the nearest to `parameters`, or nullopt if
+   * there is no stored solution for this structure.
+   * @throws std::exception if `parameters` has a different size from the
+   * parameters stored for the same program structure.
+   */
+  [[nodiscard]] std::optional<Eigen::VectorXd> FindInitialGuess(
+      const MathematicalProgram& prog,
+      const Eigen::Ref<const Eigen::VectorXd>& parameters) const;
+
+  /**
+   * Solves `prog` with `solver`, using FindInitialGuess() as the initial
+   * guess when it exists (otherwise the initial guess stored in `prog` is
+   * used). If the solve succeeds, then its solution is added to the database.
+   */
+  MathematicalProgramResult Solve(
+      const SolverInterface& solver, const MathematicalProgram& prog,
+      const Eigen::Ref<const Eigen::VectorXd>& parameters,
+      const std::optional<SolverOptions>& solver_options = std::nullopt);
+
+  /** Returns the total number of stored solutions. */
+  [[nodiscard]] int num_entries() const;
+
+  /** Removes all the stored solutions. */
+  void Clear() { entries_.clear(); }
+
+ private:
+  struct Entry {
+    Eigen::VectorXd parameters;
+    Eigen::VectorXd x;
+  };
+
+  int max_entries_per_structure_{};
+  // Maps the structure hash to the stored solutions, from the oldest to the
+  // newest.
+  std::unordered_map<size_t, std::deque<Entry>> entries_;
+};
+}  // namespace solvers
+}  // namespace drake